@@ -8,6 +8,7 @@
 #include "Settings.h"
 #include "PacketData.h"
 #include "UniverseData.h"
+#include "PacketReader.h"
 #include "../xLights/UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -94,18 +95,14 @@ public:
         artNETSocketReceive->Notify(false);
         artNETSocketReceive->SetTimeout(1);
 
-        uint8_t buffer[ARTNET_PACKET_HEADERLEN + 512];
+        PacketReader reader(artNETSocketReceive, ARTNET_PACKET_HEADERLEN + 512);
 
         while (!_stop)
         {
-            memset(buffer, 0x00, sizeof(buffer));
-
-            artNETSocketReceive->Read(buffer, sizeof(buffer));
-            if (!_stop)
+            int count = reader.Read(1000);
+            for (int i = 0; i < count && !_stop; i++)
             {
-                //logger_base.debug(" Read done. %ldms", sw.Time());
-                int read = artNETSocketReceive->GetLastIOReadSize();
-                _receiver->StashPacket(buffer, read);
+                _receiver->StashPacket(reader.GetPacket(i), reader.GetSize(i));
             }
         }
 
@@ -208,6 +205,9 @@ void ArtNETReceiver::StashPacket(uint8_t* buffer, int size)
         return;
     }
 
+    // only dmx packets carry data to mix ... the rest are quietly dropped
+    if (buffer[9] != 0x50) return;
+
     int universe = ((int)buffer[15] << 8) + (int)buffer[14];
 
     UniverseData* ud = GetUniverseData(universe);
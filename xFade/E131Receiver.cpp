@@ -8,6 +8,7 @@
 #include "Settings.h"
 #include "PacketData.h"
 #include "UniverseData.h"
+#include "PacketReader.h"
 #include "../xLights/UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -111,18 +112,14 @@ public:
         e131SocketReceive->Notify(false);
         e131SocketReceive->SetTimeout(1);
 
-        uint8_t buffer[E131_PACKET_HEADERLEN + 512];
+        PacketReader reader(e131SocketReceive, E131_PACKET_HEADERLEN + 512);
 
         while (!_stop)
         {
-            memset(buffer, 0x00, sizeof(buffer));
-
-            e131SocketReceive->Read(buffer, sizeof(buffer));
-            if (!_stop)
+            int count = reader.Read(1000);
+            for (int i = 0; i < count && !_stop; i++)
             {
-                //logger_base.debug(" Read done. %ldms", sw.Time());
-                int read = e131SocketReceive->GetLastIOReadSize();
-                if (read > 0) _receiver->StashPacket(buffer, read);
+                if (reader.GetSize(i) > 0) _receiver->StashPacket(reader.GetPacket(i), reader.GetSize(i));
             }
         }
 
@@ -7,6 +7,7 @@
 #include "xFadeMain.h"
 #include "Settings.h"
 #include "PacketData.h"
+#include "UniverseData.h"
 #include "../xLights/UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -97,11 +98,12 @@ public:
 
         PacketData sendData;
         auto universes = _emitter->GetUniverses();
+        auto next = std::chrono::steady_clock::now();
 
         while (!_stop)
         {
-            auto start = wxDateTime::UNow();
-            int diffMS = 0;
+            _emitter->WaitForUniverses(next);
+            if (_stop) break;
 
             int lb = _emitter->GetLeftBrightness();
             int rb = _emitter->GetRightBrightness();
@@ -111,19 +113,28 @@ public:
             wxASSERT(rb >= 0 && rb <= 100);
             wxASSERT(pos >= 0.0 && pos <= 1.0);
 
+            // a universe goes out as soon as the sides we are showing have new data and every universe goes out
+            // once a frame regardless so nothing goes stale if a side stops sending
+            auto now = std::chrono::steady_clock::now();
+            bool all = now >= next;
+
             // output the frames now
             for (const auto& it : universes)
             {
-                it.second->GetOutput(&sendData, lb, rb, pos);
-                sendData.Send(e131SocketSend, artNETSocketSend, it.second->GetTargetIP());
-                _emitter->IncrementSent();
+                if (all || it.second->IsReady(pos))
+                {
+                    it.second->GetOutput(&sendData, lb, rb, pos);
+                    sendData.Send(e131SocketSend, artNETSocketSend, it.second->GetTargetIP());
+                    _emitter->IncrementSent();
+                }
             }
 
-            auto diff = wxDateTime::UNow() - start;
-            diffMS = _emitter->GetFrameMS() - diff.GetMilliseconds().ToLong();
-
-            if (diffMS > 0)
-                wxMilliSleep(diffMS);
+            if (all)
+            {
+                auto frame = std::chrono::milliseconds(_emitter->GetFrameMS());
+                next += frame;
+                if (next <= now) next = now + frame;
+            }
         }
 
         if (e131SocketSend != nullptr)
@@ -153,10 +164,16 @@ Emitter::Emitter(const std::map<int, UniverseData*>& universes, std::string loca
     _pos = 0.0;
     _localIP = localIP;
     _stop = false;
+    _pending = false;
     _frameMS = 50;
     _leftBrightness = 100;
     _rightBrightness = 100;
 
+    for (const auto& it : _universes)
+    {
+        it.second->SetEmitter(this);
+    }
+
     _emitterThread = new EmitterThread(this);
     _emitterThread->Create();
     _emitterThread->Run();
@@ -167,9 +184,35 @@ Emitter::~Emitter()
     Stop();
 }
 
+void Emitter::UniverseUpdated()
+{
+    // only the first packet since the emitter last looked needs to wake it
+    if (!_pending.exchange(true))
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _signal.notify_all();
+    }
+}
+
+void Emitter::WaitForUniverses(std::chrono::steady_clock::time_point deadline)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _signal.wait_until(lock, deadline, [this] { return _pending || _stop; });
+    _pending = false;
+}
+
 void Emitter::Stop()
 {
-    _stop = true;
+    for (const auto& it : _universes)
+    {
+        it.second->SetEmitter(nullptr);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _stop = true;
+        _signal.notify_all();
+    }
 
     // tell it to stop ... but it may take a bit of time to stop
     if (_emitterThread != nullptr)
@@ -179,4 +222,4 @@ void Emitter::Stop()
         delete _emitterThread;
         _emitterThread = nullptr;
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 #include <mutex>
 #include <map>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include "PacketData.h"
 
 #define PINGINTERVAL 60
@@ -21,11 +23,14 @@ class Emitter
     std::map<int, UniverseData*> _universes;
     std::atomic<int> _frameMS; // = 50;
     std::atomic<float> _pos; // = 0.0;
-    bool _stop = false;
+    std::atomic<bool> _stop; // = false;
     std::string _localIP;
     std::atomic<int> _leftBrightness;
     std::atomic<int> _rightBrightness;
     Settings* _settings = nullptr;
+    std::atomic<bool> _pending; // = false; set when a universe has had a packet since we last looked
+    std::mutex _lock;
+    std::condition_variable _signal;
 
     public:
 
@@ -47,5 +52,9 @@ class Emitter
     void IncrementSent() { _sent++; }
     void ZeroSent() { _sent = 0; }
     Settings* GetSettings() const { return _settings; }
+    // called by the receivers each time a universe gets a packet
+    void UniverseUpdated();
+    // waits until a universe gets a packet or the deadline passes
+    void WaitForUniverses(std::chrono::steady_clock::time_point deadline);
 };
 
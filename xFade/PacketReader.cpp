@@ -0,0 +1,62 @@
+#include "PacketReader.h"
+
+#include <wx/socket.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __LINUX__
+#include <poll.h>
+#endif
+
+PacketReader::PacketReader(wxDatagramSocket* socket, int packetSize)
+{
+    _socket = socket;
+    _packetSize = packetSize;
+
+#ifdef __LINUX__
+    _buffer.resize(PACKETREADER_BATCH * packetSize);
+    _sizes.resize(PACKETREADER_BATCH);
+    _msgs.resize(PACKETREADER_BATCH);
+    _iovs.resize(PACKETREADER_BATCH);
+    memset(_msgs.data(), 0x00, _msgs.size() * sizeof(mmsghdr));
+    for (int i = 0; i < PACKETREADER_BATCH; i++)
+    {
+        _iovs[i].iov_base = GetPacket(i);
+        _iovs[i].iov_len = packetSize;
+        _msgs[i].msg_hdr.msg_iov = &_iovs[i];
+        _msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+#else
+    _buffer.resize(packetSize);
+    _sizes.resize(1);
+#endif
+}
+
+int PacketReader::Read(int timeoutMS)
+{
+#ifdef __LINUX__
+    int fd = (int)_socket->GetSocket();
+
+    pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, timeoutMS) <= 0) return 0;
+
+    int count = recvmmsg(fd, _msgs.data(), PACKETREADER_BATCH, MSG_DONTWAIT, nullptr);
+    if (count <= 0) return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        _sizes[i] = (int)_msgs[i].msg_len;
+    }
+    return count;
+#else
+    // the socket timeout is whole seconds
+    _socket->SetTimeout(std::max(1, timeoutMS / 1000));
+    _socket->Read(GetPacket(0), _packetSize);
+    _sizes[0] = _socket->GetLastIOReadSize();
+    return _sizes[0] > 0 ? 1 : 0;
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#ifdef __LINUX__
+#include <sys/socket.h>
+#endif
+
+class wxDatagramSocket;
+
+// the most packets we take off the socket in one go
+#define PACKETREADER_BATCH 64
+
+// Reads packets off a datagram socket in batches. On linux recvmmsg takes everything waiting in one call ... with
+// hundreds of universes per side that saves a system call per packet. Elsewhere it reads one packet at a time.
+class PacketReader
+{
+    wxDatagramSocket* _socket = nullptr;
+    int _packetSize = 0;
+    std::vector<uint8_t> _buffer;
+    std::vector<int> _sizes;
+#ifdef __LINUX__
+    std::vector<mmsghdr> _msgs;
+    std::vector<iovec> _iovs;
+#endif
+
+public:
+
+    PacketReader(wxDatagramSocket* socket, int packetSize);
+    virtual ~PacketReader() {}
+
+    // waits up to timeoutMS for packets to arrive and returns how many were read
+    int Read(int timeoutMS);
+    uint8_t* GetPacket(int i) { return &_buffer[i * _packetSize]; }
+    int GetSize(int i) const { return _sizes[i]; }
+};
@@ -1,10 +1,14 @@
 #include "UniverseData.h"
+#include "Emitter.h"
 
 std::string UniverseData::__leftTag = "";
 std::string UniverseData::__rightTag = "";
 
 UniverseData::UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, std::list<int> excludedChannels) :
     _universe(universe),
+    _leftSent(0),
+    _rightSent(0),
+    _emitter(nullptr),
     _targetIP(targetIP),
     _excludedChannels(excludedChannels)
 {
@@ -26,59 +30,89 @@ UniverseData::UniverseData(int universe, const std::string& targetIP, const std:
     }
 }
 
-int UniverseData::GetLeftSequenceNum()
+bool PacketBuffer::Update(int type, uint8_t* buffer, int size)
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _left.GetSequenceNum();
+    // artnet packets which are not dmx are not copied so there is nothing to pass on
+    if (type == ARTNETPORT && size > 9 && buffer[9] != 0x50) return false;
+
+    if (!_buffers[_write].Update(type, buffer, size)) return false;
+
+    _sequenceNum = _buffers[_write].GetSequenceNum();
+    _write = _latest.exchange(_write | PACKETBUFFER_FRESH, std::memory_order_acq_rel) & PACKETBUFFER_INDEX;
+    _count++;
+    return true;
 }
 
-int UniverseData::GetRightSequenceNum()
+PacketData& PacketBuffer::Read()
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _right.GetSequenceNum();
+    if ((_latest.load(std::memory_order_relaxed) & PACKETBUFFER_FRESH) != 0)
+    {
+        _read = _latest.exchange(_read, std::memory_order_acq_rel) & PACKETBUFFER_INDEX;
+    }
+    return _buffers[_read];
 }
 
 bool UniverseData::UpdateLeft(int type, uint8_t* buffer, int size)
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _left.Update(type, buffer, size);
+    if (!_left.Update(type, buffer, size)) return false;
+
+    Emitter* emitter = _emitter;
+    if (emitter != nullptr) emitter->UniverseUpdated();
+    return true;
 }
 
 bool UniverseData::UpdateRight(int type, uint8_t* buffer, int size)
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _right.Update(type, buffer, size);
+    if (!_right.Update(type, buffer, size)) return false;
+
+    Emitter* emitter = _emitter;
+    if (emitter != nullptr) emitter->UniverseUpdated();
+    return true;
+}
+
+bool UniverseData::IsReady(float pos) const
+{
+    bool left = _left.GetCount() != _leftSent;
+    bool right = _right.GetCount() != _rightSent;
+
+    if (pos == 0.0) return left;
+    if (pos == 1.0) return right;
+    return left && right;
 }
 
 PacketData* UniverseData::GetOutput(PacketData* output, int leftBrightness, int rightBrightness, float pos)
 {
-    std::unique_lock<std::mutex> lock(_lock);
+    // take the counts first so anything that arrives while we are reading still counts as new next time
+    _leftSent = _left.GetCount();
+    _rightSent = _right.GetCount();
+    PacketData& left = _left.Read();
+    PacketData& right = _right.Read();
 
-    if (_left._length == 0 && _right._length > 0)
+    if (left._length == 0 && right._length > 0)
     {
-        _left.InitialiseLength(_right._type, _right._length, _universe);
+        left.InitialiseLength(right._type, right._length, _universe);
     }
-    else if (_right._length == 0 && _left._length > 0)
+    else if (right._length == 0 && left._length > 0)
     {
-        _right.InitialiseLength(_left._type, _left._length, _universe);
+        right.InitialiseLength(left._type, left._length, _universe);
     }
 
     if (pos == 0.0)
     {
-        PrepareData(output, &_left, _targetProtocol);
+        PrepareData(output, &left, _targetProtocol);
         output->ApplyBrightness(leftBrightness, _excludedChannels);
     }
     else if (pos == 1.0)
     {
-        PrepareData(output, &_right, _targetProtocol);
+        PrepareData(output, &right, _targetProtocol);
         output->ApplyBrightness(rightBrightness, _excludedChannels);
     }
     else
     {
-        int sz = std::min(_left.GetDataLength(), _right.GetDataLength());
+        int sz = std::min(left.GetDataLength(), right.GetDataLength());
 
-        PacketData l = _left;
-        PacketData r = _right;
+        PacketData l = left;
+        PacketData r = right;
         l.ApplyBrightness(leftBrightness, _excludedChannels);
         r.ApplyBrightness(rightBrightness, _excludedChannels);
 
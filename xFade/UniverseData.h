@@ -1,16 +1,50 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
 
 #include "PacketData.h"
 
+class Emitter;
+
+#define PACKETBUFFER_INDEX 0x03
+#define PACKETBUFFER_FRESH 0x04
+
+// The latest packet received for one side of a universe. One receiver thread writes it and the emitter thread
+// reads it and neither ever waits on the other. There are three buffers ... the writer and the reader each have
+// one to themselves and the third holds the newest complete packet which they swap for when they are done.
+class PacketBuffer
+{
+    PacketData _buffers[3];
+    std::atomic<uint8_t> _latest; // index of the newest packet plus PACKETBUFFER_FRESH until the reader takes it
+    uint8_t _write = 1; // writer only
+    uint8_t _read = 0; // reader only
+    std::atomic<uint32_t> _count;
+    std::atomic<int> _sequenceNum;
+
+public:
+
+    PacketBuffer() : _latest(2), _count(0), _sequenceNum(-1) {}
+
+    // writer side
+    bool Update(int type, uint8_t* buffer, int size);
+
+    // reader side ... the newest packet which stays put until the next call
+    PacketData& Read();
+
+    // how many packets have been written
+    uint32_t GetCount() const { return _count; }
+    int GetSequenceNum() const { return _sequenceNum; }
+};
+
 class UniverseData
 {
     int _universe = 0;
     int _targetProtocol = 0;
-    std::mutex _lock;
-    PacketData _left;
-    PacketData _right;
+    PacketBuffer _left;
+    PacketBuffer _right;
+    std::atomic<uint32_t> _leftSent; // packet counts when we last sent
+    std::atomic<uint32_t> _rightSent;
+    std::atomic<Emitter*> _emitter;
     std::string _targetIP;
     std::list<int> _excludedChannels;
 
@@ -26,14 +60,16 @@ public:
     static void SetLeftTag(const std::string& left) { __leftTag = left; }
     static void SetRightTag(const std::string& right) { __rightTag = right; }
     int GetUniverse() const { return _universe; }
-    std::mutex& GetLock() { return _lock; }
     std::string GetTargetIP() const { return _targetIP; }
+    void SetEmitter(Emitter* emitter) { _emitter = emitter; }
     bool UpdateLeft(int type, uint8_t* buffer, int size);
     bool UpdateRight(int type, uint8_t* buffer, int size);
-    int GetLeftSequenceNum();
-    int GetRightSequenceNum();
+    int GetLeftSequenceNum() const { return _left.GetSequenceNum(); }
+    int GetRightSequenceNum() const { return _right.GetSequenceNum(); }
     int GetOutputFormat() const { return _targetProtocol; }
     UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, std::list<int> excludedChannels);
     virtual ~UniverseData() {}
+    // true if every side that shows at this fade position has new data since we last sent
+    bool IsReady(float pos) const;
     PacketData* GetOutput(PacketData* output, int leftBrightness, int rightBrightness, float pos);
 };
@@ -40,9 +40,9 @@ OBJDIR_LINUX_RELEASE = .objs_lr
 DEP_LINUX_RELEASE = 
 OUT_LINUX_RELEASE = ../bin/xFade
 
-OBJ_LINUX_DEBUG = $(OBJDIR_LINUX_DEBUG)/PacketData.o $(OBJDIR_LINUX_DEBUG)/Settings.o $(OBJDIR_LINUX_DEBUG)/SettingsDialog.o $(OBJDIR_LINUX_DEBUG)/UniverseData.o $(OBJDIR_LINUX_DEBUG)/UniverseEntryDialog.o $(OBJDIR_LINUX_DEBUG)/MIDIListener.o $(OBJDIR_LINUX_DEBUG)/wxLED.o $(OBJDIR_LINUX_DEBUG)/xFadeApp.o $(OBJDIR_LINUX_DEBUG)/xFadeMain.o $(OBJDIR_LINUX_DEBUG)/ArtNETReceiver.o $(OBJDIR_LINUX_DEBUG)/__/xLights/UtilFunctions.o $(OBJDIR_LINUX_DEBUG)/__/xLights/xLightsTimer.o $(OBJDIR_LINUX_DEBUG)/__/xLights/xLightsVersion.o $(OBJDIR_LINUX_DEBUG)/__/xSchedule/wxMIDI/src/wxMidi.o $(OBJDIR_LINUX_DEBUG)/__/xSchedule/wxMIDI/src/wxMidiDatabase.o $(OBJDIR_LINUX_DEBUG)/__/xLights/IPEntryDialog.o $(OBJDIR_LINUX_DEBUG)/E131Receiver.o $(OBJDIR_LINUX_DEBUG)/Emitter.o $(OBJDIR_LINUX_DEBUG)/FadeExcludeDialog.o $(OBJDIR_LINUX_DEBUG)/MIDIAssociateDialog.o
+OBJ_LINUX_DEBUG = $(OBJDIR_LINUX_DEBUG)/PacketData.o $(OBJDIR_LINUX_DEBUG)/PacketReader.o $(OBJDIR_LINUX_DEBUG)/Settings.o $(OBJDIR_LINUX_DEBUG)/SettingsDialog.o $(OBJDIR_LINUX_DEBUG)/UniverseData.o $(OBJDIR_LINUX_DEBUG)/UniverseEntryDialog.o $(OBJDIR_LINUX_DEBUG)/MIDIListener.o $(OBJDIR_LINUX_DEBUG)/wxLED.o $(OBJDIR_LINUX_DEBUG)/xFadeApp.o $(OBJDIR_LINUX_DEBUG)/xFadeMain.o $(OBJDIR_LINUX_DEBUG)/ArtNETReceiver.o $(OBJDIR_LINUX_DEBUG)/__/xLights/UtilFunctions.o $(OBJDIR_LINUX_DEBUG)/__/xLights/xLightsTimer.o $(OBJDIR_LINUX_DEBUG)/__/xLights/xLightsVersion.o $(OBJDIR_LINUX_DEBUG)/__/xSchedule/wxMIDI/src/wxMidi.o $(OBJDIR_LINUX_DEBUG)/__/xSchedule/wxMIDI/src/wxMidiDatabase.o $(OBJDIR_LINUX_DEBUG)/__/xLights/IPEntryDialog.o $(OBJDIR_LINUX_DEBUG)/E131Receiver.o $(OBJDIR_LINUX_DEBUG)/Emitter.o $(OBJDIR_LINUX_DEBUG)/FadeExcludeDialog.o $(OBJDIR_LINUX_DEBUG)/MIDIAssociateDialog.o
 
-OBJ_LINUX_RELEASE = $(OBJDIR_LINUX_RELEASE)/PacketData.o $(OBJDIR_LINUX_RELEASE)/Settings.o $(OBJDIR_LINUX_RELEASE)/SettingsDialog.o $(OBJDIR_LINUX_RELEASE)/UniverseData.o $(OBJDIR_LINUX_RELEASE)/UniverseEntryDialog.o $(OBJDIR_LINUX_RELEASE)/MIDIListener.o $(OBJDIR_LINUX_RELEASE)/wxLED.o $(OBJDIR_LINUX_RELEASE)/xFadeApp.o $(OBJDIR_LINUX_RELEASE)/xFadeMain.o $(OBJDIR_LINUX_RELEASE)/ArtNETReceiver.o $(OBJDIR_LINUX_RELEASE)/__/xLights/UtilFunctions.o $(OBJDIR_LINUX_RELEASE)/__/xLights/xLightsTimer.o $(OBJDIR_LINUX_RELEASE)/__/xLights/xLightsVersion.o $(OBJDIR_LINUX_RELEASE)/__/xSchedule/wxMIDI/src/wxMidi.o $(OBJDIR_LINUX_RELEASE)/__/xSchedule/wxMIDI/src/wxMidiDatabase.o $(OBJDIR_LINUX_RELEASE)/__/xLights/IPEntryDialog.o $(OBJDIR_LINUX_RELEASE)/E131Receiver.o $(OBJDIR_LINUX_RELEASE)/Emitter.o $(OBJDIR_LINUX_RELEASE)/FadeExcludeDialog.o $(OBJDIR_LINUX_RELEASE)/MIDIAssociateDialog.o
+OBJ_LINUX_RELEASE = $(OBJDIR_LINUX_RELEASE)/PacketData.o $(OBJDIR_LINUX_RELEASE)/PacketReader.o $(OBJDIR_LINUX_RELEASE)/Settings.o $(OBJDIR_LINUX_RELEASE)/SettingsDialog.o $(OBJDIR_LINUX_RELEASE)/UniverseData.o $(OBJDIR_LINUX_RELEASE)/UniverseEntryDialog.o $(OBJDIR_LINUX_RELEASE)/MIDIListener.o $(OBJDIR_LINUX_RELEASE)/wxLED.o $(OBJDIR_LINUX_RELEASE)/xFadeApp.o $(OBJDIR_LINUX_RELEASE)/xFadeMain.o $(OBJDIR_LINUX_RELEASE)/ArtNETReceiver.o $(OBJDIR_LINUX_RELEASE)/__/xLights/UtilFunctions.o $(OBJDIR_LINUX_RELEASE)/__/xLights/xLightsTimer.o $(OBJDIR_LINUX_RELEASE)/__/xLights/xLightsVersion.o $(OBJDIR_LINUX_RELEASE)/__/xSchedule/wxMIDI/src/wxMidi.o $(OBJDIR_LINUX_RELEASE)/__/xSchedule/wxMIDI/src/wxMidiDatabase.o $(OBJDIR_LINUX_RELEASE)/__/xLights/IPEntryDialog.o $(OBJDIR_LINUX_RELEASE)/E131Receiver.o $(OBJDIR_LINUX_RELEASE)/Emitter.o $(OBJDIR_LINUX_RELEASE)/FadeExcludeDialog.o $(OBJDIR_LINUX_RELEASE)/MIDIAssociateDialog.o
 
 all: linux_debug linux_release
 
@@ -64,6 +64,9 @@ out_linux_debug: before_linux_debug $(OBJ_LINUX_DEBUG) $(DEP_LINUX_DEBUG)
 $(OBJDIR_LINUX_DEBUG)/PacketData.o: PacketData.cpp
 	$(CXX) $(CFLAGS_LINUX_DEBUG) $(INC_LINUX_DEBUG) -c PacketData.cpp -o $(OBJDIR_LINUX_DEBUG)/PacketData.o
 
+$(OBJDIR_LINUX_DEBUG)/PacketReader.o: PacketReader.cpp
+	$(CXX) $(CFLAGS_LINUX_DEBUG) $(INC_LINUX_DEBUG) -c PacketReader.cpp -o $(OBJDIR_LINUX_DEBUG)/PacketReader.o
+
 $(OBJDIR_LINUX_DEBUG)/Settings.o: Settings.cpp
 	$(CXX) $(CFLAGS_LINUX_DEBUG) $(INC_LINUX_DEBUG) -c Settings.cpp -o $(OBJDIR_LINUX_DEBUG)/Settings.o
 
@@ -140,6 +143,9 @@ out_linux_release: before_linux_release $(OBJ_LINUX_RELEASE) $(DEP_LINUX_RELEASE
 $(OBJDIR_LINUX_RELEASE)/PacketData.o: PacketData.cpp
 	$(CXX) $(CFLAGS_LINUX_RELEASE) $(INC_LINUX_RELEASE) -c PacketData.cpp -o $(OBJDIR_LINUX_RELEASE)/PacketData.o
 
+$(OBJDIR_LINUX_RELEASE)/PacketReader.o: PacketReader.cpp
+	$(CXX) $(CFLAGS_LINUX_RELEASE) $(INC_LINUX_RELEASE) -c PacketReader.cpp -o $(OBJDIR_LINUX_RELEASE)/PacketReader.o
+
 $(OBJDIR_LINUX_RELEASE)/Settings.o: Settings.cpp
 	$(CXX) $(CFLAGS_LINUX_RELEASE) $(INC_LINUX_RELEASE) -c Settings.cpp -o $(OBJDIR_LINUX_RELEASE)/Settings.o
 
@@ -202,11 +208,13 @@ clean_linux_release:
 
 PacketData.cpp: PacketData.h
 
+PacketReader.cpp: PacketReader.h
+
 Settings.cpp: Settings.h
 
 SettingsDialog.cpp: Settings.h SettingsDialog.h UniverseEntryDialog.h FadeExcludeDialog.h
 
-UniverseData.cpp: UniverseData.h
+UniverseData.cpp: UniverseData.h Emitter.h
 
 UniverseData.h: PacketData.h
 
@@ -228,11 +236,11 @@ E131Receiver.h: PacketData.h
 
 ArtNETReceiver.h: PacketData.h
 
-ArtNETReceiver.cpp: ArtNETReceiver.h xFadeMain.h Settings.h PacketData.h UniverseData.h
+ArtNETReceiver.cpp: ArtNETReceiver.h xFadeMain.h Settings.h PacketData.h UniverseData.h PacketReader.h
 
-E131Receiver.cpp: E131Receiver.h xFadeMain.h Settings.h PacketData.h UniverseData.h
+E131Receiver.cpp: E131Receiver.h xFadeMain.h Settings.h PacketData.h UniverseData.h PacketReader.h
 
-Emitter.cpp: Emitter.h xFadeMain.h Settings.h PacketData.h
+Emitter.cpp: Emitter.h xFadeMain.h Settings.h PacketData.h UniverseData.h
 
 FadeExcludeDialog.cpp: FadeExcludeDialog.h Settings.h
 
@@ -388,14 +388,6 @@ void xFadeFrame::InitialiseLEDs()
 
 void xFadeFrame::CloseAll()
 {
-    if (_emitter != nullptr)
-    {
-        _emitter->Stop();
-        wxMilliSleep(100);
-        delete _emitter;
-        _emitter = nullptr;
-    }
-
     if (_e131Receiver != nullptr)
     {
         _e131Receiver->Stop();
@@ -412,6 +404,15 @@ void xFadeFrame::CloseAll()
         _artNETReceiver = nullptr;
     }
 
+    // the receivers tell the emitter when packets arrive so it goes last
+    if (_emitter != nullptr)
+    {
+        _emitter->Stop();
+        wxMilliSleep(100);
+        delete _emitter;
+        _emitter = nullptr;
+    }
+
     for (auto it : _universeData)
     {
         delete it.second;
@@ -430,6 +431,8 @@ void xFadeFrame::OpenAll()
         _universeData[it.first] = new UniverseData(it.first, it.second, _settings._targetProtocol[it.first], _settings.GetExcludeChannels(it.first));
     }
 
+    // the emitter has to be there before the receivers start telling it about packets
+    _emitter = new Emitter(_universeData, _settings._localOutputIP, &_settings);
     if (_settings._ArtNET)
     {
         _artNETReceiver = new ArtNETReceiver(this, _universeData, _settings._localInputIP);
@@ -438,7 +441,6 @@ void xFadeFrame::OpenAll()
     {
         _e131Receiver = new E131Receiver(this, _universeData, _settings._localInputIP);
     }
-    _emitter = new Emitter(_universeData, _settings._localOutputIP, &_settings);
 }
 
 void xFadeFrame::ValidateWindow()
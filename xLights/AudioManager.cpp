@@ -2,11 +2,15 @@
 #include <wx/string.h>
 #include <wx/ffile.h>
 #include <wx/log.h>
+#include <wx/file.h>
+#include <wx/dir.h>
+#include <wx/filename.h>
 
 #include <sstream>
 #include <algorithm>
 
 #include <math.h>
+#include <mutex>
 #include <stdlib.h>
 
 #include "AudioManager.h"
@@ -29,6 +33,13 @@ using namespace Vamp;
 // SDL Functions
 SDL __sdl;
 int __globalVolume = 100;
+
+// where analysed frame data is saved so reopening a sequence does not analyse the audio again
+std::mutex __frameDataCacheLock;
+std::string __frameDataCacheFolder;
+
+#define FRAMEDATA_CACHE_MAGIC 0x44464C58 // XLFD
+#define FRAMEDATA_CACHE_VERSION 1
 int AudioData::__nextId = 0;
 
 #define SDL_INPUT_BUFFER_SIZE 8192
@@ -1224,58 +1235,242 @@ AudioManager::AudioManager(const std::string& audio_file, int step, int block)
     AddAudioDeviceChangeListener(this);
 }
 
-std::list<float> AudioManager::CalculateSpectrumAnalysis(const float* in, int n, float& max, int id) const
+// Turns a block of samples into the level of each MIDI note. The FFT configuration, output and note bins are set up
+// once and reused for every block but kiss_fftr keeps scratch space in its configuration so each thread needs its own.
+class SpectrumAnalyser
 {
-	std::list<float> res;
-	int outcount = n / 2 + 1;
-	kiss_fftr_cfg cfg;
-	kiss_fft_cpx* out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * (outcount));
-	if (out != nullptr)
-	{
-		if ((cfg = kiss_fftr_alloc(n, 0/*is_inverse_fft*/, nullptr, nullptr)) != nullptr)
-		{
-			kiss_fftr(cfg, in, out);
-			free(cfg);
-		}
+    kiss_fftr_cfg _cfg = nullptr;
+    std::vector<kiss_fft_cpx> _out;
+    std::vector<float> _power;
+    std::vector<std::pair<int, int>> _notes; // first and last fft bin of each MIDI note
 
-		for (int j = 0; j < 127; j++)
-		{
+public:
+    SpectrumAnalyser(int n, long rate)
+    {
+        int outcount = n / 2 + 1;
+        _cfg = kiss_fftr_alloc(n, 0/*is_inverse_fft*/, nullptr, nullptr);
+        _out.resize(outcount);
+        _power.resize(outcount);
+
+        for (int j = 0; j < 127; j++)
+        {
             // choose the right bucket for this MIDI note
             double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
-            int start = freq * (double)n / (double)_rate;
+            int start = freq * (double)n / (double)rate;
             double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
-            int end = freqnext * (double)n / (double)_rate;
+            int end = freqnext * (double)n / (double)rate;
 
-            float val = 0.0;
+            // notes too high for the fft are always silent
+            if (end < outcount - 1)
+            {
+                _notes.push_back({ start, end });
+            }
+            else
+            {
+                _notes.push_back({ 0, -1 });
+            }
+        }
+    }
+    SpectrumAnalyser(const SpectrumAnalyser&) = delete;
+    SpectrumAnalyser& operator=(const SpectrumAnalyser&) = delete;
+    virtual ~SpectrumAnalyser()
+    {
+        if (_cfg != nullptr) free(_cfg);
+    }
+
+    void Analyse(const float* in, std::vector<float>& res, float& max)
+    {
+        res.clear();
+        if (_cfg == nullptr) return;
+
+        kiss_fftr(_cfg, in, _out.data());
+
+        // squared magnitudes in a flat loop the compiler can vectorise ... the root is only taken of each note's peak
+        const kiss_fft_cpx* out = _out.data();
+        float* power = _power.data();
+        int count = _out.size();
+        for (int k = 0; k < count; k++)
+        {
+            power[k] = out[k].r * out[k].r + out[k].i * out[k].i;
+        }
 
+        res.reserve(_notes.size());
+        for (const auto& it : _notes)
+        {
             // got through all buckets up to the next note and take the maximums
-            if (end < outcount-1)
+            float val = 0.0;
+            for (int k = it.first; k <= it.second; k++)
             {
-                for (int k = start; k <= end; k++)
-                {
-                    kiss_fft_cpx* cur = out + k;
-                    val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
-                    //float valscaled = valnew * scaling;
-                }
+                val = std::max(val, power[k]);
             }
 
-			float db = log10(val);
-			if (db < 0.0)
-			{
-				db = 0.0;
-			}
+            float db = log10(sqrtf(val));
+            if (db < 0.0)
+            {
+                db = 0.0;
+            }
 
-			res.push_back(db);
-			if (db > max)
-			{
-				max = db;
-			}
-		}
+            res.push_back(db);
+            if (db > max)
+            {
+                max = db;
+            }
+        }
+    }
+};
 
-		free(out);
-	}
+int AudioManager::GetFrameCount() const
+{
+    int frames = _lengthMS / _intervalMS;
+    while (frames * _intervalMS < _lengthMS)
+    {
+        frames++;
+    }
+    return frames;
+}
+
+void AudioManager::SetFrameDataCacheFolder(const std::string& folder)
+{
+    std::unique_lock<std::mutex> locker(__frameDataCacheLock);
+    __frameDataCacheFolder = folder;
+}
+
+std::string AudioManager::GetFrameDataCacheFile(const std::string& extension)
+{
+    std::string folder;
+    {
+        std::unique_lock<std::mutex> locker(__frameDataCacheLock);
+        folder = __frameDataCacheFolder;
+    }
+
+    if (folder == "" || !wxDir::Exists(folder)) return "";
+
+    // the hash identifies the audio regardless of where the file is or what it is called
+    return folder + wxFileName::GetPathSeparator() + "AudioCache" + wxFileName::GetPathSeparator() +
+        Hash() + "_" + std::to_string(_intervalMS) + "." + extension;
+}
+
+bool AudioManager::LoadFrameDataCache(const std::string& file, int frames, FRAMEDATATYPE first, FRAMEDATATYPE last)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (file == "" || !wxFile::Exists(file)) return false;
+
+    wxFile f;
+    if (!f.Open(file)) return false;
+
+    uint32_t header[3];
+    bool ok = f.Read(header, sizeof(header)) == sizeof(header) &&
+        header[0] == FRAMEDATA_CACHE_MAGIC &&
+        header[1] == FRAMEDATA_CACHE_VERSION &&
+        header[2] == (uint32_t)frames;
+
+    for (int i = first; ok && i <= last; i++)
+    {
+        ok = _frameData[i].Read(f) && _frameData[i].GetFrameCount() == (size_t)frames;
+    }
+
+    if (!ok)
+    {
+        logger_base.warn("Audio frame data cache file %s is not valid ... it will be rebuilt.", (const char *)file.c_str());
+        for (int i = first; i <= last; i++)
+        {
+            _frameData[i].Clear();
+        }
+    }
+    else
+    {
+        // stop it being removed as stale along with the render cache
+        f.Close();
+        wxFileName(file).Touch();
+    }
+    return ok;
+}
+
+void AudioManager::SaveFrameDataCache(const std::string& file, FRAMEDATATYPE first, FRAMEDATATYPE last)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (file == "") return;
+
+    wxFileName fn(file);
+    if (!wxDir::Exists(fn.GetPath()))
+    {
+        wxDir::Make(fn.GetPath());
+    }
+
+    // write to a temporary file so a reader never sees half a file
+    std::string tmp = file + ".tmp";
+    wxFile f;
+    bool ok = f.Create(tmp, true);
+    if (ok)
+    {
+        uint32_t header[3] = { FRAMEDATA_CACHE_MAGIC, FRAMEDATA_CACHE_VERSION, (uint32_t)_frameData[first].GetFrameCount() };
+        ok = f.Write(header, sizeof(header)) == sizeof(header);
+        for (int i = first; ok && i <= last; i++)
+        {
+            ok = _frameData[i].Write(f);
+        }
+        f.Close();
+    }
+
+    if (ok)
+    {
+        ok = wxRenameFile(tmp, file, true);
+    }
+
+    if (!ok)
+    {
+        logger_base.warn("Unable to write audio frame data cache file %s.", (const char *)file.c_str());
+        if (wxFile::Exists(tmp)) wxRemoveFile(tmp);
+        return;
+    }
+
+    // only keep the timing interval we last used ... the others would never be cleaned up
+    wxArrayString files;
+    wxDir::GetAllFiles(fn.GetPath(), &files, Hash() + "_*." + fn.GetExt(), wxDIR_FILES);
+    for (const auto& it : files)
+    {
+        if (wxFileName(it).GetFullName() != fn.GetFullName())
+        {
+            logger_base.debug("Removing audio frame data cache file %s as the timing interval has changed.", (const char *)it.c_str());
+            wxRemoveFile(it);
+        }
+    }
+}
 
-	return res;
+bool FrameDataStore::Read(wxFile& file)
+{
+    uint32_t counts[2];
+    if (file.Read(counts, sizeof(counts)) != sizeof(counts)) return false;
+
+    // dont trust the counts until we know the file is big enough to hold them
+    wxFileOffset needed = ((wxFileOffset)counts[0] + 1 + counts[1]) * 4;
+    if (file.Length() - file.Tell() < needed) return false;
+
+    std::vector<uint32_t> offsets(counts[0] + 1);
+    std::vector<float> values(counts[1]);
+    if (file.Read(offsets.data(), offsets.size() * sizeof(uint32_t)) != (ssize_t)(offsets.size() * sizeof(uint32_t))) return false;
+    if (file.Read(values.data(), values.size() * sizeof(float)) != (ssize_t)(values.size() * sizeof(float))) return false;
+
+    if (offsets.front() != 0 || offsets.back() != counts[1]) return false;
+    for (size_t i = 1; i < offsets.size(); i++)
+    {
+        if (offsets[i] < offsets[i - 1]) return false;
+    }
+
+    _offsets.assign(offsets.begin(), offsets.end());
+    _values = std::move(values);
+    return true;
+}
+
+bool FrameDataStore::Write(wxFile& file) const
+{
+    std::vector<uint32_t> offsets(_offsets.begin(), _offsets.end());
+    uint32_t counts[2] = { (uint32_t)GetFrameCount(), (uint32_t)_values.size() };
+    return file.Write(counts, sizeof(counts)) == sizeof(counts) &&
+        file.Write(offsets.data(), offsets.size() * sizeof(uint32_t)) == offsets.size() * sizeof(uint32_t) &&
+        file.Write(_values.data(), _values.size() * sizeof(float)) == _values.size() * sizeof(float);
 }
 
 void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManagerProgressCallback fn)
@@ -1298,6 +1493,14 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
         wxMilliSleep(100);
     }
 
+    std::string cacheFile = GetFrameDataCacheFile("notes");
+    if (LoadFrameDataCache(cacheFile, GetFrameCount(), FRAMEDATA_NOTES, FRAMEDATA_NOTES))
+    {
+        _polyphonicTranscriptionDone = true;
+        logger_base.info("DoPolyphonicTranscription: Polyphonic transcription loaded from %s in %ld.", (const char *)cacheFile.c_str(), sw.Time());
+        return;
+    }
+
     static log4cpp::Category &logger_pianodata = log4cpp::Category::getInstance(std::string("log_pianodata"));
     logger_pianodata.debug("Processing polyphonic transcription on file " + _audio_file);
     logger_pianodata.debug("Interval %d.", _intervalMS);
@@ -1314,11 +1517,7 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
     else
     {
         float *pdata[2];
-        long frames = _lengthMS / _intervalMS;
-        while (frames * _intervalMS < _lengthMS)
-        {
-            frames++;
-        }
+        long frames = GetFrameCount();
 
         size_t pref_step = pt->getPreferredStepSize();
         size_t pref_block = pt->getPreferredBlockSize();
@@ -1372,6 +1571,7 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
         try
         {
             unsigned int total = 0;
+            std::vector<std::vector<float>> notes(frames);
             logger_pianodata.debug("About to extract Polyphonic Transcription result.");
             Vamp::Plugin::FeatureSet features = pt->getRemainingFeatures();
             logger_pianodata.debug("Polyphonic Transcription result retrieved.");
@@ -1397,24 +1597,33 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
                 if (currentstart - sframe * _intervalMS > _intervalMS / 2) {
                     sframe++;
                 }
-                int eframe = currentend / _intervalMS;
+                int eframe = std::min(currentend / _intervalMS, frames - 1);
                 while (sframe <= eframe) {
-                    _frameData[sframe][4].push_back(features[0][j].values[0]);
+                    notes[sframe].push_back(features[0][j].values[0]);
                     sframe++;
                 }
             }
 
+            FrameDataStore& store = _frameData[FRAMEDATA_NOTES];
+            store.Clear();
+            store.Reserve(frames, 4);
+            for (const auto& it : notes)
+            {
+                store.AddFrame(it);
+            }
+            SaveFrameDataCache(cacheFile, FRAMEDATA_NOTES, FRAMEDATA_NOTES);
+
             fn(dlg, 100);
 
             if (logger_pianodata.isDebugEnabled())
             {
                 logger_pianodata.debug("Piano data calculated:");
                 logger_pianodata.debug("Time MS, Keys");
-                for (size_t i = 0; i < _frameData.size(); i++)
+                for (size_t i = 0; i < _frameData[FRAMEDATA_NOTES].GetFrameCount(); i++)
                 {
                     long ms = i * _intervalMS;
                     std::string keys = "";
-                    for (const auto& it2 : _frameData[i][4])
+                    for (const auto& it2 : _frameData[FRAMEDATA_NOTES].GetFrame(i))
                     {
                         keys += " " + std::string(wxString::Format("%f", it2).c_str());
                     }
@@ -1472,11 +1681,7 @@ void AudioManager::DoPrepareFrameData()
 
 	// samples per frame
 	int samplesperframe = _rate * _intervalMS / 1000;
-	int frames = _lengthMS / _intervalMS;
-	while (frames * _intervalMS < _lengthMS)
-	{
-		frames++;
-	}
+	int frames = GetFrameCount();
 	int totalsamples = frames * samplesperframe;
 
     logger_base.info("    Length %ldms", _lengthMS);
@@ -1485,133 +1690,125 @@ void AudioManager::DoPrepareFrameData()
     logger_base.info("    Frames %d", frames);
     logger_base.info("    Total samples %d", totalsamples);
 
+    // if we analysed this audio before just load the results
+    std::string cacheFile = GetFrameDataCacheFile("framedata");
+    if (LoadFrameDataCache(cacheFile, frames, FRAMEDATA_HIGH, FRAMEDATA_VU))
+    {
+        _frameDataPrepared = true;
+        logger_base.info("DoPrepareFrameData: Audio frame data loaded from %s in %ld. Frames: %d", (const char *)cacheFile.c_str(), sw.Time(), frames);
+        return;
+    }
+
 	// these are used to normalise output
 	_bigmax = -1;
 	_bigspread = -1;
 	_bigmin = 1;
 	_bigspectogrammax = -1;
 
-	size_t step = 2048;
-	float *pdata[2];
-
-	int pos = 0;
-	std::list<float> spectrogram;
-
-	// process each frome of the song
-	for (int i = 0; i < frames; i++)
-	{
-		std::vector<std::list<float>> aFrameData;
-		aFrameData.resize(5); // preallocate the spots we will need
-
-		// accumulators
-		float max = -100.0;
-		float min = 100.0;
-		float spread = -100;
-
-		// clear the data if we are about to get new data ... dont clear it if we wont
-		// this happens because the spectrogram function has a fixed window based on the parameters we set and it
-		// does not match our time slices exactly so we have to select which one to use
-		if (pos < i * samplesperframe + samplesperframe  && pos + step < totalsamples)
+	// the spectrogram is calculated on fixed blocks of samples which do not match our time slices exactly so
+	// each frame takes the peak of the blocks which start within it
+	const int step = 2048;
+	int blocks = totalsamples > step ? (totalsamples - 1) / step : 0;
+
+	std::vector<std::vector<float>> spectrograms(frames);
+	std::vector<char> hasBlock(frames, 0);
+	std::vector<float> maxs(frames);
+	std::vector<float> mins(frames);
+	std::vector<float> spreads(frames);
+	std::mutex bigLock;
+
+	// frames are independent so process them in parallel chunks
+	parallel_for_range(0, frames, [&](int s, int e) {
+		SpectrumAnalyser analyser(step, _rate);
+		std::vector<float> subspectrogram;
+		float bigmax = -1;
+		float bigspread = -1;
+		float bigmin = 1;
+		float bigspectrogrammax = -1;
+
+		for (int i = s; i < e; i++)
 		{
-			spectrogram.clear();
-		}
-
-		// only get the data if we are not ahead of the music
-		while (pos < i * samplesperframe + samplesperframe && pos + step < totalsamples)
-		{
-			std::list<float> subspectrogram;
-			pdata[0] = GetLeftDataPtr(pos);
-			pdata[1] = GetRightDataPtr(pos);
-			float max2 = 0;
-
-			if (pdata[0] == nullptr)
+			std::vector<float>& spectrogram = spectrograms[i];
+			for (int b = (i * samplesperframe + step - 1) / step; b < blocks && b * step < (i + 1) * samplesperframe; b++)
 			{
-				subspectrogram.clear();
-			}
-			else
-			{
-				subspectrogram = CalculateSpectrumAnalysis(pdata[0], step, max2, i);
-			}
+				hasBlock[i] = 1;
+				float max2 = 0;
+				if (b * step > _trackSize)
+				{
+					subspectrogram.clear();
+				}
+				else
+				{
+					analyser.Analyse(&_data[0][b * step], subspectrogram, max2);
+				}
 
-			// and keep track of the larges value so we can normalise it
-			if (max2 > _bigspectogrammax)
-			{
-				_bigspectogrammax = max2;
-			}
-			pos += step;
+				// and keep track of the larges value so we can normalise it
+				bigspectrogrammax = std::max(bigspectrogrammax, max2);
 
-			// either take the newly calculated values or if we are merging two results take the maximum of each value
-			if (spectrogram.size() == 0)
-			{
-				spectrogram = subspectrogram;
-			}
-			else
-			{
-				if (subspectrogram.size() > 0)
+				// either take the newly calculated values or if we are merging two results take the maximum of each value
+				if (spectrogram.size() == 0)
+				{
+					spectrogram = subspectrogram;
+				}
+				else
 				{
-					std::list<float>::iterator sub = subspectrogram.begin();
-					for (std::list<float>::iterator fr = spectrogram.begin(); fr != spectrogram.end(); ++fr)
+					for (size_t k = 0; k < spectrogram.size() && k < subspectrogram.size(); k++)
 					{
-						if (*sub > *fr)
+						if (subspectrogram[k] > spectrogram[k])
 						{
-							*fr = *sub;
+							spectrogram[k] = subspectrogram[k];
 						}
-						++sub;
 					}
 				}
 			}
-		}
-
-		// now do the raw data analysis for the frame
-		for (int j = 0; j < samplesperframe; j++)
-		{
-			float data = GetLeftData(i * samplesperframe + j);
-
-			// Max data
-			if (data > max)
-			{
-				max = data;
-			}
 
-			// Min data
-			if (data < min)
+			// now do the raw data analysis for the frame ... the data is all loaded so read it directly
+			float max = -100.0;
+			float min = 100.0;
+			float spread = -100;
+			long offset = (long)i * samplesperframe;
+			for (int j = 0; j < samplesperframe; j++, offset++)
 			{
-				min = data;
+				float data = offset > _trackSize ? 0 : _data[0][offset];
+				max = std::max(max, data);
+				min = std::min(min, data);
+				spread = std::max(spread, max - min);
 			}
 
-			// Spread data
-			if (max - min > spread)
-			{
-				spread = max - min;
-			}
+			maxs[i] = max;
+			mins[i] = min;
+			spreads[i] = spread;
+			bigmax = std::max(bigmax, max);
+			bigmin = std::min(bigmin, min);
+			bigspread = std::max(bigspread, spread);
 		}
 
-		if (max > _bigmax)
-		{
-			_bigmax = max;
-		}
-		if (min < _bigmin)
-		{
-			_bigmin = min;
-		}
-		if (spread > _bigspread)
+		std::unique_lock<std::mutex> locker(bigLock);
+		_bigmax = std::max(_bigmax, bigmax);
+		_bigmin = std::min(_bigmin, bigmin);
+		_bigspread = std::max(_bigspread, bigspread);
+		_bigspectogrammax = std::max(_bigspectogrammax, bigspectrogrammax);
+	}, 16);
+
+	// Now save the results for each frame
+	for (int i = FRAMEDATA_HIGH; i <= FRAMEDATA_VU; i++)
+	{
+		_frameData[i].Clear();
+		_frameData[i].Reserve(frames, i == FRAMEDATA_VU ? 127 : 1);
+	}
+	static const std::vector<float> nospectrogram;
+	int spectrogramFrame = -1;
+	for (int i = 0; i < frames; i++)
+	{
+		// frames no block starts in keep the spectrogram of the frame before
+		if (hasBlock[i])
 		{
-			_bigspread = spread;
+			spectrogramFrame = i;
 		}
-
-		// Now save the results for the frame
-		std::list<float> maxlist;
-		maxlist.push_back(max);
-		std::list<float> minlist;
-		minlist.push_back(min);
-		std::list<float> spreadlist;
-		spreadlist.push_back(spread);
-		aFrameData[0] = maxlist;
-		aFrameData[1] = minlist;
-		aFrameData[2] = spreadlist;
-		aFrameData[3] = spectrogram;
-
-		_frameData.push_back(aFrameData);
+		_frameData[FRAMEDATA_HIGH].AddFrame(&maxs[i], 1);
+		_frameData[FRAMEDATA_LOW].AddFrame(&mins[i], 1);
+		_frameData[FRAMEDATA_SPREAD].AddFrame(&spreads[i], 1);
+		_frameData[FRAMEDATA_VU].AddFrame(spectrogramFrame < 0 ? nospectrogram : spectrograms[spectrogramFrame]);
 	}
 
 	// normalise data ... basically scale the data so the highest value is the scale value.
@@ -1620,27 +1817,19 @@ void AudioManager::DoPrepareFrameData()
 	float bigminscale = 1 / (_bigmin * scale);
 	float bigspreadscale = 1 / (_bigspread * scale);
 	float bigspectrogramscale = 1 / (_bigspectogrammax * scale);
-	for (std::vector<std::vector<std::list<float>>>::iterator itframe = _frameData.begin(); itframe != _frameData.end(); ++itframe)
+	float scales[] = { bigmaxscale, bigminscale, bigspreadscale, bigspectrogramscale };
+	for (int i = FRAMEDATA_HIGH; i <= FRAMEDATA_VU; i++)
 	{
-		std::list<float>* fl = &(*itframe)[0];
-		std::list<float>::iterator f = fl->begin();
-		*f = (*f * bigmaxscale);
-
-		fl = &(*itframe)[1];
-		f = fl->begin();
-		*f = (*f * bigminscale);
-
-		fl = &(*itframe)[2];
-		f = fl->begin();
-		*f = (*f * bigspreadscale);
-
-		fl = &(*itframe)[3];
-		for (std::list<float>::iterator ff = fl->begin(); ff != fl->end(); ++ff)
+		float* f = _frameData[i].GetValues();
+		float* end = f + _frameData[i].GetValueCount();
+		for (; f != end; ++f)
 		{
-			*ff = *ff * bigspectrogramscale;
+			*f = *f * scales[i];
 		}
 	}
 
+	SaveFrameDataCache(cacheFile, FRAMEDATA_HIGH, FRAMEDATA_VU);
+
 	// flag the fact that the data is all ready
 	_frameDataPrepared = true;
 
@@ -1691,10 +1880,10 @@ void ProgressFunction(wxProgressDialog* pd, int p)
 }
 
 // Get the pre-prepared data for this frame
-std::list<float>* AudioManager::GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing)
+FrameDataSpan AudioManager::GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing)
 {
     log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    std::list<float>* rc = nullptr;
+    FrameDataSpan rc;
 
     // Grab the lock so we can safely access the frame data
     std::shared_lock<std::shared_timed_mutex> lock(_mutex);
@@ -1725,50 +1914,16 @@ std::list<float>* AudioManager::GetFrameData(int frame, FRAMEDATATYPE fdt, std::
         DoPolyphonicTranscription(&dlg, ProgressFunction);
     }
 
-    // now we can grab the data we need
-    try
-    {
-        if (frame < (int)_frameData.size())
-        {
-            std::vector<std::list<float>>* framedata = &_frameData[frame];
-
-            if (framedata == nullptr)
-            {
-                logger_base.crit("AudioManager::GetFrameData framedata is nullptr ... this is going to crash.");
-            }
-
-            switch (fdt)
-            {
-            case FRAMEDATA_HIGH:
-                rc = &framedata->at(0);
-                break;
-            case FRAMEDATA_LOW:
-                rc = &framedata->at(1);
-                break;
-            case FRAMEDATA_SPREAD:
-                rc = &framedata->at(2);
-                break;
-            case FRAMEDATA_VU:
-                rc = &framedata->at(3);
-                break;
-            case FRAMEDATA_ISTIMINGMARK:
-                // we dont need to do anything here
-                break;
-            case FRAMEDATA_NOTES:
-                rc = &framedata->at(4);
-                break;
-            }
-        }
-    }
-    catch (...)
+    // now we can grab the data we need ... timing marks have no data so their store is always empty
+    if (frame >= 0)
     {
-        rc = nullptr;
+        rc = _frameData[fdt].GetFrame(frame);
     }
 
     return rc;
 }
 
-std::list<float>* AudioManager::GetFrameData(FRAMEDATATYPE fdt, std::string timing, long ms)
+FrameDataSpan AudioManager::GetFrameData(FRAMEDATATYPE fdt, std::string timing, long ms)
 {
     int frame = ms / _intervalMS;
     return GetFrameData(frame, fdt, timing);
@@ -2694,22 +2849,24 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
                 fad->data = (float*)malloc(sizeof(float) * _trackSize);
                 fad->pcmdata = (int16_t*)malloc(_pcmdatasize + PCMFUDGE);
                 
-                for (int i = 0; i < _trackSize; ++i) {
-                    float v = _data[0][i];
-                    if (_data[1]) {
-                        float v1 = _data[1][i];
-                        v = (v - v1);
-                    }
-                    fad->data[i] = v;
-                                     
-                    v = v * 32768;
-                    int v2 = (int)v;
-                    fad->pcmdata[i * _channels] = v2;
-                    if (_channels > 1)
-                    {
-                        fad->pcmdata[i * _channels + 1] = v2;
+                parallel_for_range(0, _trackSize, [fad, this](int s, int e) {
+                    for (int i = s; i < e; ++i) {
+                        float v = _data[0][i];
+                        if (_data[1]) {
+                            float v1 = _data[1][i];
+                            v = (v - v1);
+                        }
+                        fad->data[i] = v;
+
+                        v = v * 32768;
+                        int v2 = (int)v;
+                        fad->pcmdata[i * _channels] = v2;
+                        if (_channels > 1)
+                        {
+                            fad->pcmdata[i * _channels + 1] = v2;
+                        }
                     }
-                }
+                }, 4096);
                 fad->lowNote = 0;
                 fad->highNote = 0;
                 fad->type = type;
@@ -2763,35 +2920,41 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
                 }
             }
             //Now apply a windowing function to taper the edges of the filter, e.g.
-            parallel_for(0, _trackSize, [fad, this, a, order](int i) {
-                float lvalue = 0;
-                float rvalue = 0;
-                for (int j = 0; j < order; j++) {
-                    int jj = i + j - order;
-                    if (jj >= 0 && jj < _trackSize) {
-                        lvalue += _data[0][jj] * a[order - j - 1];
-                        if (_data[1]) {
-                            rvalue += _data[1][jj] * a[order - j - 1];
-                        }
+            parallel_for_range(0, _trackSize, [fad, this, a, order](int s, int e) {
+                for (int i = s; i < e; i++) {
+                    // only the part of the filter which overlaps the track so the inner loops have no branches
+                    int jstart = std::max(0, order - i);
+                    int jend = std::min(order, (int)_trackSize + order - i);
+                    int offset = i - order;
+
+                    float lvalue = 0;
+                    float rvalue = 0;
+                    for (int j = jstart; j < jend; j++) {
+                        lvalue += _data[0][offset + j] * a[order - j - 1];
                     }
-                }
-                fad->data[i] = lvalue;
-                
-                lvalue = lvalue * 32768;
-                int v2 = (int)lvalue;
-                fad->pcmdata[i * _channels] = v2;
-                if (_channels > 1)
-                {
                     if (_data[1]) {
-                        rvalue = rvalue * 32768;
-                        v2 = (int)rvalue;
-                        fad->pcmdata[i * _channels + 1] = v2;
+                        for (int j = jstart; j < jend; j++) {
+                            rvalue += _data[1][offset + j] * a[order - j - 1];
+                        }
                     }
-                    else {
-                        fad->pcmdata[i * _channels + 1] = v2;
+                    fad->data[i] = lvalue;
+
+                    lvalue = lvalue * 32768;
+                    int v2 = (int)lvalue;
+                    fad->pcmdata[i * _channels] = v2;
+                    if (_channels > 1)
+                    {
+                        if (_data[1]) {
+                            rvalue = rvalue * 32768;
+                            v2 = (int)rvalue;
+                            fad->pcmdata[i * _channels + 1] = v2;
+                        }
+                        else {
+                            fad->pcmdata[i * _channels + 1] = v2;
+                        }
                     }
                 }
-            });
+            }, 1024);
 
             fad->lowNote = lowNote;
             fad->highNote = highNote;
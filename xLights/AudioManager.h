@@ -3,6 +3,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 #include <shared_mutex>
 
 extern "C"
@@ -24,6 +25,7 @@ extern "C"
 #include <wx/progdlg.h>
 
 class AudioManager;
+class wxFile;
 
 enum class AUDIOSAMPLETYPE
 {
@@ -70,6 +72,47 @@ typedef enum FRAMEDATATYPE {
 	FRAMEDATA_NOTES
 } FRAMEDATATYPE;
 
+// A read only view of the values held for one frame. It stays valid until the audio manager is deleted.
+class FrameDataSpan
+{
+    const float* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    FrameDataSpan() {}
+    FrameDataSpan(const float* data, size_t size) : _data(data), _size(size) {}
+    const float* begin() const { return _data; }
+    const float* end() const { return _data + _size; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    float front() const { return _data[0]; }
+    float operator[](size_t index) const { return _data[index]; }
+};
+
+// The values for every frame of one frame data type stored back to back in a single array with the offset
+// each frame starts at so reading a frame is one contiguous walk rather than a list traversal
+class FrameDataStore
+{
+    std::vector<float> _values;
+    std::vector<size_t> _offsets = { 0 };
+
+public:
+    void Clear() { _values.clear(); _offsets.assign(1, 0); }
+    void Reserve(size_t frames, size_t valuesPerFrame) { _values.reserve(frames * valuesPerFrame); _offsets.reserve(frames + 1); }
+    void AddFrame(const float* values, size_t count) { _values.insert(_values.end(), values, values + count); _offsets.push_back(_values.size()); }
+    void AddFrame(const std::vector<float>& values) { AddFrame(values.data(), values.size()); }
+    size_t GetFrameCount() const { return _offsets.size() - 1; }
+    FrameDataSpan GetFrame(size_t frame) const
+    {
+        if (frame >= GetFrameCount()) return FrameDataSpan();
+        return FrameDataSpan(_values.data() + _offsets[frame], _offsets[frame + 1] - _offsets[frame]);
+    }
+    float* GetValues() { return _values.data(); }
+    size_t GetValueCount() const { return _values.size(); }
+    bool Read(wxFile& file);
+    bool Write(wxFile& file) const;
+};
+
 typedef enum MEDIAPLAYINGSTATE {
 	PLAYING,
 	PAUSED,
@@ -183,7 +226,7 @@ class AudioManager
     Job* _jobAudioLoad = nullptr;
     std::shared_timed_mutex _mutexAudioLoad;
     long _loadedData = 0;
-    std::vector<std::vector<std::list<float>>> _frameData;
+    FrameDataStore _frameData[FRAMEDATA_NOTES + 1]; // indexed by FRAMEDATATYPE
 	std::string _audio_file;
 	xLightsVamp _vamp;
 	long _rate = 44100;
@@ -224,7 +267,10 @@ class AudioManager
     static int decodebitrateindex(int bitrateindex, int version, int layertype);
 	int decodesamplerateindex(int samplerateindex, int version) const;
     static int decodesideinfosize(int version, int mono);
-	std::list<float> CalculateSpectrumAnalysis(const float* in, int n, float& max, int id) const;
+    int GetFrameCount() const;
+    std::string GetFrameDataCacheFile(const std::string& extension);
+    bool LoadFrameDataCache(const std::string& file, int frames, FRAMEDATATYPE first, FRAMEDATATYPE last);
+    void SaveFrameDataCache(const std::string& file, FRAMEDATATYPE first, FRAMEDATATYPE last);
     void LoadAudioData(bool separateThread, AVFormatContext* formatContext, AVCodecContext* codecContext, AVStream* audioStream, AVFrame* frame);
     void SetLoadedData(long pos);
 
@@ -254,6 +300,7 @@ public:
     static int GetGlobalVolume();
     static void SetAudioDevice(const std::string device);
     static std::list<std::string> GetAudioDevices();
+    static void SetFrameDataCacheFolder(const std::string& folder);
     long GetTrackSize() const { return _trackSize; };
 	long GetRate() const { return _rate; };
 	int GetChannels() const { return _channels; };
@@ -274,8 +321,8 @@ public:
 	void SetStepBlock(int step, int block);
 	void SetFrameInterval(int intervalMS);
 	int GetFrameInterval() const { return _intervalMS; }
-	std::list<float>* GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing);
-	std::list<float>* GetFrameData(FRAMEDATATYPE fdt, std::string timing, long ms);
+	FrameDataSpan GetFrameData(int frame, FRAMEDATATYPE fdt, std::string timing);
+	FrameDataSpan GetFrameData(FRAMEDATATYPE fdt, std::string timing, long ms);
 	void DoPrepareFrameData();
 	void DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManagerProgressCallback progresscallback);
 	bool IsPolyphonicTranscriptionDone() const { return _polyphonicTranscriptionDone; };
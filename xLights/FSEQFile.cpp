@@ -5,7 +5,11 @@
 
 #include <vector>
 #include <cstring>
+#include <algorithm>
 #include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 
 #include <stdio.h>
 #include <inttypes.h>
@@ -91,6 +95,10 @@ template<typename... Args> static void LogDebug(int i, const char *fmt, Args...
 }
 #define VB_SEQUENCE 1
 #define VB_ALL 0
+
+//within xLights/xSchedule compression blocks can be encoded on the shared job pool
+#include "Parallel.h"
+#define FSEQ_HAVE_JOBPOOL
 #endif
 
 
@@ -611,6 +619,8 @@ uint32_t V1FSEQFile::getMaxChannel() const {
 }
 
 static const int V2FSEQ_HEADER_SIZE = 32;
+//the range block index lives in a variable header so it needs to stay well under 64K
+static const int V2FSEQ_MAX_RANGE_BLOCKS = 4096;
 #if !defined(NO_ZLIB) || !defined(NO_ZSTD)
 static const int V2FSEQ_OUT_BUFFER_SIZE = 1024*1024; //1M output buffer
 static const int V2FSEQ_OUT_BUFFER_FLUSH_SIZE = 900 * 1024; //90% full, flush it
@@ -633,6 +643,8 @@ public:
     virtual void addFrame(uint32_t frame, const uint8_t *data) = 0;
     virtual void finalize() = 0;
     virtual std::string GetType() const = 0;
+    //called when the ranges to read change
+    virtual void prepareRead() {}
 
     int seek(uint64_t location, int origin) {
         return m_file->seek(location, origin);
@@ -799,11 +811,97 @@ public:
 };
 
 #ifndef NO_ZSTD
+//A block of frames that is compressed independently of the others so blocks
+//can be compressed concurrently and then written out in order
+class V2ZSTDCompressionBlock {
+public:
+    V2ZSTDCompressionBlock(uint32_t frame, int level, std::mutex &l, std::condition_variable &s)
+        : startFrame(frame), clevel(level), channels(0), ranges(nullptr), done(false), lock(l), signal(s) {}
+
+    void compress() {
+        std::vector<uint8_t> out;
+        if (ranges == nullptr || ranges->empty()) {
+            out.resize(ZSTD_compressBound(raw.size()));
+            size_t sz = ZSTD_compress(out.data(), out.size(), raw.data(), raw.size(), clevel);
+            if (ZSTD_isError(sz)) {
+                LogErr(VB_SEQUENCE, "Failed to compress block starting at frame %d: %s\n", startFrame, ZSTD_getErrorName(sz));
+                sz = 0;
+            }
+            out.resize(sz);
+        } else {
+            compressRanges(out);
+        }
+        std::vector<uint8_t>().swap(raw);
+
+        std::unique_lock<std::mutex> l(lock);
+        compressed.swap(out);
+        done = true;
+        signal.notify_all();
+    }
+
+    //Block layout is a 4 byte compressed length per range followed by a zstd frame
+    //per range holding that ranges channels for every frame in the block
+    void compressRanges(std::vector<uint8_t> &out) {
+        uint32_t frames = channels ? raw.size() / channels : 0;
+        size_t bound = ranges->size() * 4;
+        for (auto &r : *ranges) {
+            bound += ZSTD_compressBound((size_t)frames * r.second);
+        }
+        out.resize(bound);
+
+        ZSTD_CCtx *cctx = ZSTD_createCCtx();
+        std::vector<uint8_t> rangeData;
+        size_t pos = ranges->size() * 4;
+        for (int x = 0; x < ranges->size(); x++) {
+            const auto &r = (*ranges)[x];
+            rangeData.resize((size_t)frames * r.second);
+            for (uint32_t f = 0; f < frames; f++) {
+                memcpy(&rangeData[(size_t)f * r.second], &raw[(size_t)f * channels + r.first], r.second);
+            }
+            size_t sz = ZSTD_compressCCtx(cctx, &out[pos], out.size() - pos, rangeData.data(), rangeData.size(), clevel);
+            if (ZSTD_isError(sz)) {
+                LogErr(VB_SEQUENCE, "Failed to compress range %d-%d of block starting at frame %d: %s\n",
+                       r.first, r.first + r.second - 1, startFrame, ZSTD_getErrorName(sz));
+                sz = 0;
+            }
+            write4ByteUInt(&out[x * 4], sz);
+            pos += sz;
+        }
+        ZSTD_freeCCtx(cctx);
+        out.resize(pos);
+    }
+
+    uint32_t startFrame;
+    int clevel;
+    uint32_t channels;
+    const std::vector<std::pair<uint32_t, uint32_t>> *ranges;
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> compressed;
+    bool done;
+    std::mutex &lock;
+    std::condition_variable &signal;
+};
+
+#ifdef FSEQ_HAVE_JOBPOOL
+class V2ZSTDCompressionJob : public Job {
+public:
+    V2ZSTDCompressionJob(V2ZSTDCompressionBlock *b) : Job(), block(b) {}
+    virtual ~V2ZSTDCompressionJob() {}
+    virtual void Process() override { block->compress(); }
+    virtual bool DeleteWhenComplete() override { return true; }
+    virtual bool SetThreadName() override { return false; }
+
+    V2ZSTDCompressionBlock *block;
+};
+#endif
+
 class V2ZSTDCompressionHandler : public V2CompressedHandler {
 public:
     V2ZSTDCompressionHandler(V2FSEQFile *f) : V2CompressedHandler(f),
-    m_cctx(nullptr),
-    m_dctx(nullptr)
+    m_dctx(nullptr),
+    m_rangeDCtx(nullptr),
+    m_block(nullptr),
+    m_maxInFlight(1)
     {
         m_outBuffer.pos = 0;
         m_outBuffer.size = V2FSEQ_OUT_BUFFER_SIZE;
@@ -814,20 +912,32 @@ public:
         LogDebug(VB_SEQUENCE, "  Prepared to read/write a ZSTD compress fseq file.\n");
     }
     virtual ~V2ZSTDCompressionHandler() {
+        //blocks still being compressed reference our lock
+        waitForBlocks(0);
+        if (m_block) {
+            delete m_block;
+        }
         free(m_outBuffer.dst);
         if (m_inBuffer.src != nullptr) {
             free((void*)m_inBuffer.src);
         }
-        if (m_cctx) {
-            ZSTD_freeCStream(m_cctx);
-        }
         if (m_dctx) {
             ZSTD_freeDStream(m_dctx);
         }
+        if (m_rangeDCtx) {
+            ZSTD_freeDCtx(m_rangeDCtx);
+        }
     }
     virtual uint8_t getCompressionType() override { return 1;}
     virtual std::string GetType() const override { return "Compressed ZSTD"; }
 
+    virtual void prepareRead() override {
+        if (!m_file->m_rangeBlocks.empty()) {
+            //the decoded ranges depend on what is being read so reload the block
+            m_curBlock = 99999;
+        }
+    }
+
     virtual FrameData *getFrame(uint32_t frame) override {
         if (m_curBlock > 256 || (frame < m_file->m_frameOffsets[m_curBlock].first) || (frame >= m_file->m_frameOffsets[m_curBlock + 1].first)) {
             //frame is not in the current block
@@ -843,7 +953,7 @@ public:
 
             uint64_t len = m_file->m_frameOffsets[m_curBlock + 1].second;
             len -= m_file->m_frameOffsets[m_curBlock].second;
-            int max = m_file->getNumFrames() * m_file->getChannelCount();
+            uint64_t max = (uint64_t)m_file->getNumFrames() * m_file->getChannelCount() + m_file->m_rangeBlocks.size() * 4;
             if (len > max) {
                 len = max;
             }
@@ -865,14 +975,21 @@ public:
                 preload(tell(), len2);
             }
 
-            free(m_outBuffer.dst);
             m_framesPerBlock = (m_file->m_frameOffsets[m_curBlock + 1].first > m_file->getNumFrames() ? m_file->getNumFrames() :  m_file->m_frameOffsets[m_curBlock + 1].first) - m_file->m_frameOffsets[m_curBlock].first;
-            m_outBuffer.size = m_framesPerBlock * m_file->getChannelCount();
-            m_outBuffer.dst = malloc(m_outBuffer.size);
-            m_outBuffer.pos = 0;
             m_curFrameInBlock = 0;
+            if (!m_file->m_rangeBlocks.empty()) {
+                decompressRanges();
+            } else {
+                free(m_outBuffer.dst);
+                m_outBuffer.size = m_framesPerBlock * m_file->getChannelCount();
+                m_outBuffer.dst = malloc(m_outBuffer.size);
+                m_outBuffer.pos = 0;
+            }
         }
         int fidx = frame - m_file->m_frameOffsets[m_curBlock].first;
+        if (!m_file->m_rangeBlocks.empty()) {
+            return getRangesFrame(frame, fidx);
+        }
 
         if (fidx >= m_curFrameInBlock) {
             m_outBuffer.size = (fidx + 1) * m_file->getChannelCount();
@@ -907,34 +1024,8 @@ public:
         }
         return data;
     }
-    void compressData(ZSTD_CStream* m_cctx, ZSTD_inBuffer_s &input, ZSTD_outBuffer_s &output) {
-        ZSTD_compressStream(m_cctx, &output, &input);
-        int count = input.pos;
-        int total = input.size;
-        uint8_t *curData = (uint8_t*)input.src;
-        while (count < total) {
-            count += input.pos;
-            curData += input.pos;
-            input.src = curData;
-            input.size -= input.pos;
-            input.pos = 0;
-            if (output.pos) {
-                write(output.dst, output.pos);
-                output.pos = 0;
-            }
-            ZSTD_compressStream(m_cctx, &output, &input);
-            count += input.pos;
-        }
-    }
     virtual void addFrame(uint32_t frame, const uint8_t *data) override {
-
-        if (m_cctx == nullptr) {
-            m_cctx = ZSTD_createCStream();
-        }
         if (m_curFrameInBlock == 0) {
-            uint64_t offset = tell();
-            //LogDebug(VB_SEQUENCE, "  Preparing to create a compressed block of data starting at frame %d, offset  %" PRIu64 ".\n", frame, offset);
-            m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(frame, offset));
             int clevel = m_file->m_compressionLevel == -99 ? 10 : m_file->m_compressionLevel;
             if (clevel < -25 || clevel > 25) {
                 clevel = 10;
@@ -950,70 +1041,192 @@ public:
             if (ZSTD_versionNumber() <= 10305 && clevel < 0) {
                 clevel = 0;
             }
-            ZSTD_initCStream(m_cctx, clevel);
+            m_block = new V2ZSTDCompressionBlock(frame, clevel, m_blockLock, m_blockSignal);
+            m_block->channels = m_file->getChannelCount();
+            m_block->ranges = &m_file->m_rangeBlocks;
+            uint32_t frames = m_curBlock == 0 ? 10 : std::max(m_framesPerBlock, (uint32_t)1);
+            m_block->raw.reserve((uint64_t)frames * m_file->getChannelCount());
         }
 
-        uint8_t *curData = (uint8_t *)data;
         if (m_file->m_sparseRanges.empty()) {
-            ZSTD_inBuffer_s input = {
-                curData,
-                m_file->getChannelCount(),
-                0
-            };
-            compressData(m_cctx, input, m_outBuffer);
+            m_block->raw.insert(m_block->raw.end(), data, data + m_file->getChannelCount());
         } else {
             for (auto &a : m_file->m_sparseRanges) {
-                ZSTD_inBuffer_s input = {
-                    &curData[a.first],
-                    a.second,
-                    0
-                };
-                compressData(m_cctx, input, m_outBuffer);
+                m_block->raw.insert(m_block->raw.end(), &data[a.first], &data[a.first + a.second]);
             }
         }
 
-        if (m_outBuffer.pos > V2FSEQ_OUT_BUFFER_FLUSH_SIZE) {
-            //buffer is getting full, better flush it
-            write(m_outBuffer.dst, m_outBuffer.pos);
-            m_outBuffer.pos = 0;
-        }
-
         m_curFrameInBlock++;
         //if we hit the max per block OR we're in the first block and hit frame #10
         //we'll start a new block.  We want the first block to be small so startup is
         //quicker and we can get the first few frames as fast as possible.
         if ((m_curBlock == 0 && m_curFrameInBlock == 10)
-            || (m_curFrameInBlock >= m_framesPerBlock && m_file->m_frameOffsets.size() < m_maxBlocks)) {
-            while(ZSTD_endStream(m_cctx, &m_outBuffer) > 0) {
-                write(m_outBuffer.dst, m_outBuffer.pos);
-                m_outBuffer.pos = 0;
-            }
-            write(m_outBuffer.dst, m_outBuffer.pos);
-            //LogDebug(VB_SEQUENCE, "  Finalized block of data ending at frame %d.  Frames in block: %d.\n", frame, m_curFrameInBlock);
-            m_outBuffer.pos = 0;
-            m_curFrameInBlock = 0;
-            m_curBlock++;
+            || (m_curFrameInBlock >= m_framesPerBlock && (m_curBlock + 1) < m_maxBlocks)) {
+            submitBlock();
         }
     }
     virtual void finalize() override {
         if (m_curFrameInBlock) {
-            while(ZSTD_endStream(m_cctx, &m_outBuffer) > 0) {
-                write(m_outBuffer.dst, m_outBuffer.pos);
-                m_outBuffer.pos = 0;
-            }
-            write(m_outBuffer.dst, m_outBuffer.pos);
             LogDebug(VB_SEQUENCE, "  Finalized last block of data.  Frames in block: %d.\n", m_curFrameInBlock);
-            m_outBuffer.pos = 0;
-            m_curFrameInBlock = 0;
-            m_curBlock++;
+            submitBlock();
         }
+        waitForBlocks(0);
         V2CompressedHandler::finalize();
     }
 
-    ZSTD_CStream* m_cctx;
+    void submitBlock() {
+        V2ZSTDCompressionBlock *block = m_block;
+        m_block = nullptr;
+        m_curFrameInBlock = 0;
+        m_curBlock++;
+#ifdef FSEQ_HAVE_JOBPOOL
+        //bound the memory held by blocks waiting to be compressed/written
+        uint64_t blockSize = std::max(block->raw.size(), (size_t)1);
+        m_maxInFlight = std::min((uint64_t)ParallelJobPool::POOL.maxSize(), (uint64_t)(256 * 1024 * 1024) / blockSize);
+        m_maxInFlight = std::max(m_maxInFlight, (uint64_t)1);
+#endif
+        {
+            std::unique_lock<std::mutex> l(m_blockLock);
+            m_pendingBlocks.push_back(block);
+        }
+#ifdef FSEQ_HAVE_JOBPOOL
+        ParallelJobPool::POOL.PushJob(new V2ZSTDCompressionJob(block));
+#else
+        block->compress();
+#endif
+        waitForBlocks(m_maxInFlight);
+    }
+
+    //write out the completed blocks in order, waiting until no more than maxPending are outstanding
+    void waitForBlocks(size_t maxPending) {
+        std::unique_lock<std::mutex> l(m_blockLock);
+        while (!m_pendingBlocks.empty()) {
+            V2ZSTDCompressionBlock *block = m_pendingBlocks.front();
+            if (!block->done) {
+                if (m_pendingBlocks.size() <= maxPending) {
+                    return;
+                }
+                m_blockSignal.wait(l);
+                continue;
+            }
+            m_pendingBlocks.pop_front();
+            l.unlock();
+
+            uint64_t offset = tell();
+            //LogDebug(VB_SEQUENCE, "  Writing compressed block of data starting at frame %d, offset  %" PRIu64 ".\n", block->startFrame, offset);
+            m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(block->startFrame, offset));
+            if (!block->compressed.empty()) {
+                write(&block->compressed[0], block->compressed.size());
+            }
+            delete block;
+
+            l.lock();
+        }
+    }
+
+    //the ranges of the stored frame that the caller asked for
+    std::vector<std::pair<uint32_t, uint32_t>> getStoredRangesToRead() const {
+        if (!m_file->m_sparseRanges.empty()) {
+            //sparse files are always read as the whole stored frame
+            return { { 0, m_file->getChannelCount() } };
+        }
+        return m_file->m_rangesToRead;
+    }
+
+    //decompress only the range blocks that overlap the ranges being read
+    void decompressRanges() {
+        const auto &blocks = m_file->m_rangeBlocks;
+        const uint8_t *src = (const uint8_t*)m_inBuffer.src;
+        std::vector<std::pair<uint32_t, uint32_t>> toRead = getStoredRangesToRead();
+
+        m_rangeDataOffsets.assign(blocks.size(), -1);
+        uint64_t outSize = 0;
+        for (int x = 0; x < blocks.size(); x++) {
+            for (auto &rng : toRead) {
+                if (rng.first < blocks[x].first + blocks[x].second && blocks[x].first < rng.first + rng.second) {
+                    m_rangeDataOffsets[x] = outSize;
+                    outSize += (uint64_t)m_framesPerBlock * blocks[x].second;
+                    break;
+                }
+            }
+        }
+        m_rangeData.resize(outSize);
+
+        uint64_t inOffset = blocks.size() * 4;
+        if (m_inBuffer.size < inOffset) {
+            LogErr(VB_SEQUENCE, "Compressed block %d is too small to hold its range index.\n", m_curBlock);
+            std::fill(m_rangeData.begin(), m_rangeData.end(), 0);
+            return;
+        }
+        if (m_rangeDCtx == nullptr) {
+            m_rangeDCtx = ZSTD_createDCtx();
+        }
+        for (int x = 0; x < blocks.size(); x++) {
+            uint32_t clen = read4ByteUInt(&src[x * 4]);
+            if (m_rangeDataOffsets[x] >= 0) {
+                uint8_t *dst = &m_rangeData[m_rangeDataOffsets[x]];
+                size_t dlen = (size_t)m_framesPerBlock * blocks[x].second;
+                size_t sz = 0;
+                if (inOffset + clen <= m_inBuffer.size) {
+                    sz = ZSTD_decompressDCtx(m_rangeDCtx, dst, dlen, &src[inOffset], clen);
+                }
+                if (inOffset + clen > m_inBuffer.size || ZSTD_isError(sz)) {
+                    LogErr(VB_SEQUENCE, "Failed to decompress range %d of compressed block %d.\n", x, m_curBlock);
+                    sz = 0;
+                }
+                if (sz < dlen) {
+                    memset(&dst[sz], 0, dlen - sz);
+                }
+            }
+            inOffset += clen;
+        }
+    }
+
+    FrameData *getRangesFrame(uint32_t frame, int fidx) {
+        const auto &blocks = m_file->m_rangeBlocks;
+        UncompressedFrameData *data = new UncompressedFrameData(frame, m_file->m_dataBlockSize, m_file->m_rangesToRead);
+        if (fidx < 0 || fidx >= m_framesPerBlock) {
+            LogErr(VB_SEQUENCE, "Frame %d is not in compressed block %d.\n", (int)frame, m_curBlock);
+            memset(data->m_data, 0, data->m_size);
+            return data;
+        }
+        memset(data->m_data, 0, data->m_size);
+
+        uint32_t sz = 0;
+        for (auto &rng : getStoredRangesToRead()) {
+            uint32_t rngEnd = rng.first + rng.second;
+            //range blocks are sorted and contiguous so find the first one that holds the start
+            auto it = std::upper_bound(blocks.begin(), blocks.end(), rng.first,
+                                       [](uint32_t ch, const std::pair<uint32_t, uint32_t> &b) { return ch < b.first; });
+            int x = it == blocks.begin() ? 0 : (it - blocks.begin()) - 1;
+            for (; x < blocks.size() && blocks[x].first < rngEnd; x++) {
+                uint32_t start = std::max(rng.first, blocks[x].first);
+                uint32_t end = std::min(rngEnd, blocks[x].first + blocks[x].second);
+                if (start >= end || m_rangeDataOffsets[x] < 0) {
+                    continue;
+                }
+                uint64_t src = m_rangeDataOffsets[x] + (uint64_t)fidx * blocks[x].second + (start - blocks[x].first);
+                memcpy(&data->m_data[sz + start - rng.first], &m_rangeData[src], end - start);
+            }
+            sz += rng.second;
+        }
+        return data;
+    }
+
     ZSTD_DStream* m_dctx;
     ZSTD_outBuffer_s m_outBuffer;
     ZSTD_inBuffer_s m_inBuffer;
+
+    //decompressed range blocks for the current block, -1 for ranges that were not needed
+    ZSTD_DCtx* m_rangeDCtx;
+    std::vector<uint8_t> m_rangeData;
+    std::vector<int64_t> m_rangeDataOffsets;
+
+    V2ZSTDCompressionBlock *m_block;
+    std::deque<V2ZSTDCompressionBlock*> m_pendingBlocks;
+    std::mutex m_blockLock;
+    std::condition_variable m_blockSignal;
+    uint64_t m_maxInFlight;
 };
 #endif
 
@@ -1250,6 +1463,15 @@ void V2FSEQFile::writeHeader() {
             }
         }
     }
+    if (!m_rangeBlocks.empty()) {
+        if (m_handler->getCompressionType() == 1) {
+            normalizeRangeBlocks();
+        } else {
+            LogDebug(VB_SEQUENCE, "Range blocks are only supported for zstd compression, ignoring them.\n");
+            m_rangeBlocks.clear();
+        }
+    }
+    m_seqVersionMinor = m_rangeBlocks.empty() ? 0 : 1;
 
     uint8_t header[V2FSEQ_HEADER_SIZE];
     memset(header, 0, V2FSEQ_HEADER_SIZE);
@@ -1258,7 +1480,7 @@ void V2FSEQFile::writeHeader() {
     header[2] = 'E';
     header[3] = 'Q';
 
-    header[6] = 0; //minor
+    header[6] = m_seqVersionMinor; //minor
     header[7] = 2; //major
 
     // Step Size
@@ -1299,6 +1521,9 @@ void V2FSEQFile::writeHeader() {
     for (auto &a : m_variableHeaders) {
         dataOffset += a.data.size() + 4;
     }
+    if (!m_rangeBlocks.empty()) {
+        dataOffset += m_rangeBlocks.size() * 8 + 4;
+    }
     dataOffset = roundTo4(dataOffset);
     write2ByteUInt(&header[4], dataOffset);
     m_seqChanDataOffset = dataOffset;
@@ -1324,6 +1549,17 @@ void V2FSEQFile::writeHeader() {
         write(buf, 4);
         write(&a.data[0], a.data.size());
     }
+    if (!m_rangeBlocks.empty()) {
+        std::vector<uint8_t> buf(m_rangeBlocks.size() * 8 + 4);
+        write2ByteUInt(&buf[0], buf.size());
+        buf[2] = 'r';
+        buf[3] = 'b';
+        for (int x = 0; x < m_rangeBlocks.size(); x++) {
+            write4ByteUInt(&buf[4 + x * 8], m_rangeBlocks[x].first);
+            write4ByteUInt(&buf[8 + x * 8], m_rangeBlocks[x].second);
+        }
+        write(&buf[0], buf.size());
+    }
     uint64_t pos = tell();
     if (pos != dataOffset) {
         char buf[4] = {0,0,0,0};
@@ -1333,6 +1569,45 @@ void V2FSEQFile::writeHeader() {
     dumpInfo(true);
 }
 
+//turn the requested range blocks into a sorted partition of the stored frame
+void V2FSEQFile::normalizeRangeBlocks() {
+    std::sort(m_rangeBlocks.begin(), m_rangeBlocks.end());
+    std::vector<std::pair<uint32_t, uint32_t>> blocks;
+    uint32_t cur = 0;
+    for (auto &a : m_rangeBlocks) {
+        uint32_t start = std::max(a.first, cur);
+        uint32_t end = (uint32_t)std::min((uint64_t)a.first + a.second, (uint64_t)m_seqChannelCount);
+        if (start >= end) {
+            continue;
+        }
+        if (start > cur) {
+            //channels nobody listed still need to be stored somewhere
+            blocks.push_back(std::pair<uint32_t, uint32_t>(cur, start - cur));
+        }
+        blocks.push_back(std::pair<uint32_t, uint32_t>(start, end - start));
+        cur = end;
+    }
+    if (!blocks.empty() && cur < m_seqChannelCount) {
+        blocks.push_back(std::pair<uint32_t, uint32_t>(cur, m_seqChannelCount - cur));
+    }
+    while (blocks.size() > V2FSEQ_MAX_RANGE_BLOCKS) {
+        std::vector<std::pair<uint32_t, uint32_t>> merged;
+        for (int x = 0; x < blocks.size(); x += 2) {
+            if (x + 1 < blocks.size()) {
+                merged.push_back(std::pair<uint32_t, uint32_t>(blocks[x].first, blocks[x].second + blocks[x + 1].second));
+            } else {
+                merged.push_back(blocks[x]);
+            }
+        }
+        blocks.swap(merged);
+    }
+    if (blocks.size() < 2) {
+        //a single range is just a normal block
+        blocks.clear();
+    }
+    m_rangeBlocks.swap(blocks);
+}
+
 
 V2FSEQFile::V2FSEQFile(const std::string &fn, FILE *file, const std::vector<uint8_t> &header)
 : FSEQFile(fn, file, header),
@@ -1402,6 +1677,19 @@ m_handler(nullptr)
             m_sparseRanges.push_back(std::pair<uint32_t, uint32_t>(st, len));
         }
         parseVariableHeaders(header, hoffset);
+
+        if (m_seqVersionMinor >= 1 && m_compressionType == CompressionType::zstd) {
+            for (auto it = m_variableHeaders.begin(); it != m_variableHeaders.end(); ++it) {
+                if (it->code[0] == 'r' && it->code[1] == 'b') {
+                    for (int x = 0; x + 8 <= it->data.size(); x += 8) {
+                        m_rangeBlocks.push_back(std::pair<uint32_t, uint32_t>(read4ByteUInt(&it->data[x]), read4ByteUInt(&it->data[x + 4])));
+                    }
+                    //the index describes this files data layout so it must not be copied to other files
+                    m_variableHeaders.erase(it);
+                    break;
+                }
+            }
+        }
     }
 
     createHandler();
@@ -1426,6 +1714,7 @@ void V2FSEQFile::dumpInfo(bool indent) {
     //    LogDebug(VB_SEQUENCE, "%s      %d              : %" PRIu64 "\n", ind, a.first, a.second);
     //}
     LogDebug(VB_SEQUENCE, "%snumRanges             : %d\n", ind, m_sparseRanges.size());
+    LogDebug(VB_SEQUENCE, "%snumRangeBlocks        : %d\n", ind, m_rangeBlocks.size());
     // Commented out to declutter the logs ... we can add it back in if we start seeing issues
     //for (auto &a : m_sparseRanges) {
     //    LogDebug(VB_SEQUENCE, "%s      Start: %d    Len: %d\n", ind, a.first, a.second);
@@ -1467,6 +1756,9 @@ void V2FSEQFile::prepareRead(const std::vector<std::pair<uint32_t, uint32_t>> &r
         m_dataBlockSize = m_seqChannelCount;
         m_rangesToRead = m_sparseRanges;
     }
+    if (m_handler != nullptr) {
+        m_handler->prepareRead();
+    }
     FrameData *f = getFrame(0);
     if (f) {
         delete f;
@@ -182,9 +182,16 @@ public:
     std::vector<std::pair<uint32_t, uint32_t>> m_rangesToRead;
     std::vector<std::pair<uint32_t, uint64_t>> m_frameOffsets;
     uint32_t m_dataBlockSize;
+
+    //V2.1 zstd files can split each compression block into independently compressed
+    //channel ranges so a reader only decompresses the ranges it was asked for.
+    //Offsets are into the stored frame (after any sparse ranges are applied).
+    //Files written with range blocks cannot be read by V2.0 readers.
+    std::vector<std::pair<uint32_t, uint32_t>> m_rangeBlocks;
 private:
     
     void createHandler();
+    void normalizeRangeBlocks();
     
     V2Handler *m_handler;
     friend class V2Handler;
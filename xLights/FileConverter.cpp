@@ -1702,6 +1702,9 @@ void FileConverter::WriteFalconPiFile(ConvertParameters& params)
             ctype = FSEQFile::CompressionType::zlib;
             clevel = 1;
             break;
+        case 5:
+            // zstd, compressed per output so players can decompress just the channels they need
+            break;
         default:
             break;
     }
@@ -1718,6 +1721,11 @@ void FileConverter::WriteFalconPiFile(ConvertParameters& params)
     file->setChannelCount(stepSize);
     file->setStepTime(stepTime);
     file->setNumFrames(params.seq_data.NumFrames());
+    if (fType == 5) {
+        for (const auto& it : params.xLightsFrm->GetOutputManager()->GetOutputs()) {
+            ((V2FSEQFile*)file)->m_rangeBlocks.push_back(std::pair<uint32_t, uint32_t>(it->GetStartChannel() - 1, it->GetChannels()));
+        }
+    }
     if (params.media_filename) {
         if ((*params.media_filename).length() > 0) {
             FSEQFile::VariableHeader header;
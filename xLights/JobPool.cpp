@@ -32,9 +32,109 @@ using namespace TraceLog;
 const std::string Job::EMPTY_STRING = "";
 
 
+// Chase-Lev work stealing deque.  Only the owning worker pushes and pops at the bottom,
+// any thread can steal from the top.  Buffers that are outgrown are kept until the queue
+// is destroyed as a thief may still be reading from them.
+class WorkStealingQueue
+{
+    class Buffer {
+    public:
+        Buffer(int64_t s) : size(s), jobs(new std::atomic<Job*>[s]) {}
+        ~Buffer() { delete [] jobs; }
+
+        Job *Get(int64_t i) const { return jobs[i & (size - 1)].load(std::memory_order_relaxed); }
+        void Put(int64_t i, Job *job) { jobs[i & (size - 1)].store(job, std::memory_order_relaxed); }
+        Buffer *Grow(int64_t top, int64_t bottom) const {
+            Buffer *b = new Buffer(size * 2);
+            for (int64_t i = top; i < bottom; i++) {
+                b->Put(i, Get(i));
+            }
+            return b;
+        }
+
+        const int64_t size;
+        std::atomic<Job*> *jobs;
+    };
+
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+    std::atomic<Buffer*> buffer;
+    std::vector<Buffer*> retired;
+
+public:
+    std::atomic_bool inUse;
+
+    WorkStealingQueue() : top(0), bottom(0), buffer(new Buffer(64)), inUse(false) {}
+    ~WorkStealingQueue() {
+        delete buffer.load();
+        for (auto b : retired) {
+            delete b;
+        }
+    }
+
+    bool Empty() const {
+        return bottom.load() <= top.load();
+    }
+
+    // owner only
+    void Push(Job *job) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Buffer *a = buffer.load(std::memory_order_relaxed);
+        if (b - t > a->size - 1) {
+            Buffer *n = a->Grow(t, b);
+            retired.push_back(a);
+            buffer.store(n, std::memory_order_release);
+            a = n;
+        }
+        a->Put(b, job);
+        bottom.store(b + 1);
+    }
+
+    // owner only
+    Job *Pop() {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Buffer *a = buffer.load(std::memory_order_relaxed);
+        bottom.store(b);
+        int64_t t = top.load();
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job *job = a->Get(b);
+        if (t == b) {
+            // last one, race any thieves for it
+            if (!top.compare_exchange_strong(t, t + 1)) {
+                job = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    // any thread, returns nullptr if empty or another thread got there first
+    Job *Steal() {
+        int64_t t = top.load();
+        int64_t b = bottom.load();
+        if (t >= b) {
+            return nullptr;
+        }
+        Buffer *a = buffer.load(std::memory_order_acquire);
+        Job *job = a->Get(t);
+        if (!top.compare_exchange_strong(t, t + 1)) {
+            return nullptr;
+        }
+        return job;
+    }
+};
+
+
 class JobPoolWorker
 {
+public:
     JobPool *pool;
+    WorkStealingQueue *queue;
+private:
     std::atomic_bool stopped;
     std::atomic<Job  *> currentJob;
     enum STATUS_TYPE {
@@ -62,6 +162,9 @@ public:
     std::string GetThreadName() const;
 };
 
+// the worker running on this thread if any, used so jobs pushed by a job go on the workers own queue
+static thread_local JobPoolWorker *currentWorker = nullptr;
+
 static void startFunc(JobPoolWorker *jpw) {
 #ifdef LINUX
     XInitThreads();
@@ -70,7 +173,7 @@ static void startFunc(JobPoolWorker *jpw) {
     delete jpw;
 }
 JobPoolWorker::JobPoolWorker(JobPool *p)
-: pool(p), stopped(false), currentJob(nullptr), status(STARTING), thread(nullptr)
+: pool(p), queue(nullptr), stopped(false), currentJob(nullptr), status(STARTING), thread(nullptr)
 {
     static log4cpp::Category& logger_jobpool = log4cpp::Category::getInstance(std::string("log_jobpool"));
     //static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -139,7 +242,7 @@ void JobPoolWorker::Stop()
     status = STOPPED;
     stopped = true;
 
-    std::unique_lock<std::mutex> mutLock(pool->queueLock);
+    std::unique_lock<std::mutex> mutLock(pool->idleLock);
     pool->signal.notify_all();
 }
 
@@ -203,12 +306,14 @@ void JobPoolWorker::Entry()
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_jobpool.debug("JobPoolWorker started  0x%x", tid);
 
+    queue = pool->AcquireWorkQueue();
+    currentWorker = this;
     try {
         SetThreadName(pool->threadNameBase);
         while ( !stopped ) {
             status = IDLE;
 
-            Job *job = pool->GetNextJob();
+            Job *job = pool->GetNextJob(queue);
             if (job != nullptr) {
                 logger_jobpool.debug("JobPoolWorker::Entry processing job.   %X", this);
                 status = RUNNING_JOB;
@@ -230,6 +335,8 @@ void JobPoolWorker::Entry()
         logger_jobpool.warn("JobPoolWorker::Entry exiting due to __forced_unwind.  %X", this);
         pool->numThreads--;
         status = STOPPED;
+        currentWorker = nullptr;
+        pool->ReleaseWorkQueue(queue);
         pool->RemoveWorker(this);
         throw;
 #endif // HAVE_ABI_FORCEDUNWIND
@@ -237,6 +344,8 @@ void JobPoolWorker::Entry()
         logger_base.error("JobPoolWorker::Entry exiting due to unknown exception. 0x%x", tid);
         --pool->numThreads;
         status = STOPPED;
+        currentWorker = nullptr;
+        pool->ReleaseWorkQueue(queue);
         pool->RemoveWorker(this);
         wxTheApp->OnUnhandledException();
         logger_base.debug("JobPoolWorker done 0x%x", tid);
@@ -245,6 +354,8 @@ void JobPoolWorker::Entry()
     logger_jobpool.debug("JobPoolWorker exiting 0x%x", tid);
     --pool->numThreads;
     status = STOPPED;
+    currentWorker = nullptr;
+    pool->ReleaseWorkQueue(queue);
     pool->RemoveWorker(this);
     logger_jobpool.debug("JobPoolWorker::Entry removed.  0x%X", this);
     RemoveThreadName();
@@ -283,8 +394,11 @@ void JobPoolWorker::ProcessJob(Job *job)
 	}
 }
 
-JobPool::JobPool(const std::string &n) : threadLock(), queueLock(), signal(), queue(), numThreads(0), maxNumThreads(8),  idleThreads(0), inFlight(0), threadNameBase(n)
+JobPool::JobPool(const std::string &n) : threadLock(), queueLock(), idleLock(), signal(), queue(), numWorkQueues(0), queuedJobs(0), sharedJobs(0), numThreads(0), maxNumThreads(8),  idleThreads(0), inFlight(0), threadNameBase(n)
 {
+    for (int x = 0; x < JOBPOOL_MAX_WORK_QUEUES; x++) {
+        workQueues[x] = nullptr;
+    }
 }
 
 
@@ -301,6 +415,14 @@ JobPool::~JobPool()
         queue.clear();
     }
     Stop();
+    for (int x = 0; x < numWorkQueues; x++) {
+        Job *job;
+        while ((job = workQueues[x]->Steal()) != nullptr) {
+            delete job;
+        }
+        delete workQueues[x];
+        workQueues[x] = nullptr;
+    }
 }
 
 void JobPool::LockThreads() {
@@ -321,37 +443,110 @@ void JobPool::RemoveWorker(JobPoolWorker *w) {
     UnlockThreads();
 }
 
-Job *JobPool::GetNextJob() {
-    std::unique_lock<std::mutex> mutLock(queueLock);
-    Job *req = nullptr;
-    if (queue.empty()) {
+WorkStealingQueue *JobPool::AcquireWorkQueue() {
+    // queues are reused rather than deleted as thieves may be looking at them
+    std::unique_lock<std::mutex> locker(threadLock);
+    int count = numWorkQueues;
+    for (int x = 0; x < count; x++) {
+        if (!workQueues[x]->inUse) {
+            workQueues[x]->inUse = true;
+            return workQueues[x];
+        }
+    }
+    if (count < JOBPOOL_MAX_WORK_QUEUES) {
+        workQueues[count] = new WorkStealingQueue();
+        workQueues[count]->inUse = true;
+        numWorkQueues = count + 1;
+        return workQueues[count];
+    }
+    // too many workers, this one will just use the shared queue
+    return nullptr;
+}
+
+void JobPool::ReleaseWorkQueue(WorkStealingQueue *q) {
+    if (q != nullptr) {
+        // workers only exit when they could not find a job so this is empty
+        std::unique_lock<std::mutex> locker(threadLock);
+        q->inUse = false;
+    }
+}
+
+Job *JobPool::FindJob(WorkStealingQueue *local) {
+    Job *job = nullptr;
+    if (local != nullptr) {
+        job = local->Pop();
+    }
+    if (job == nullptr && sharedJobs > 0) {
+        std::unique_lock<std::mutex> mutLock(queueLock);
+        if (!queue.empty()) {
+            job = queue.front();
+            queue.pop_front();
+            --sharedJobs;
+        }
+    }
+    if (job == nullptr) {
+        // a steal can fail because another thread got there first so keep
+        // going round until all the queues look empty
+        int count = numWorkQueues;
+        bool retry = true;
+        while (job == nullptr && retry && queuedJobs > 0) {
+            retry = false;
+            for (int x = 0; x < count && job == nullptr; x++) {
+                if (workQueues[x] != local && !workQueues[x]->Empty()) {
+                    job = workQueues[x]->Steal();
+                    retry = true;
+                }
+            }
+        }
+    }
+    if (job != nullptr) {
+        --queuedJobs;
+    }
+    return job;
+}
+
+Job *JobPool::GetNextJob(WorkStealingQueue *local) {
+    Job *req = FindJob(local);
+    if (req == nullptr) {
+        std::unique_lock<std::mutex> mutLock(idleLock);
         idleThreads++;
-        long timeout = 100;
-        if (idleThreads <= 12) {
-            timeout = 30000;
+        if (queuedJobs == 0) {
+            long timeout = 100;
+            if (idleThreads <= 12) {
+                timeout = 30000;
+            }
+            signal.wait_for(mutLock, std::chrono::milliseconds(timeout));
         }
-        signal.wait_for(mutLock, std::chrono::milliseconds(timeout));
         idleThreads--;
-    }
-    if ( !queue.empty() ) {
-        req = queue.front();
-        queue.pop_front();
+        mutLock.unlock();
+        req = FindJob(local);
     }
     return req;
 }
 
 void JobPool::PushJob(Job *job)
 {
-	std::unique_lock<std::mutex> locker(queueLock);
-    queue.push_back(job);
+    JobPoolWorker *worker = currentWorker;
+    if (worker != nullptr && worker->pool == this && worker->queue != nullptr) {
+        worker->queue->Push(job);
+    } else {
+        std::unique_lock<std::mutex> locker(queueLock);
+        queue.push_back(job);
+        ++sharedJobs;
+    }
+    ++queuedJobs;
     inFlight++;
-    
+
     int count = inFlight;
     count -= idleThreads;
     count -= numThreads;
     count = std::min(count, maxNumThreads - numThreads);
     if (count > 0) {
         LockThreads();
+        count = inFlight;
+        count -= idleThreads;
+        count -= numThreads;
+        count = std::min(count, maxNumThreads - numThreads);
         if (numThreads == 0 && count < 4 && 4 < maxNumThreads) {
             //when we create first thread, assume we'll need extras real soon
             count = 4;
@@ -362,7 +557,10 @@ void JobPool::PushJob(Job *job)
         }
         UnlockThreads();
     }
-    signal.notify_all();
+    if (idleThreads > 0) {
+        std::unique_lock<std::mutex> locker(idleLock);
+        signal.notify_one();
+    }
 }
 
 void JobPool::Start(size_t poolSize)
@@ -388,7 +586,7 @@ void JobPool::Stop()
     while (!threads.empty()) {
         UnlockThreads();
 
-        std::unique_lock<std::mutex> qlocker(queueLock);
+        std::unique_lock<std::mutex> qlocker(idleLock);
         signal.notify_all();
         qlocker.unlock();
         
@@ -30,13 +30,25 @@ public:
 
 
 class JobPoolWorker;
+class WorkStealingQueue;
+
+#define JOBPOOL_MAX_WORK_QUEUES 256
+
+// Each worker has its own work stealing deque.  Jobs pushed from a worker go onto its own
+// deque, jobs pushed from elsewhere go onto the shared queue, and idle workers steal from
+// the other workers so the only locks taken are for the shared queue and to sleep.
 class JobPool
 {
     std::mutex threadLock;
     std::mutex queueLock;
+    std::mutex idleLock;
     std::condition_variable signal;
     std::vector<JobPoolWorker*> threads;
     std::deque<Job*> queue;
+    WorkStealingQueue* workQueues[JOBPOOL_MAX_WORK_QUEUES];
+    std::atomic_int numWorkQueues;
+    std::atomic_int queuedJobs;
+    std::atomic_int sharedJobs;
     std::atomic_int numThreads;
     std::atomic_int maxNumThreads;
     std::atomic_int idleThreads;
@@ -60,7 +72,10 @@ private:
     void RemoveWorker(JobPoolWorker*);
     void LockThreads();
     void UnlockThreads();
-    Job *GetNextJob();
+    WorkStealingQueue *AcquireWorkQueue();
+    void ReleaseWorkQueue(WorkStealingQueue *q);
+    Job *FindJob(WorkStealingQueue *local);
+    Job *GetNextJob(WorkStealingQueue *local);
 };
 
 
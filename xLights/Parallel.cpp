@@ -8,6 +8,10 @@
 
 #include "Parallel.h"
 #include <thread>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <condition_variable>
 
 #include "JobPool.h"
 
@@ -34,51 +38,104 @@ int ParallelJobPool::calcSteps(int minStep, int total) {
     return 1;
 }
 
+int ParallelJobPool::calcChunkSize(int minStep, int total) {
+    int steps = calcSteps(minStep, total);
+    if (steps == 1) {
+        return std::max(total, 1);
+    }
+    //a few chunks per thread so one slow chunk doesn't hold everything up
+    int chunks = steps * 4;
+    return std::max(std::max(minStep, 1), (total + chunks - 1) / chunks);
+}
+
 ParallelJobPool ParallelJobPool::POOL;
 
 
+/**
+ * Counts the jobs that are actually working on a parallel loop so the caller can
+ * block until they are done.  Jobs must Enter before claiming any work, a job that
+ * is only picked up after all the work has been claimed does nothing so the caller
+ * doesn't need to wait for it to come off the queue.
+ */
+class ParallelJobGroup {
+    std::atomic_int active;
+    std::mutex lock;
+    std::condition_variable signal;
+public:
+    ParallelJobGroup() : active(0) {}
+
+    void Enter() { ++active; }
+    void Leave() {
+        if (--active == 0) {
+            std::unique_lock<std::mutex> locker(lock);
+            signal.notify_all();
+        }
+    }
+    void Wait() {
+        std::unique_lock<std::mutex> locker(lock);
+        while (active > 0) {
+            signal.wait(locker);
+        }
+    }
+};
+
+// shared with the jobs as they may not come off the queue until after parallel_for returns
+class ParallelForState {
+public:
+    ParallelForState(int min, int m, int cs, std::function<void(int, int)>& f)
+        : next(min), max(m), chunkSize(cs), func(f) {}
+
+    std::atomic_int next;
+    const int max;
+    const int chunkSize;
+    std::function<void(int, int)> &func;
+    ParallelJobGroup group;
+};
+
 class ParallelJob : public Job {
-    int max;
-    std::function<void(int)>& func;
-    std::atomic_int &doneCount;
-    std::atomic_int &iteration;
+    std::shared_ptr<ParallelForState> state;
 public:
-    ParallelJob(int m, std::function<void(int)>& f,
-                std::atomic_int &dc, std::atomic_int &it)
-        : max(m), func(f), iteration(it), doneCount(dc) {}
+    ParallelJob(const std::shared_ptr<ParallelForState> &s) : state(s) {}
     virtual ~ParallelJob() {};
     virtual void Process() override {
+        state->group.Enter();
         try {
             int x;
-            while ((x = iteration.fetch_add(1)) < max) {
-                func(x);
+            while ((x = state->next.fetch_add(state->chunkSize)) < state->max) {
+                state->func(x, std::min(x + state->chunkSize, state->max));
             }
         } catch (...) {
             //nothing
         }
-        doneCount++;
+        state->group.Leave();
     };
     virtual bool DeleteWhenComplete() override { return true; };
     virtual bool SetThreadName() override { return false; }
 };
 
-void parallel_for(int min, int max, std::function<void(int)>&& func, int minStep) {
-    int calcSteps = ParallelJobPool::POOL.calcSteps(minStep, max - min);
-    if (calcSteps == 1) {
-        for (int x = min; x < max; x++) {
-            func(x);
-        }
+void parallel_for_range(int min, int max, std::function<void(int, int)>&& func, int minStep) {
+    int total = max - min;
+    if (total <= 0) {
+        return;
+    }
+    int chunkSize = ParallelJobPool::POOL.calcChunkSize(minStep, total);
+    if (chunkSize >= total) {
+        func(min, max);
     } else {
-        std::function<void(int)> f(func);
-        std::atomic_int doneCount(0);
-        std::atomic_int iteration(min);
+        int calcSteps = ParallelJobPool::POOL.calcSteps(minStep, total);
+        std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>(min, max, chunkSize, func);
         for (int x = 0; x < calcSteps-1; x++) {
-            ParallelJobPool::POOL.PushJob(new ParallelJob(max, f, doneCount, iteration));
-        }
-        ParallelJob(max, f, doneCount, iteration).Process();
-        while (doneCount < calcSteps) {
-            std::this_thread::yield();
+            ParallelJobPool::POOL.PushJob(new ParallelJob(state));
         }
+        ParallelJob(state).Process();
+        state->group.Wait();
     }
 }
 
+void parallel_for(int min, int max, std::function<void(int)>&& func, int minStep) {
+    parallel_for_range(min, max, [&func](int start, int end) {
+        for (int x = start; x < end; x++) {
+            func(x);
+        }
+    }, minStep);
+}
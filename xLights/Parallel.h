@@ -7,8 +7,10 @@
 #ifndef Parallel_hpp
 #define Parallel_hpp
 
+#include <algorithm>
 #include <functional>
 #include <list>
+#include <vector>
 #include <mutex>
 #include <thread>
 
@@ -22,6 +24,7 @@ public:
     static ParallelJobPool POOL;
     
     int calcSteps(int minStep, int size);
+    int calcChunkSize(int minStep, int size);
 };
 
 
@@ -31,9 +34,38 @@ public:
  *
  * would convert to:
  * parallel_for(start, max, [&] (int x) {} );
+ *
+ * The range is split into contiguous chunks of at least minStep items which
+ * are handed out to the threads so the per item overhead is small.
  */
 void parallel_for(int start, int max, std::function<void(int)>&& f, int minStep = 1);
 
+/**
+ * Same as above, but the body is called once per chunk with the [start, end) of the
+ * chunk so cheap per item bodies can be written as a tight loop:
+ * parallel_for_range(start, max, [&] (int s, int e) { for (int x = s; x < e; ++x) {} });
+ */
+void parallel_for_range(int start, int max, std::function<void(int, int)>&& f, int minStep = 1);
+
+
+/**
+ * Traditional for loop:
+ * std::vector<T> vec;
+ * for(int idx = 0; idx < vec.size(); ++idx) { T &t = vec[idx]; ... use t ...}
+ *
+ * would convert to:
+ * std::function<void(T&, int)> f = [&](T &t, int idx) { ... use t and idx...}
+ * parallel_for(vec, f);
+ */
+template <typename T>
+void parallel_for(std::vector<T> &vec, std::function<void(T&, int)>& f, int minStep = 1) {
+    parallel_for_range(0, vec.size(), [&vec, &f](int start, int end) {
+        for (int x = start; x < end; x++) {
+            f(vec[x], x);
+        }
+    }, minStep);
+}
+
 
 /**
  * Traditional for loop:
@@ -48,65 +80,32 @@ void parallel_for(int start, int max, std::function<void(int)>&& f, int minStep
  */
 template <typename T>
 void parallel_for(std::list<T> &list, std::function<void(T&, int)>& f, int minStep = 1) {
-    class ParallelListJob : public Job {
-        std::atomic_int &doneCount;
-        std::function<void(T&, int)>& func;
-        std::mutex &lock;
-        std::atomic_int &index;
-        typename std::list<T>::iterator &iterator;
-        const int max;
-    public:
-        ParallelListJob(std::atomic_int &dc,
-                        std::function<void(T&, int)>& f,
-                        typename std::list<T>::iterator &it,
-                        std::mutex &l,
-                        std::atomic_int &idx,
-                        int m)
-            : Job(), doneCount(dc), func(f), iterator(it), lock(l), index(idx), max(m) {}
-        void Process() {
-            try {
-                while (true) {
-                    lock.lock();
-                    int idx = index.fetch_add(1);
-                    if (idx < max) {
-                        T &t = *iterator;
-                        ++iterator;
-                        lock.unlock();
-                        func(t, idx);
-                    } else {
-                        lock.unlock();
-                        doneCount++;
-                        return;
-                    }
-                }
-            } catch (...) {
-                //nothing
-                doneCount++;
-            }
-        }
-    };
-    
     int size = list.size();
-    int calcSteps = ParallelJobPool::POOL.calcSteps(minStep, size);
-    if (calcSteps == 1) {
+    int chunkSize = ParallelJobPool::POOL.calcChunkSize(minStep, size);
+    if (chunkSize >= size) {
         int idx = 0;
         for (auto &a : list) {
             f(a, idx);
             idx++;
         }
     } else {
-        std::atomic_int doneCount(0);
-        std::mutex lock;
-        std::atomic_int idx(0);
-        typename std::list<T>::iterator it = list.begin();
-        
-        for (int x = 0; x < calcSteps-1; x++) {
-            ParallelJobPool::POOL.PushJob(new ParallelListJob(doneCount, f, it, lock, idx, size));
-        }
-        ParallelListJob(doneCount, f, it, lock, idx, size).Process();
-        while (doneCount < calcSteps) {
-            std::this_thread::yield();
+        // walk the list once up front so each chunk has its own starting iterator
+        // and the threads never have to share one
+        std::vector<typename std::list<T>::iterator> chunks;
+        chunks.reserve(size / chunkSize + 1);
+        int idx = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++idx) {
+            if (idx % chunkSize == 0) {
+                chunks.push_back(it);
+            }
         }
+        parallel_for(0, chunks.size(), [&chunks, &f, chunkSize, size](int c) {
+            auto it = chunks[c];
+            int end = std::min(size, (c + 1) * chunkSize);
+            for (int x = c * chunkSize; x < end; ++x, ++it) {
+                f(*it, x);
+            }
+        });
     }
 }
 
@@ -37,6 +37,18 @@
 #include "UtilFunctions.h"
 #include "DissolveTransitionPattern.h"
 
+// SIMD layer blending, blur and roto zoom use whatever instruction set the compiler is targeting
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PIXELBUFFER_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PIXELBUFFER_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIXELBUFFER_SIMD_NEON
+#endif
+
 // This is needed for visual studio
 #ifdef _MSC_VER
 #define M_PI_2 1.57079632679489661923
@@ -382,6 +394,7 @@ PixelBufferClass::PixelBufferClass(xLightsFrame *f) : frame(f)
     numLayers = 0;
     zbModel = nullptr;
     ssModel = nullptr;
+    outputColorsValid = false;
 }
 
 PixelBufferClass::~PixelBufferClass()
@@ -409,6 +422,7 @@ void PixelBufferClass::reset(int nlayers, int timing, bool isNode)
     }
     layers.clear();
     frameTimeInMs = timing;
+    outputColorsValid = false;
 
     numLayers = nlayers;
     layers.resize(nlayers);
@@ -418,6 +432,7 @@ void PixelBufferClass::reset(int nlayers, int timing, bool isNode)
         layers[x] = new LayerInfo(frame);
         layers[x]->buffer.SetFrameTimeInMs(frameTimeInMs);
         model->InitRenderBufferNodes("Default", "2D", "None", layers[x]->buffer.Nodes, layers[x]->BufferWi, layers[x]->BufferHt);
+        layers[x]->buffer.nodeLayout.Build(layers[x]->buffer.Nodes);
         layers[x]->bufferType = "Default";
         layers[x]->camera = "2D";
         layers[x]->bufferTransform = "None";
@@ -511,6 +526,7 @@ void PixelBufferClass::GetNodeChannelValues(size_t nodenum, unsigned char *buf)
 }
 void PixelBufferClass::SetNodeChannelValues(size_t nodenum, const unsigned char *buf)
 {
+    outputColorsValid = false;
     layers[0]->buffer.Nodes[nodenum]->SetFromChannels(buf);
 }
 xlColor PixelBufferClass::GetNodeColor(size_t nodenum) const
@@ -585,148 +601,106 @@ void PixelBufferClass::SetMixType(int layer, const std::string& MixName)
     layers[layer]->buffer.SetAllowAlphaChannel(MixTypeHandlesAlpha(layers[layer]->mixType));
 }
 
-void PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, xlColor &fg, xlColor &bg, int layer)
+// Layer blending
+//
+// Each mix type has a row kernel which blends a run of foreground pixels onto the background pixels.
+// The kernel is chosen once per layer per frame in PrepareLayerBlend so the per pixel work is just the blend.
+// The modes which are pure byte arithmetic or a choice between the two colours also have SIMD versions.
+// These must give exactly the same result as the scalar BlendPixel code which is also used for any
+// pixels left over at the end of a row.
+
+static inline int MaxRGB(const xlColor& c)
 {
-    static const int n = 0;  //increase to change the curve of the crossfade
+    return std::max(c.red, std::max(c.green, c.blue));
+}
 
-    if (!layers[layer]->buffer.allowAlpha && layers[layer]->fadeFactor != 1.0) {
+template <MixTypes MT>
+static inline void BlendPixel(const LayerBlendParams& p, xlColor& fg, xlColor& bg, int x, int y)
+{
+    if (p.fadeForeground) {
         //need to fade the first here as we're not mixing anything
         HSVValue hsv0 = fg.asHSV();
-        hsv0.value *= layers[layer]->fadeFactor;
+        hsv0.value *= p.fadeFactor;
         fg = hsv0;
     }
 
-    float svthresh = layers[layer]->effectMixThreshold;
-    if (layers[layer]->effectMixVaries) {
-        //vary mix threshold gradually during effect interval -DJ
-        layers[layer]->effectMixThreshold = layers[layer]->buffer.GetEffectTimeIntervalPosition();
-    }
-    if (layers[layer]->effectMixThreshold < 0) {
-        layers[layer]->effectMixThreshold = 0;
-    }
-
-    switch (layers[layer]->mixType)
+    switch (MT)
     {
     case Mix_Normal:
-        fg.alpha = fg.alpha * layers[layer]->fadeFactor * (1.0 - layers[layer]->effectMixThreshold);
+        fg.alpha = fg.alpha * p.fadeFactor * (1.0 - p.threshold);
         bg.AlphaBlendForgroundOnto(fg);
         break;
     case Mix_Effect1:
+        fg.Set(fg.Red()*(p.emt), fg.Green()*(p.emt), fg.Blue()*(p.emt));
+        bg.Set(bg.Red()*(p.emtNot), bg.Green()*(p.emtNot), bg.Blue()*(p.emtNot));
+        bg.Set(fg.Red()+bg.Red(), fg.Green()+bg.Green(), fg.Blue()+bg.Blue());
+        break;
     case Mix_Effect2:
-    {
-        double emt, emtNot;
-        if (!layers[layer]->effectMixVaries) {
-            emt = layers[layer]->effectMixThreshold;
-            if ((emt > 0.000001) && (emt < 0.99999)) {
-                emtNot = 1-layers[layer]->effectMixThreshold;
-                //make cross-fade linear
-                emt = cos((M_PI/4)*(pow(2*emt-1,2*n+1)+1));
-                emtNot = cos((M_PI/4)*(pow(2*emtNot-1,2*n+1)+1));
-            } else {
-                emtNot = layers[layer]->effectMixThreshold;
-                emt = 1 - layers[layer]->effectMixThreshold;
-            }
-        } else {
-            emt = layers[layer]->effectMixThreshold;
-            emtNot = 1-layers[layer]->effectMixThreshold;
-        }
-
-        if (layers[layer]->mixType == Mix_Effect2) {
-            fg.Set(fg.Red()*(emtNot),fg.Green()*(emtNot), fg.Blue()*(emtNot));
-            bg.Set(bg.Red()*(emt),bg.Green()*(emt), bg.Blue()*(emt));
-        } else {
-            fg.Set(fg.Red()*(emt),fg.Green()*(emt), fg.Blue()*(emt));
-            bg.Set(bg.Red()*(emtNot),bg.Green()*(emtNot), bg.Blue()*(emtNot));
-        }
+        fg.Set(fg.Red()*(p.emtNot), fg.Green()*(p.emtNot), fg.Blue()*(p.emtNot));
+        bg.Set(bg.Red()*(p.emt), bg.Green()*(p.emt), bg.Blue()*(p.emt));
         bg.Set(fg.Red()+bg.Red(), fg.Green()+bg.Green(), fg.Blue()+bg.Blue());
         break;
-    }
     case Mix_Mask1:
-    {
         // first masks second
-        HSVValue hsv0 = fg.asHSV();
-        if (hsv0.value > layers[layer]->effectMixThreshold) {
+        if (MaxRGB(fg) >= p.valueCutoff) {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_Mask2:
-    {
         // second masks first
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv1.value <= layers[layer]->effectMixThreshold) {
+        if (MaxRGB(bg) < p.valueCutoff) {
             bg = fg;
         } else {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_Unmask1:
-    {
         // first unmasks second
-        HSVValue hsv0 = fg.asHSV();
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv0.value > layers[layer]->effectMixThreshold) {
-            hsv1.value = hsv0.value;
+        if (MaxRGB(fg) >= p.valueCutoff) {
+            HSVValue hsv1 = bg.asHSV();
+            hsv1.value = fg.asHSV().value;
             bg = hsv1;
         } else {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_TrueUnmask1:
-    {
         // first unmasks second
-        HSVValue hsv0 = fg.asHSV();
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv0.value > layers[layer]->effectMixThreshold) {
-            bg = hsv1;
+        if (MaxRGB(fg) >= p.valueCutoff) {
+            bg = bg.asHSV();
         } else {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_Unmask2:
-    {
         // second unmasks first
-        HSVValue hsv0 = fg.asHSV();
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv1.value > layers[layer]->effectMixThreshold) {
+        if (MaxRGB(bg) >= p.valueCutoff) {
             // if effect 2 is non black
-            hsv0.value = hsv1.value;
+            HSVValue hsv0 = fg.asHSV();
+            hsv0.value = bg.asHSV().value;
             bg = hsv0;
         } else {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_TrueUnmask2:
-    {
         // second unmasks first
-        HSVValue hsv0 = fg.asHSV();
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv1.value > layers[layer]->effectMixThreshold) {
+        if (MaxRGB(bg) >= p.valueCutoff) {
             // if effect 2 is non black
-            bg = hsv0;
+            bg = fg.asHSV();
         } else {
             bg.Set(0, 0, 0);
         }
         break;
-    }
     case Mix_Shadow_1on2:
     {
         // Effect 1 shadows onto effect 2
         HSVValue hsv0 = fg.asHSV();
         HSVValue hsv1 = bg.asHSV();
-        //   if (hsv0.value > effectMixThreshold[layer]) {
-        // if effect 1 is non black
         //  to shadow we will shift the hue on the primary layer using the hue and brightness from the
         //  other layer
-        if(hsv0.value>0.0) hsv1.hue = hsv1.hue + (hsv0.value*(hsv1.hue-hsv0.hue))/5.0;
-        // hsv1.value = hsv0.value;
-        //hsv1.saturation = hsv0.saturation;
+        if (hsv0.value > 0.0) hsv1.hue = hsv1.hue + (hsv0.value*(hsv1.hue - hsv0.hue)) / 5.0;
         bg = hsv1;
-        //   }
         break;
     }
     case Mix_Shadow_2on1:
@@ -735,46 +709,36 @@ void PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, xlColor &fg
         HSVValue hsv0 = fg.asHSV();
         HSVValue hsv1 = bg.asHSV();
         // if effect 1 is non black
-        if(hsv1.value>0.0) {
-            hsv0.hue = hsv0.hue + (hsv1.value*(hsv0.hue-hsv1.hue))/2.0;
+        if (hsv1.value > 0.0) {
+            hsv0.hue = hsv0.hue + (hsv1.value*(hsv0.hue - hsv1.hue)) / 2.0;
         }
         bg = hsv0;
         break;
     }
     case Mix_Layered:
-    {
-        HSVValue hsv1 = bg.asHSV();
-        if (hsv1.value <= layers[layer]->effectMixThreshold) {
+    case Mix_2_reveals_1:
+        // effect 1 only shows where effect 2 is black
+        if (MaxRGB(bg) < p.valueCutoff) {
             bg = fg;
         }
         break;
-    }
     case Mix_Average:
         // only average when both colors are non-black
         if (bg == xlBLACK) {
             bg = fg;
         } else if (fg != xlBLACK) {
-            bg.Set( (fg.Red()+bg.Red())/2, (fg.Green()+bg.Green())/2, (fg.Blue()+bg.Blue())/2 );
+            bg.Set((fg.Red() + bg.Red()) / 2, (fg.Green() + bg.Green()) / 2, (fg.Blue() + bg.Blue()) / 2);
         }
         break;
     case Mix_BottomTop:
-        bg = y < layers[layer]->BufferHt/2 ? fg : bg;
+        bg = y < p.halfHt ? fg : bg;
         break;
     case Mix_LeftRight:
-        bg = x < layers[layer]->BufferWi/2 ? fg : bg;
+        bg = x < p.halfWi ? fg : bg;
         break;
     case Mix_1_reveals_2:
-    {
-        HSVValue hsv0 = fg.asHSV();
-        bg = hsv0.value > layers[layer]->effectMixThreshold ? fg : bg; // if effect 1 is non black
-        break;
-    }
-    case Mix_2_reveals_1:
-    {
-        HSVValue hsv1 = bg.asHSV();
-        bg = hsv1.value > layers[layer]->effectMixThreshold ? bg : fg; // if effect 2 is non black
+        bg = MaxRGB(fg) >= p.valueCutoff ? fg : bg; // if effect 1 is non black
         break;
-    }
     case Mix_Additive:
         {
             int r = fg.red + bg.red;
@@ -797,216 +761,481 @@ void PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, xlColor &fg
             bg.Set(r, g, b);
         }
         break;
-
     case Mix_Min:
-        {
-            int r = std::min(fg.red, bg.red);
-            int g = std::min(fg.green, bg.green);
-            int b = std::min(fg.blue, bg.blue);
-            bg.Set(r, g, b);
-        }
+        bg.Set(std::min(fg.red, bg.red), std::min(fg.green, bg.green), std::min(fg.blue, bg.blue));
         break;
     case Mix_Max:
-        {
-            int r = std::max(fg.red, bg.red);
-            int g = std::max(fg.green, bg.green);
-            int b = std::max(fg.blue, bg.blue);
-            bg.Set(r, g, b);
-        }
+        bg.Set(std::max(fg.red, bg.red), std::max(fg.green, bg.green), std::max(fg.blue, bg.blue));
         break;
     }
-    if (layers[layer]->effectMixVaries)
+}
+
+template <MixTypes MT>
+static void BlendRow(const LayerBlendParams& p, xlColor* fg, xlColor* bg, const int* x, const int* y, int count)
+{
+    for (int i = 0; i < count; i++) {
+        BlendPixel<MT>(p, fg[i], bg[i], x[i], y[i]);
+    }
+}
+
+#if defined(PIXELBUFFER_SIMD_AVX2) || defined(PIXELBUFFER_SIMD_SSE2) || defined(PIXELBUFFER_SIMD_NEON)
+// Vector primitives on a register of packed xlColor values (r, g, b, a bytes so alpha is the top byte of each 32 bit lane)
+#if defined(PIXELBUFFER_SIMD_AVX2)
+typedef __m256i BlendVector;
+#define BLEND_VECTOR_PIXELS 8
+static inline BlendVector BlendLoad(const xlColor* c) { return _mm256_loadu_si256((const __m256i*)c); }
+static inline void BlendStore(xlColor* c, BlendVector v) { _mm256_storeu_si256((__m256i*)c, v); }
+static inline BlendVector BlendAddSaturate(BlendVector a, BlendVector b) { return _mm256_adds_epu8(a, b); }
+static inline BlendVector BlendSubtractSaturate(BlendVector a, BlendVector b) { return _mm256_subs_epu8(a, b); }
+static inline BlendVector BlendMin(BlendVector a, BlendVector b) { return _mm256_min_epu8(a, b); }
+static inline BlendVector BlendMax(BlendVector a, BlendVector b) { return _mm256_max_epu8(a, b); }
+static inline BlendVector BlendHalfAdd(BlendVector a, BlendVector b)
+{
+    // (a + b) / 2 rounded down without overflowing a byte
+    BlendVector half = _mm256_and_si256(_mm256_srli_epi16(_mm256_xor_si256(a, b), 1), _mm256_set1_epi8(0x7F));
+    return _mm256_add_epi8(_mm256_and_si256(a, b), half);
+}
+static inline BlendVector BlendOpaque(BlendVector a) { return _mm256_or_si256(a, _mm256_set1_epi32((int)0xFF000000)); }
+static inline BlendVector BlendOpaqueBlack() { return _mm256_set1_epi32((int)0xFF000000); }
+static inline BlendVector BlendAbove(BlendVector a, int cutoff)
+{
+    BlendVector m = _mm256_max_epu8(_mm256_max_epu8(a, _mm256_srli_epi32(a, 8)), _mm256_srli_epi32(a, 16));
+    m = _mm256_and_si256(m, _mm256_set1_epi32(0xFF));
+    return _mm256_cmpgt_epi32(m, _mm256_set1_epi32(cutoff - 1));
+}
+static inline BlendVector BlendIsBlack(BlendVector a)
+{
+    return _mm256_cmpeq_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0x00FFFFFF)), _mm256_setzero_si256());
+}
+static inline BlendVector BlendSelect(BlendVector mask, BlendVector a, BlendVector b) { return _mm256_blendv_epi8(b, a, mask); }
+#elif defined(PIXELBUFFER_SIMD_SSE2)
+typedef __m128i BlendVector;
+#define BLEND_VECTOR_PIXELS 4
+static inline BlendVector BlendLoad(const xlColor* c) { return _mm_loadu_si128((const __m128i*)c); }
+static inline void BlendStore(xlColor* c, BlendVector v) { _mm_storeu_si128((__m128i*)c, v); }
+static inline BlendVector BlendAddSaturate(BlendVector a, BlendVector b) { return _mm_adds_epu8(a, b); }
+static inline BlendVector BlendSubtractSaturate(BlendVector a, BlendVector b) { return _mm_subs_epu8(a, b); }
+static inline BlendVector BlendMin(BlendVector a, BlendVector b) { return _mm_min_epu8(a, b); }
+static inline BlendVector BlendMax(BlendVector a, BlendVector b) { return _mm_max_epu8(a, b); }
+static inline BlendVector BlendHalfAdd(BlendVector a, BlendVector b)
+{
+    // (a + b) / 2 rounded down without overflowing a byte
+    BlendVector half = _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 1), _mm_set1_epi8(0x7F));
+    return _mm_add_epi8(_mm_and_si128(a, b), half);
+}
+static inline BlendVector BlendOpaque(BlendVector a) { return _mm_or_si128(a, _mm_set1_epi32((int)0xFF000000)); }
+static inline BlendVector BlendOpaqueBlack() { return _mm_set1_epi32((int)0xFF000000); }
+static inline BlendVector BlendAbove(BlendVector a, int cutoff)
+{
+    BlendVector m = _mm_max_epu8(_mm_max_epu8(a, _mm_srli_epi32(a, 8)), _mm_srli_epi32(a, 16));
+    m = _mm_and_si128(m, _mm_set1_epi32(0xFF));
+    return _mm_cmpgt_epi32(m, _mm_set1_epi32(cutoff - 1));
+}
+static inline BlendVector BlendIsBlack(BlendVector a)
+{
+    return _mm_cmpeq_epi32(_mm_and_si128(a, _mm_set1_epi32(0x00FFFFFF)), _mm_setzero_si128());
+}
+static inline BlendVector BlendSelect(BlendVector mask, BlendVector a, BlendVector b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+#else
+typedef uint8x16_t BlendVector;
+#define BLEND_VECTOR_PIXELS 4
+static inline BlendVector BlendLoad(const xlColor* c) { return vld1q_u8((const uint8_t*)c); }
+static inline void BlendStore(xlColor* c, BlendVector v) { vst1q_u8((uint8_t*)c, v); }
+static inline BlendVector BlendAddSaturate(BlendVector a, BlendVector b) { return vqaddq_u8(a, b); }
+static inline BlendVector BlendSubtractSaturate(BlendVector a, BlendVector b) { return vqsubq_u8(a, b); }
+static inline BlendVector BlendMin(BlendVector a, BlendVector b) { return vminq_u8(a, b); }
+static inline BlendVector BlendMax(BlendVector a, BlendVector b) { return vmaxq_u8(a, b); }
+static inline BlendVector BlendHalfAdd(BlendVector a, BlendVector b) { return vhaddq_u8(a, b); }
+static inline BlendVector BlendOpaque(BlendVector a) { return vorrq_u8(a, vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000))); }
+static inline BlendVector BlendOpaqueBlack() { return vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000)); }
+static inline BlendVector BlendAbove(BlendVector a, int cutoff)
+{
+    uint32x4_t w = vreinterpretq_u32_u8(a);
+    uint8x16_t m = vmaxq_u8(vmaxq_u8(a, vreinterpretq_u8_u32(vshrq_n_u32(w, 8))), vreinterpretq_u8_u32(vshrq_n_u32(w, 16)));
+    uint32x4_t mw = vandq_u32(vreinterpretq_u32_u8(m), vdupq_n_u32(0xFF));
+    return vreinterpretq_u8_u32(vcgeq_u32(mw, vdupq_n_u32(cutoff)));
+}
+static inline BlendVector BlendIsBlack(BlendVector a)
+{
+    return vreinterpretq_u8_u32(vceqq_u32(vandq_u32(vreinterpretq_u32_u8(a), vdupq_n_u32(0x00FFFFFF)), vdupq_n_u32(0)));
+}
+static inline BlendVector BlendSelect(BlendVector mask, BlendVector a, BlendVector b) { return vbslq_u8(mask, a, b); }
+#endif
+
+// returns the new background for a vector of pixels
+template <MixTypes MT>
+static inline BlendVector BlendVectors(const LayerBlendParams& p, BlendVector fg, BlendVector bg)
+{
+    switch (MT)
     {
-        layers[layer]->effectMixThreshold = svthresh; //put it back afterwards in case next row didn't change it
+    case Mix_Mask1:
+        return BlendSelect(BlendAbove(fg, p.valueCutoff), BlendOpaqueBlack(), bg);
+    case Mix_Mask2:
+        return BlendSelect(BlendAbove(bg, p.valueCutoff), BlendOpaqueBlack(), fg);
+    case Mix_Layered:
+    case Mix_2_reveals_1:
+        return BlendSelect(BlendAbove(bg, p.valueCutoff), bg, fg);
+    case Mix_1_reveals_2:
+        return BlendSelect(BlendAbove(fg, p.valueCutoff), fg, bg);
+    case Mix_Average:
+        return BlendSelect(BlendIsBlack(bg), fg, BlendSelect(BlendIsBlack(fg), bg, BlendOpaque(BlendHalfAdd(fg, bg))));
+    case Mix_Additive:
+        return BlendOpaque(BlendAddSaturate(fg, bg));
+    case Mix_Subtractive:
+        return BlendOpaque(BlendSubtractSaturate(bg, fg));
+    case Mix_Min:
+        return BlendOpaque(BlendMin(fg, bg));
+    case Mix_Max:
+    default:
+        return BlendOpaque(BlendMax(fg, bg));
     }
 }
 
-void PixelBufferClass::GetMixedColor(int node, xlColor& c, const std::vector<bool> & validLayers, int EffectPeriod)
+template <MixTypes MT>
+static void BlendRowSIMD(const LayerBlendParams& p, xlColor* fg, xlColor* bg, const int* x, const int* y, int count)
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    if (p.fadeForeground) {
+        // the fade goes through HSV so there is nothing to gain here
+        BlendRow<MT>(p, fg, bg, x, y, count);
+        return;
+    }
+    int i = 0;
+    for (; i + BLEND_VECTOR_PIXELS <= count; i += BLEND_VECTOR_PIXELS) {
+        BlendStore(&bg[i], BlendVectors<MT>(p, BlendLoad(&fg[i]), BlendLoad(&bg[i])));
+    }
+    BlendRow<MT>(p, &fg[i], &bg[i], &x[i], &y[i], count - i);
+}
+#define BLEND_ROW_SIMD BlendRowSIMD
+#else
+#define BLEND_ROW_SIMD BlendRow
+#endif
 
-    unsigned short &sparkle = layers[0]->buffer.Nodes[node]->sparkle;
-    int cnt = 0;
-    c = xlBLACK;
-    xlColor color;
+static LayerBlendFunction GetLayerBlendFunction(MixTypes mt)
+{
+    switch (mt)
+    {
+    case Mix_Normal: return BlendRow<Mix_Normal>;
+    case Mix_Effect1: return BlendRow<Mix_Effect1>;
+    case Mix_Effect2: return BlendRow<Mix_Effect2>;
+    case Mix_Mask1: return BLEND_ROW_SIMD<Mix_Mask1>;
+    case Mix_Mask2: return BLEND_ROW_SIMD<Mix_Mask2>;
+    case Mix_Unmask1: return BlendRow<Mix_Unmask1>;
+    case Mix_Unmask2: return BlendRow<Mix_Unmask2>;
+    case Mix_TrueUnmask1: return BlendRow<Mix_TrueUnmask1>;
+    case Mix_TrueUnmask2: return BlendRow<Mix_TrueUnmask2>;
+    case Mix_1_reveals_2: return BLEND_ROW_SIMD<Mix_1_reveals_2>;
+    case Mix_2_reveals_1: return BLEND_ROW_SIMD<Mix_2_reveals_1>;
+    case Mix_Layered: return BLEND_ROW_SIMD<Mix_Layered>;
+    case Mix_Average: return BLEND_ROW_SIMD<Mix_Average>;
+    case Mix_BottomTop: return BlendRow<Mix_BottomTop>;
+    case Mix_LeftRight: return BlendRow<Mix_LeftRight>;
+    case Mix_Shadow_1on2: return BlendRow<Mix_Shadow_1on2>;
+    case Mix_Shadow_2on1: return BlendRow<Mix_Shadow_2on1>;
+    case Mix_Additive: return BLEND_ROW_SIMD<Mix_Additive>;
+    case Mix_Subtractive: return BLEND_ROW_SIMD<Mix_Subtractive>;
+    case Mix_Max: return BLEND_ROW_SIMD<Mix_Max>;
+    case Mix_Min: return BLEND_ROW_SIMD<Mix_Min>;
+    }
+    return BlendRow<Mix_Effect1>;
+}
+
+// works out the blend parameters which only depend on the layer settings and the frame
+static void SetupLayerBlend(LayerBlendParams& p, MixTypes mixType, bool allowAlpha, double fadeFactor, float threshold, bool effectMixVaries, int bufferWi, int bufferHt)
+{
+    static const int n = 0;  //increase to change the curve of the crossfade
 
-    for (int layer = numLayers - 1; layer >= 0; layer--) {
-        if (validLayers[layer]) {
-            auto thelayer = layers[layer];
+    p.mixType = mixType;
+    p.blendRow = GetLayerBlendFunction(mixType);
+    p.fadeFactor = fadeFactor;
+    p.fadeForeground = !allowAlpha && fadeFactor != 1.0;
+    p.halfWi = bufferWi / 2;
+    p.halfHt = bufferHt / 2;
 
-            // TEMPORARY - THIS SHOULD BE REMOVED BUT I WANT TO SEE WHAT IS CAUSING SOME RANDOM CRASHES - KW - 2017.7
-            if (thelayer == nullptr) {
-                logger_base.crit("PixelBufferClass::GetMixedColor thelayer is nullptr ... this is going to crash.");
+    if (threshold < 0) {
+        threshold = 0;
+    }
+    p.threshold = threshold;
+
+    // the HSV value of a colour is max(r, g, b) / 255 so the threshold test only needs the largest component
+    p.valueCutoff = std::min(std::max((int)(threshold * 255.0), 0), 256);
+    while (p.valueCutoff > 0 && (p.valueCutoff - 1) / 255.0 > threshold) {
+        p.valueCutoff--;
+    }
+    while (p.valueCutoff < 256 && !(p.valueCutoff / 255.0 > threshold)) {
+        p.valueCutoff++;
+    }
+
+    if (!effectMixVaries) {
+        p.emt = threshold;
+        if ((p.emt > 0.000001) && (p.emt < 0.99999)) {
+            p.emtNot = 1 - threshold;
+            //make cross-fade linear
+            p.emt = cos((M_PI/4)*(pow(2*p.emt-1,2*n+1)+1));
+            p.emtNot = cos((M_PI/4)*(pow(2*p.emtNot-1,2*n+1)+1));
+        } else {
+            p.emtNot = threshold;
+            p.emt = 1 - threshold;
+        }
+    } else {
+        p.emt = threshold;
+        p.emtNot = 1 - threshold;
+    }
+}
+
+void PixelBufferClass::mixColors(const wxCoord &x, const wxCoord &y, xlColor &fg, xlColor &bg, int layer)
+{
+    LayerInfo* thelayer = layers[layer];
+    //vary mix threshold gradually during effect interval -DJ
+    float threshold = thelayer->effectMixVaries ? thelayer->buffer.GetEffectTimeIntervalPosition() : thelayer->effectMixThreshold;
+
+    LayerBlendParams p;
+    SetupLayerBlend(p, thelayer->mixType, thelayer->buffer.allowAlpha, thelayer->fadeFactor, threshold, thelayer->effectMixVaries, thelayer->BufferWi, thelayer->BufferHt);
+    int xx = x;
+    int yy = y;
+    p.blendRow(p, &fg, &bg, &xx, &yy, 1);
+}
+
+static inline void AdjustLayerColor(const LayerBlendParams& p, xlColor& color, uint16_t& sparkle)
+{
+    // adjust for HSV adjustments
+    if (p.hueAdjust != 0 || p.saturationAdjust != 0 || p.valueAdjust != 0) {
+        HSVValue hsv = color.asHSV();
+
+        if (p.hueAdjust != 0) {
+            hsv.hue += p.hueAdjust;
+            if (hsv.hue < 0) {
+                hsv.hue += 1.0;
+            } else if (hsv.hue > 1) {
+                hsv.hue -= 1.0;
             }
+        }
 
-            if (node >= thelayer->buffer.Nodes.size()) {
-                //logger_base.crit("PixelBufferClass::GetMixedColor thelayer->buffer.Nodes does not contain node %d as it is only %d in size ... this was going to crash.", node, thelayer->buffer.Nodes.size());
-            } else {
-                int effStartPer, effEndPer;
-                thelayer->buffer.GetEffectPeriods(effStartPer, effEndPer);
-                float offset = ((float)(EffectPeriod - effStartPer)) / ((float)(effEndPer - effStartPer));
-                offset = std::min(offset, 1.0f);
+        if (p.saturationAdjust != 0) {
+            hsv.saturation += p.saturationAdjust;
+            if (hsv.saturation < 0) {
+                hsv.saturation = 0.0;
+            } else if (hsv.saturation > 1) {
+                hsv.saturation = 1.0;
+            }
+        }
 
-                auto &coord = thelayer->buffer.Nodes[node]->Coords[0];
-                int x = coord.bufX;
-                int y = coord.bufY;
+        if (p.valueAdjust != 0) {
+            hsv.value += p.valueAdjust;
+            if (hsv.value < 0) {
+                hsv.value = 0.0;
+            } else if (hsv.value > 1) {
+                hsv.value = 1.0;
+            }
+        }
 
-                if (thelayer->isMasked(x, y)
-                    || x < 0
-                    || y < 0
-                    || x >= thelayer->BufferWi
-                    || y >= thelayer->BufferHt
-                    ) {
-                    color.Set(0, 0, 0, 0);
-                } else {
-                    thelayer->buffer.GetPixel(x, y, color);
-                }
+        unsigned char alpha = color.Alpha();
+        color = hsv;
+        color.alpha = alpha;
+    }
 
-                float ha;
-                if (thelayer->HueAdjustValueCurve.IsActive()) {
-                    ha = thelayer->HueAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
-                } else {
-                    ha = (float)thelayer->hueadjust / 100.0;
-                }
-                float sa;
-                if (thelayer->SaturationAdjustValueCurve.IsActive()) {
-                    sa = thelayer->SaturationAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
-                } else {
-                    sa = (float)thelayer->saturationadjust / 100.0;
-                }
+    // add sparkles
+    if (p.sparkles && color != xlBLACK) {
+        switch (sparkle % (208 - p.sparkleCount))
+        {
+        case 1:
+        case 7:
+            // too dim
+            //color.Set("#444444");
+            break;
+        case 2:
+        case 6:
+            color.Set(0x88, 0x88, 0x88);
+            break;
+        case 3:
+        case 5:
+            color.Set(0xbb, 0xbb, 0xbb);
+            break;
+        case 4:
+            color.Set(255, 255, 255);
+            break;
+        default:
+            break;
+        }
+        sparkle++;
+    }
 
-                float va;
-                if (thelayer->ValueAdjustValueCurve.IsActive()) {
-                    va = thelayer->ValueAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
-                } else {
-                    va = (float)thelayer->valueadjust / 100.0;
-                }
+    int b = p.brightness;
+    if (p.contrast != 0) {
+        //contrast is not 0, can handle brightness change at same time
+        HSVValue hsv = color.asHSV();
+        hsv.value = hsv.value * ((double)b / 100.0);
 
-                // adjust for HSV adjustments
-                if (ha != 0 || sa != 0 || va != 0) {
-                    HSVValue hsv = color.asHSV();
+        // Apply Contrast
+        if (hsv.value < 0.5) {
+            // reduce brightness when below 0.5 in the V value or increase if > 0.5
+            hsv.value = hsv.value - (hsv.value* ((double)p.contrast / 100.0));
+        } else {
+            hsv.value = hsv.value + (hsv.value* ((double)p.contrast / 100.0));
+        }
 
-                    if (ha != 0) {
-                        hsv.hue += ha;
-                        if (hsv.hue < 0) {
-                            hsv.hue += 1.0;
-                        } else if (hsv.hue > 1) {
-                            hsv.hue -= 1.0;
-                        }
-                    }
+        if (hsv.value < 0.0) hsv.value = 0.0;
+        if (hsv.value > 1.0) hsv.value = 1.0;
+        unsigned char alpha = color.Alpha();
+        color = hsv;
+        color.alpha = alpha;
+    } else if (b != 100) {
+        //just brightness
+        float ba = b;
+        ba /= 100.0f;
+        float f = color.red * ba;
+        color.red = std::min((int)f, 255);
+        f = color.green * ba;
+        color.green = std::min((int)f, 255);
+        f = color.blue * ba;
+        color.blue = std::min((int)f, 255);
+    }
+}
 
-                    if (sa != 0) {
-                        hsv.saturation += sa;
-                        if (hsv.saturation < 0) {
-                            hsv.saturation = 0.0;
-                        } else if (hsv.saturation > 1) {
-                            hsv.saturation = 1.0;
-                        }
-                    }
+// the first layer to reach a node is not mixed with anything
+static inline void StartLayerBlend(const LayerBlendParams& p, const xlColor& color, xlColor& c)
+{
+    if (p.fadeFactor != 1.0) {
+        //need to fade the first here as we're not mixing anything
+        HSVValue hsv = color.asHSV();
+        hsv.value *= p.fadeFactor;
+        if (color.alpha != 255) {
+            hsv.value *= color.alpha;
+            hsv.value /= 255.0f;
+        }
+        c = hsv;
+    } else {
+        c.AlphaBlendForgroundOnto(color);
+    }
+}
 
-                    if (va != 0) {
-                        hsv.value += va;
-                        if (hsv.value < 0) {
-                            hsv.value = 0.0;
-                        } else if (hsv.value > 1) {
-                            hsv.value = 1.0;
-                        }
-                    }
+void PixelBufferClass::PrepareLayerBlend(LayerInfo* thelayer, int EffectPeriod)
+{
+    int effStartPer, effEndPer;
+    thelayer->buffer.GetEffectPeriods(effStartPer, effEndPer);
+    float offset = ((float)(EffectPeriod - effStartPer)) / ((float)(effEndPer - effStartPer));
+    offset = std::min(offset, 1.0f);
 
-                    unsigned char alpha = color.Alpha();
-                    color = hsv;
-                    color.alpha = alpha;
-                }
+    LayerBlendParams& p = thelayer->blend;
+    //vary mix threshold gradually during effect interval -DJ
+    float threshold = thelayer->effectMixVaries ? thelayer->buffer.GetEffectTimeIntervalPosition() : thelayer->effectMixThreshold;
+    SetupLayerBlend(p, thelayer->mixType, thelayer->buffer.allowAlpha, thelayer->fadeFactor, threshold, thelayer->effectMixVaries, thelayer->BufferWi, thelayer->BufferHt);
 
-                // add sparkles
-                if (color != xlBLACK &&
-                    (thelayer->use_music_sparkle_count ||
-                        thelayer->sparkle_count > 0 ||
-                        thelayer->SparklesValueCurve.IsActive())) {
+    if (thelayer->HueAdjustValueCurve.IsActive()) {
+        p.hueAdjust = thelayer->HueAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
+    } else {
+        p.hueAdjust = (float)thelayer->hueadjust / 100.0;
+    }
+    if (thelayer->SaturationAdjustValueCurve.IsActive()) {
+        p.saturationAdjust = thelayer->SaturationAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
+    } else {
+        p.saturationAdjust = (float)thelayer->saturationadjust / 100.0;
+    }
+    if (thelayer->ValueAdjustValueCurve.IsActive()) {
+        p.valueAdjust = thelayer->ValueAdjustValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS()) / 100.0;
+    } else {
+        p.valueAdjust = (float)thelayer->valueadjust / 100.0;
+    }
 
-                    int sc = thelayer->sparkle_count;
-                    if (thelayer->SparklesValueCurve.IsActive()) {
-                        sc = (int)thelayer->SparklesValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS());
-                    }
-                    if (thelayer->use_music_sparkle_count) {
-                        sc = (int)(thelayer->music_sparkle_count_factor * (float)sc);
-                    }
+    p.sparkles = thelayer->use_music_sparkle_count ||
+        thelayer->sparkle_count > 0 ||
+        thelayer->SparklesValueCurve.IsActive();
+    p.sparkleCount = thelayer->sparkle_count;
+    if (thelayer->SparklesValueCurve.IsActive()) {
+        p.sparkleCount = (int)thelayer->SparklesValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS());
+    }
+    if (thelayer->use_music_sparkle_count) {
+        p.sparkleCount = (int)(thelayer->music_sparkle_count_factor * (float)p.sparkleCount);
+    }
 
-                    switch (sparkle % (208 - sc))
-                    {
-                    case 1:
-                    case 7:
-                        // too dim
-                        //color.Set("#444444");
-                        break;
-                    case 2:
-                    case 6:
-                        color.Set(0x88, 0x88, 0x88);
-                        break;
-                    case 3:
-                    case 5:
-                        color.Set(0xbb, 0xbb, 0xbb);
-                        break;
-                    case 4:
-                        color.Set(255, 255, 255);
-                        break;
-                    default:
-                        break;
-                    }
-                    sparkle++;
-                }
-                int b;
-                if (thelayer->BrightnessValueCurve.IsActive()) {
-                    b = (int)thelayer->BrightnessValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS());
-                } else {
-                    b = thelayer->brightness;
-                }
-                if (thelayer->contrast != 0) {
-                    //contrast is not 0, can handle brightness change at same time
-                    HSVValue hsv = color.asHSV();
-                    hsv.value = hsv.value * ((double)b / 100.0);
+    if (thelayer->BrightnessValueCurve.IsActive()) {
+        p.brightness = (int)thelayer->BrightnessValueCurve.GetOutputValueAt(offset, thelayer->buffer.GetStartTimeMS(), thelayer->buffer.GetEndTimeMS());
+    } else {
+        p.brightness = thelayer->brightness;
+    }
+    p.contrast = thelayer->contrast;
+}
 
-                    // Apply Contrast
-                    if (hsv.value < 0.5) {
-                        // reduce brightness when below 0.5 in the V value or increase if > 0.5
-                        hsv.value = hsv.value - (hsv.value* ((double)thelayer->contrast / 100.0));
-                    } else {
-                        hsv.value = hsv.value + (hsv.value* ((double)thelayer->contrast / 100.0));
-                    }
+// number of nodes mixed together, small enough that the working colours for all the layers stay in cache
+#define BLEND_ROW_SIZE 256
 
-                    if (hsv.value < 0.0) hsv.value = 0.0;
-                    if (hsv.value > 1.0) hsv.value = 1.0;
-                    unsigned char alpha = color.Alpha();
-                    color = hsv;
-                    color.alpha = alpha;
-                } else if (b != 100) {
-                    //just brightness
-                    float ba = b;
-                    ba /= 100.0f;
-                    float f = color.red * ba;
-                    color.red = std::min((int)f, 255);
-                    f = color.green * ba;
-                    color.green = std::min((int)f, 255);
-                    f = color.blue * ba;
-                    color.blue = std::min((int)f, 255);
+void PixelBufferClass::MixNodes(int start, int end, int saveLayer, const std::vector<bool> & validLayers)
+{
+    xlColor fg[BLEND_ROW_SIZE];
+    xlColor bg[BLEND_ROW_SIZE];
+    int xs[BLEND_ROW_SIZE];
+    int ys[BLEND_ROW_SIZE];
+    bool visible[BLEND_ROW_SIZE];
+
+    auto &outNodes = layers[saveLayer]->buffer.Nodes;
+    const NodeLayout &outLayout = layers[saveLayer]->buffer.nodeLayout;
+    std::vector<uint16_t> &sparkle = layers[0]->buffer.nodeLayout.sparkle;
+
+    for (int row = start; row < end; row += BLEND_ROW_SIZE) {
+        int count = std::min(BLEND_ROW_SIZE, end - row);
+        for (int i = 0; i < count; i++) {
+            visible[i] = outLayout.IsVisible(row + i);
+            bg[i] = xlBLACK;
+        }
+
+        // nodes below mixed already have a colour from a higher layer
+        int mixed = 0;
+        for (int layer = numLayers - 1; layer >= 0; layer--) {
+            if (!validLayers[layer]) {
+                continue;
+            }
+            LayerInfo* thelayer = layers[layer];
+            const NodeLayout &layout = thelayer->buffer.nodeLayout;
+            int n = std::min((int)layout.size() - row, count);
+            if (n <= 0) {
+                continue;
+            }
+            const LayerBlendParams& p = thelayer->blend;
+
+            for (int i = 0; i < n; i++) {
+                if (!visible[i]) {
+                    // unmapped pixel - its colour is thrown away
+                    fg[i] = xlBLACK;
+                    xs[i] = ys[i] = 0;
+                    continue;
                 }
+                uint32_t coord = layout.coordStart[row + i];
+                int x = layout.bufX[coord];
+                int y = layout.bufY[coord];
+                xs[i] = x;
+                ys[i] = y;
 
-                if (cnt > 0) {
-                    mixColors(x, y, color, c, layer);
-                } else if (thelayer->fadeFactor != 1.0) {
-                    //need to fade the first here as we're not mixing anything
-                    HSVValue hsv = color.asHSV();
-                    hsv.value *= thelayer->fadeFactor;
-                    if (color.alpha != 255) {
-                        hsv.value *= color.alpha;
-                        hsv.value /= 255.0f;
-                    }
-                    c = hsv;
+                if (thelayer->isMasked(x, y)
+                    || x < 0
+                    || y < 0
+                    || x >= thelayer->BufferWi
+                    || y >= thelayer->BufferHt
+                    ) {
+                    fg[i].Set(0, 0, 0, 0);
                 } else {
-                    c.AlphaBlendForgroundOnto(color);
+                    thelayer->buffer.GetPixel(x, y, fg[i]);
                 }
+                AdjustLayerColor(p, fg[i], sparkle[row + i]);
+            }
 
-                cnt++;
+            int blend = std::min(mixed, n);
+            if (blend > 0) {
+                p.blendRow(p, fg, bg, xs, ys, blend);
+            }
+            for (int i = blend; i < n; i++) {
+                StartLayerBlend(p, fg[i], bg[i]);
+            }
+            mixed = std::max(mixed, n);
+        }
+
+        for (int i = 0; i < count; i++) {
+            // set color for physical output, unmapped pixels are black
+            const xlColor &color = visible[i] ? bg[i] : xlBLACK;
+            outNodes[row + i]->SetColor(color);
+            if (saveLayer == 0) {
+                outputColors[row + i] = color;
             }
         }
     }
@@ -1254,20 +1483,35 @@ static void boxesForGauss(int d, int n, std::vector<float> &boxes)  // standard
     }
 }
 
-#define RED(a, b) a[(b)*4]
-#define GREEN(a, b) a[(b)*4 + 1]
-#define BLUE(a, b) a[(b)*4 + 2]
-#define ALPHA(a, b) a[(b)*4 + 3]
-static inline void SET(std::vector<float>& ar, int idx, float r, float g, float b, float a) {
-    idx *= 4;
-    ar[idx++] = r;
-    ar[idx++] = g;
-    ar[idx++] = b;
-    ar[idx] = a;
-}
+// Each pixel of the blur working buffers is 4 floats (red, green, blue, alpha) which are
+// carried through the box passes as one vector so all four channels are summed together
+#if defined(PIXELBUFFER_SIMD_AVX2) || defined(PIXELBUFFER_SIMD_SSE2)
+typedef __m128 BlurValue;
+static inline BlurValue BlurLoad(const float* p) { return _mm_loadu_ps(p); }
+static inline void BlurStore(float* p, BlurValue v) { _mm_storeu_ps(p, v); }
+static inline BlurValue BlurAdd(BlurValue a, BlurValue b) { return _mm_add_ps(a, b); }
+static inline BlurValue BlurSub(BlurValue a, BlurValue b) { return _mm_sub_ps(a, b); }
+static inline BlurValue BlurScale(BlurValue a, float s) { return _mm_mul_ps(a, _mm_set1_ps(s)); }
+#elif defined(PIXELBUFFER_SIMD_NEON)
+typedef float32x4_t BlurValue;
+static inline BlurValue BlurLoad(const float* p) { return vld1q_f32(p); }
+static inline void BlurStore(float* p, BlurValue v) { vst1q_f32(p, v); }
+static inline BlurValue BlurAdd(BlurValue a, BlurValue b) { return vaddq_f32(a, b); }
+static inline BlurValue BlurSub(BlurValue a, BlurValue b) { return vsubq_f32(a, b); }
+static inline BlurValue BlurScale(BlurValue a, float s) { return vmulq_n_f32(a, s); }
+#else
+struct BlurValue { float v[4]; };
+static inline BlurValue BlurLoad(const float* p) { BlurValue r; for (int i = 0; i < 4; i++) r.v[i] = p[i]; return r; }
+static inline void BlurStore(float* p, BlurValue v) { for (int i = 0; i < 4; i++) p[i] = v.v[i]; }
+static inline BlurValue BlurAdd(BlurValue a, BlurValue b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline BlurValue BlurSub(BlurValue a, BlurValue b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+static inline BlurValue BlurScale(BlurValue a, float s) { for (int i = 0; i < 4; i++) a.v[i] *= s; return a; }
+#endif
 
 static void boxBlurH_4 (const std::vector<float>& scl, std::vector<float>& tcl, int w, int h, float r) {
     float iarr = 1.0f / (r+r+1.0f);
+    const float* s = &scl[0];
+    float* t = &tcl[0];
     for(int i=0; i<h; i++) {
         int ti = i*w;
         int li = ti;
@@ -1276,143 +1520,109 @@ static void boxBlurH_4 (const std::vector<float>& scl, std::vector<float>& tcl,
         int fvIdx = ti;
         int lvIdx = ti+w-1;
 
-        float valr = (r+1.0) * RED(scl,fvIdx);
-        float valg = (r+1.0) * GREEN(scl,fvIdx);
-        float valb = (r+1.0) * BLUE(scl,fvIdx);
-        float vala = (r+1.0) * ALPHA(scl,fvIdx);
-
-        float fvRed = RED(scl, fvIdx);
-        float fvGreen = GREEN(scl, fvIdx);
-        float fvBlue = BLUE(scl, fvIdx);
-        float fvAlpha = ALPHA(scl, fvIdx);
-        float lvRed = RED(scl, lvIdx);
-        float lvGreen = GREEN(scl, lvIdx);
-        float lvBlue = BLUE(scl, lvIdx);
-        float lvAlpha = ALPHA(scl, lvIdx);
+        BlurValue fv = BlurLoad(s + fvIdx * 4);
+        BlurValue lv = BlurLoad(s + lvIdx * 4);
+        BlurValue val = BlurScale(fv, r + 1.0f);
 
         for (int j=0; j<r; j++) {
             int idx = j < w ? ti+j : lvIdx;
-            valr += RED(scl, idx);
-            valg += GREEN(scl, idx);
-            valb += BLUE(scl, idx);
-            vala += ALPHA(scl, idx);
+            val = BlurAdd(val, BlurLoad(s + idx * 4));
         }
         for (int j=0  ; j<=r ; j++) {
             int idx = ri <= maxri ? ri++ : lvIdx;
-            valr += RED(scl, idx) - fvRed;
-            valg += GREEN(scl, idx) - fvGreen;
-            valb += BLUE(scl, idx) - fvBlue;
-            vala += ALPHA(scl, idx) - fvAlpha;
-
+            val = BlurAdd(val, BlurSub(BlurLoad(s + idx * 4), fv));
             if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                BlurStore(t + ti * 4, BlurScale(val, iarr));
                 ti++;
             }
         }
         for (int j=r+1; j<w-r; j++) {
             int c = ri <= maxri ? ri++ : lvIdx;
             int c2 = li <= maxri ? li++ : lvIdx;
-            valr += RED(scl, c) - RED(scl, c2);
-            valg += GREEN(scl, c) - GREEN(scl, c2);
-            valb += BLUE(scl, c) - BLUE(scl, c2);
-            vala += ALPHA(scl, c) - ALPHA(scl, c2);
+            val = BlurAdd(val, BlurSub(BlurLoad(s + c * 4), BlurLoad(s + c2 * 4)));
             if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                BlurStore(t + ti * 4, BlurScale(val, iarr));
                 ti++;
             }
         }
-
         for (int j=w-r; j<w  ; j++) {
             int c2 = li <= maxri ? li++: lvIdx;
-            valr += lvRed - RED(scl, c2);
-            valg += lvGreen - GREEN(scl, c2);
-            valb += lvBlue - BLUE(scl, c2);
-            vala += lvAlpha - ALPHA(scl, c2);
+            val = BlurAdd(val, BlurSub(lv, BlurLoad(s + c2 * 4)));
             if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
+                BlurStore(t + ti * 4, BlurScale(val, iarr));
                 ti++;
             }
         }
     }
 }
 
+// The vertical pass keeps a running total for every column and sweeps down the rows so
+// the buffer is read in memory order rather than a column at a time
 static void boxBlurT_4 (const std::vector<float>& scl, std::vector<float>& tcl, int w, int h, float r) {
     float iarr = 1.0f / (r+r+1.0f);
-    for(int i=0; i<w; i++) {
-        int ti = i;
-        int li = ti;
-        int ri = ti+r*w;
+    const float* s = &scl[0];
+    float* t = &tcl[0];
+    const int rowSize = w * 4;
+    const int maxRow = h - 1;
+    const float* fv = s;
+    const float* lv = s + maxRow * rowSize;
 
-        int maxri = ti+w*(h-1);
+    std::vector<float> acc(rowSize);
+    float* val = &acc[0];
+    for (int x = 0; x < rowSize; x += 4) {
+        BlurStore(val + x, BlurScale(BlurLoad(fv + x), r + 1));
+    }
 
-        int fvIdx = ti;
-        int lvIdx = ti+w*(h-1);
-
-        float fvRed = RED(scl, fvIdx);
-        float fvGreen = GREEN(scl, fvIdx);
-        float fvBlue = BLUE(scl, fvIdx);
-        float fvAlpha = ALPHA(scl, fvIdx);
-        float lvRed = RED(scl, lvIdx);
-        float lvGreen = GREEN(scl, lvIdx);
-        float lvBlue = BLUE(scl, lvIdx);
-        float lvAlpha = ALPHA(scl, lvIdx);
-
-        float valr = (r+1)*fvRed;
-        float valg = (r+1)*fvGreen;
-        float valb = (r+1)*fvBlue;
-        float vala = (r+1)*fvAlpha;
-
-        for(int j=0; j<r; j++) {
-            int idx = j < w ? ti+j*w : lvIdx;
-            valr += RED(scl, idx);
-            valg += GREEN(scl, idx);
-            valb += BLUE(scl, idx);
-            vala += ALPHA(scl, idx);
-        }
-        for(int j=0  ; j<=r ; j++) {
-            int idx = ri <= maxri ? ri : lvIdx;
-            valr += RED(scl, idx) - fvRed;
-            valg += GREEN(scl, idx) - fvGreen;
-            valb += BLUE(scl, idx) - fvBlue;
-            vala += ALPHA(scl, idx) - fvAlpha;
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-            }
-            ri+=w;
-            ti+=w;
-        }
-        for(int j=r+1; j<h-r; j++) {
-            int c = ri <= maxri ? ri : lvIdx;
-            int c2 = li <= maxri ? li : lvIdx;
-            valr += RED(scl, c) - RED(scl, c2);
-            valg += GREEN(scl, c) - GREEN(scl, c2);
-            valb += BLUE(scl, c) - BLUE(scl, c2);
-            vala += ALPHA(scl, c) - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-            }
-            li+=w; ri+=w; ti+=w;
-        }
-        for(int j=h-r; j<h  ; j++) {
-            int c2 = li <= maxri ? li : lvIdx;
-            valr += lvRed - RED(scl, c2);
-            valg += lvGreen - GREEN(scl, c2);
-            valb += lvBlue - BLUE(scl, c2);
-            vala += lvAlpha - ALPHA(scl, c2);
-            if (ti <= maxri) {
-                SET(tcl, ti, valr*iarr, valg*iarr, valb*iarr, vala*iarr);
-            }
-            li += w;
-            ti += w;
+    for(int j=0; j<r; j++) {
+        const float* src = s + (j < w ? j : maxRow) * rowSize;
+        for (int x = 0; x < rowSize; x += 4) {
+            BlurStore(val + x, BlurAdd(BlurLoad(val + x), BlurLoad(src + x)));
+        }
+    }
+
+    int ti = 0;
+    int li = 0;
+    int ri = r;
+    for(int j=0  ; j<=r ; j++) {
+        const float* src = s + (ri <= maxRow ? ri : maxRow) * rowSize;
+        float* dst = ti <= maxRow ? t + ti * rowSize : nullptr;
+        for (int x = 0; x < rowSize; x += 4) {
+            BlurValue v = BlurAdd(BlurLoad(val + x), BlurSub(BlurLoad(src + x), BlurLoad(fv + x)));
+            BlurStore(val + x, v);
+            if (dst != nullptr) BlurStore(dst + x, BlurScale(v, iarr));
         }
+        ri++;
+        ti++;
+    }
+    for(int j=r+1; j<h-r; j++) {
+        const float* src = s + (ri <= maxRow ? ri : maxRow) * rowSize;
+        const float* src2 = s + (li <= maxRow ? li : maxRow) * rowSize;
+        float* dst = ti <= maxRow ? t + ti * rowSize : nullptr;
+        for (int x = 0; x < rowSize; x += 4) {
+            BlurValue v = BlurAdd(BlurLoad(val + x), BlurSub(BlurLoad(src + x), BlurLoad(src2 + x)));
+            BlurStore(val + x, v);
+            if (dst != nullptr) BlurStore(dst + x, BlurScale(v, iarr));
+        }
+        li++; ri++; ti++;
+    }
+    for(int j=h-r; j<h  ; j++) {
+        const float* src2 = s + (li <= maxRow ? li : maxRow) * rowSize;
+        float* dst = ti <= maxRow ? t + ti * rowSize : nullptr;
+        for (int x = 0; x < rowSize; x += 4) {
+            BlurValue v = BlurAdd(BlurLoad(val + x), BlurSub(BlurLoad(lv + x), BlurLoad(src2 + x)));
+            BlurStore(val + x, v);
+            if (dst != nullptr) BlurStore(dst + x, BlurScale(v, iarr));
+        }
+        li++;
+        ti++;
     }
 }
 
+// Blurs scl into tcl. scl is used as scratch space so it is left holding the horizontal pass.
 static void boxBlur_4(std::vector<float>& scl, std::vector<float>& tcl, int w, int h, float r, int size) {
-    tcl = scl;
-    //memcpy(tcl, scl, sizeof(float)*4*size);
-    boxBlurH_4(tcl, scl, w, h, r);
-    boxBlurT_4(scl, tcl, w, h, r);
+    boxBlurH_4(scl, tcl, w, h, r);
+    boxBlurT_4(tcl, scl, w, h, r);
+    std::swap(scl, tcl);
 }
 
 static void gaussBlur_4(std::vector<float>& scl, std::vector<float>& tcl, int w, int h, int r, int size) {
@@ -1944,6 +2154,7 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap &settingsMa
         int curBH = inf->BufferHt;
         int curBW = inf->BufferWi;
         ComputeSubBuffer(subBuffer, inf->buffer.Nodes, inf->BufferWi, inf->BufferHt, 0, inf->buffer.GetStartTimeMS(), inf->buffer.GetEndTimeMS());
+        inf->buffer.nodeLayout.Build(inf->buffer.Nodes);
 
         curBH = std::max(curBH, inf->BufferHt);
         curBW = std::max(curBW, inf->BufferWi);
@@ -2106,32 +2317,57 @@ static inline bool IsInRange(const std::vector<bool> &restrictRange, size_t star
 
 void PixelBufferClass::GetColors(unsigned char *fdata, const std::vector<bool> &restrictRange) {
 
-    // KW ... I think this needs to be optimised
-
     if (layers[0] != nullptr) { // I dont like this ... it should never be null
-        for (auto &n : layers[0]->buffer.Nodes) {
-            size_t start = n->ActChan;
-            if (IsInRange(restrictRange, start)) {
-                if (n->model != nullptr) { // nor this
-                    DimmingCurve *curve = n->model->modelDimmingCurve;
-                    if (curve != nullptr) {
-                        if (n->GetChanCount() == 1) {
-                            uint8_t buf[3];
-                            n->GetForChannels(buf);
-                            xlColor color(buf[0], buf[0], buf[0]);
-                            curve->apply(color);
-
-                            n->SetColor(color);
-                        } else {
-                            xlColor color;
-                            n->GetColor(color);
-                            curve->apply(color);
-                            n->SetColor(color);
-                        }
+        auto &nodes = layers[0]->buffer.Nodes;
+        const NodeLayout &layout = layers[0]->buffer.nodeLayout;
+        // the colours from CalcOutput and the node layout let most nodes be written without touching the node objects
+        bool useLayout = outputColorsValid && layout.size() == nodes.size() && outputColors.size() == nodes.size();
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            size_t start = useLayout ? layout.startChannel[i] : nodes[i]->ActChan;
+            if (!IsInRange(restrictRange, start)) {
+                continue;
+            }
+            if (useLayout && layout.direct[i]) {
+                const uint8_t *offsets = &layout.channelOffsets[i * 3];
+                const xlColor &c = outputColors[i];
+                xlColor color(c.red, c.green, c.blue);
+                const Model *m = layout.models[i];
+                DimmingCurve *curve = m != nullptr ? m->modelDimmingCurve : nullptr;
+                if (curve != nullptr) {
+                    if (layout.channelCount[i] == 1) {
+                        uint8_t v = offsets[0] == 0 ? color.red : (offsets[1] == 0 ? color.green : color.blue);
+                        color.Set(v, v, v);
+                    }
+                    curve->apply(color);
+                }
+                unsigned char *buf = &fdata[start];
+                if (offsets[0] != 255) buf[offsets[0]] = color.red;
+                if (offsets[1] != 255) buf[offsets[1]] = color.green;
+                if (offsets[2] != 255) buf[offsets[2]] = color.blue;
+                continue;
+            }
+
+            auto &n = nodes[i];
+            if (n->model != nullptr) { // nor this
+                DimmingCurve *curve = n->model->modelDimmingCurve;
+                if (curve != nullptr) {
+                    if (n->GetChanCount() == 1) {
+                        uint8_t buf[3];
+                        n->GetForChannels(buf);
+                        xlColor color(buf[0], buf[0], buf[0]);
+                        curve->apply(color);
+
+                        n->SetColor(color);
+                    } else {
+                        xlColor color;
+                        n->GetColor(color);
+                        curve->apply(color);
+                        n->SetColor(color);
                     }
                 }
-                n->GetForChannels(&fdata[start]);
             }
+            n->GetForChannels(&fdata[start]);
         }
     }
 }
@@ -2140,8 +2376,31 @@ void PixelBufferClass::SetColors(int layer, const unsigned char *fdata)
 {
     if (layer >= layers.size()) return;
 
+    RenderBuffer &buffer = layers[layer]->buffer;
+    const NodeLayout &layout = buffer.nodeLayout;
+    bool useLayout = layout.size() == buffer.Nodes.size();
+
     xlColor color;
-    for (const auto &n : layers[layer]->buffer.Nodes) {
+    for (size_t i = 0; i < buffer.Nodes.size(); i++) {
+        if (useLayout && layout.direct[i]) {
+            const uint8_t *offsets = &layout.channelOffsets[i * 3];
+            const unsigned char *buf = &fdata[layout.startChannel[i]];
+            color.Set(offsets[0] != 255 ? buf[offsets[0]] : 0,
+                      offsets[1] != 255 ? buf[offsets[1]] : 0,
+                      offsets[2] != 255 ? buf[offsets[2]] : 0);
+
+            const Model *m = layout.models[i];
+            DimmingCurve *curve = m != nullptr ? m->modelDimmingCurve : nullptr;
+            if (curve != nullptr) {
+                curve->reverse(color);
+            }
+            for (uint32_t c = layout.coordStart[i]; c < layout.coordStart[i + 1]; c++) {
+                buffer.SetPixel(layout.bufX[c], layout.bufY[c], color);
+            }
+            continue;
+        }
+
+        auto &n = buffer.Nodes[i];
         size_t start = n->ActChan;
 
         n->SetFromChannels(&fdata[start]);
@@ -2152,7 +2411,88 @@ void PixelBufferClass::SetColors(int layer, const unsigned char *fdata)
             curve->reverse(color);
         }
         for (const auto &a : n->Coords) {
-            layers[layer]->buffer.SetPixel(a.bufX, a.bufY, color);
+            buffer.SetPixel(a.bufX, a.bufY, color);
+        }
+    }
+}
+
+// Writes a pixel the way RenderBuffer::SetPixel does without the call overhead for every pixel
+static inline void PutPixel(RenderBuffer& buffer, int x, int y, const xlColor& c)
+{
+    if (buffer.IsDmxBuffer())
+    {
+        buffer.SetPixel(x, y, c);
+    }
+    else if (x >= 0 && x < buffer.BufferWi && y >= 0 && y < buffer.BufferHt && y * buffer.BufferWi + x < buffer.pixels.size())
+    {
+        buffer.pixels[y * buffer.BufferWi + x] = c;
+    }
+}
+
+// Plots count roto zoom samples which share an x position. The sample positions are u0 + uy[k], v0 + vy[k]
+// and the source colour of sample k is column[k / q]. Samples are written in order so overlaps resolve as before.
+static void RotoZoomSamples(RenderBuffer& buffer, float u0, float v0, const float* uy, const float* vy, int count, int q, const xlColor* column, float wi, float ht)
+{
+    int k = 0;
+#if defined(PIXELBUFFER_SIMD_AVX2) || defined(PIXELBUFFER_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 u0v = _mm_set1_ps(u0);
+    const __m128 v0v = _mm_set1_ps(v0);
+    const __m128 wiv = _mm_set1_ps(wi);
+    const __m128 htv = _mm_set1_ps(ht);
+    for (; k + 4 <= count; k += 4)
+    {
+        __m128 u = _mm_add_ps(u0v, _mm_loadu_ps(uy + k));
+        __m128 v = _mm_add_ps(v0v, _mm_loadu_ps(vy + k));
+        __m128 in = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmplt_ps(u, wiv)),
+                               _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmplt_ps(v, htv)));
+        int mask = _mm_movemask_ps(in);
+        if (mask != 0)
+        {
+            int32_t iu[4];
+            int32_t iv[4];
+            _mm_storeu_si128((__m128i*)iu, _mm_cvttps_epi32(u));
+            _mm_storeu_si128((__m128i*)iv, _mm_cvttps_epi32(v));
+            for (int l = 0; l < 4; l++)
+            {
+                if (mask & (1 << l)) PutPixel(buffer, iu[l], iv[l], column[(k + l) / q]);
+            }
+        }
+    }
+#elif defined(PIXELBUFFER_SIMD_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t u0v = vdupq_n_f32(u0);
+    const float32x4_t v0v = vdupq_n_f32(v0);
+    const float32x4_t wiv = vdupq_n_f32(wi);
+    const float32x4_t htv = vdupq_n_f32(ht);
+    for (; k + 4 <= count; k += 4)
+    {
+        float32x4_t u = vaddq_f32(u0v, vld1q_f32(uy + k));
+        float32x4_t v = vaddq_f32(v0v, vld1q_f32(vy + k));
+        uint32x4_t in = vandq_u32(vandq_u32(vcgeq_f32(u, zero), vcltq_f32(u, wiv)),
+                                  vandq_u32(vcgeq_f32(v, zero), vcltq_f32(v, htv)));
+        uint32_t mask[4];
+        int32_t iu[4];
+        int32_t iv[4];
+        vst1q_u32(mask, in);
+        vst1q_s32(iu, vcvtq_s32_f32(u));
+        vst1q_s32(iv, vcvtq_s32_f32(v));
+        for (int l = 0; l < 4; l++)
+        {
+            if (mask[l] != 0) PutPixel(buffer, iu[l], iv[l], column[(k + l) / q]);
+        }
+    }
+#endif
+    for (; k < count; k++)
+    {
+        float u = u0 + uy[k];
+        if (u >= 0 && u < wi)
+        {
+            float v = v0 + vy[k];
+            if (v >= 0 && v < ht)
+            {
+                PutPixel(buffer, u, v, column[k / q]);
+            }
         }
     }
 }
@@ -2181,21 +2521,31 @@ void PixelBufferClass::RotateX(LayerInfo* layer, float offset)
         float sine = sin((xrotation + 90) * M_PI / 180);
         float pivot = xpivot * layer->buffer.BufferWi / 100;
 
+        // work out where each column lands once and then go a row at a time. Columns are
+        // still visited in the same order within each row so overlapping columns resolve as before.
+        std::vector<int> fromx;
+        std::vector<int> tox;
+        fromx.reserve(layer->buffer.BufferWi);
+        tox.reserve(layer->buffer.BufferWi);
         for (int x = pivot; x < layer->buffer.BufferWi; ++x)
         {
-            float tox = sine * (x - pivot) + pivot;
-            for (int y = 0; y < layer->buffer.BufferHt; ++y)
-            {
-                layer->buffer.SetPixel(tox, y, orig.GetPixel(x, y));
-            }
+            float to = sine * (x - pivot) + pivot;
+            fromx.push_back(x);
+            tox.push_back(to);
         }
 
         for (int x = pivot - 1; x >= 0; --x)
         {
-            float tox = -1 * sine * (pivot - x) + pivot;
-            for (int y = 0; y < layer->buffer.BufferHt; ++y)
+            float to = -1 * sine * (pivot - x) + pivot;
+            fromx.push_back(x);
+            tox.push_back(to);
+        }
+
+        for (int y = 0; y < layer->buffer.BufferHt; ++y)
+        {
+            for (size_t i = 0; i < fromx.size(); ++i)
             {
-                layer->buffer.SetPixel(tox, y, orig.GetPixel(x, y));
+                PutPixel(layer->buffer, tox[i], y, orig.GetPixel(fromx[i], y));
             }
         }
     }
@@ -2229,7 +2579,7 @@ void PixelBufferClass::RotateY(LayerInfo* layer, float offset)
             float toy = sine * (y - pivot) + pivot;
             for (int x = 0; x < layer->buffer.BufferWi; ++x)
             {
-                layer->buffer.SetPixel(x, toy, orig.GetPixel(x, y));
+                PutPixel(layer->buffer, x, toy, orig.GetPixel(x, y));
             }
         }
 
@@ -2238,7 +2588,7 @@ void PixelBufferClass::RotateY(LayerInfo* layer, float offset)
             float toy = -1 * sine * (pivot - y) + pivot;
             for (int x = 0; x < layer->buffer.BufferWi; ++x)
             {
-                layer->buffer.SetPixel(x, toy, orig.GetPixel(x, y));
+                PutPixel(layer->buffer, x, toy, orig.GetPixel(x, y));
             }
         }
     }
@@ -2280,7 +2630,6 @@ void PixelBufferClass::RotateZAndZoom(LayerInfo* layer, float offset)
     if (rotation != 0.0 || zoom != 1.0)
     {
         static const float PI_2 = 6.283185307f;
-        xlColor c;
         RenderBuffer orig(layer->buffer);
         int q = layer->zoomquality;
         int cx = layer->pivotpointx;
@@ -2302,29 +2651,45 @@ void PixelBufferClass::RotateZAndZoom(LayerInfo* layer, float offset)
         float anglesin = sin(-angle);
 
         layer->buffer.Clear();
+        if (q < 1 || layer->BufferWi <= 0 || layer->BufferHt <= 0) return;
+
+        // u and v are split into the part which depends on x and the part which depends on y
+        // so each is worked out once per frame rather than once per sample
+        int wq = layer->BufferWi * q;
+        int hq = layer->BufferHt * q;
+        std::vector<float> ux(wq);
+        std::vector<float> vx(wq);
+        std::vector<float> uy(hq);
+        std::vector<float> vy(hq);
         for (int x = 0; x < layer->BufferWi; x++)
         {
             for (int i = 0; i < q; i++)
             {
-                for (int y = 0; y < layer->BufferHt; y++)
-                {
-                    orig.GetPixel(x, y, c);
-                    for (int j = 0; j < q; j++)
-                    {
-                        float xx = (float)x + ((float)i * inc) - xoff;
-                        float yy = (float)y + ((float)j * inc) - yoff;
-                        float u = xoff + anglecos * xx * zoom + anglesin * yy * zoom;
-                        if (u >= 0 && u < layer->BufferWi)
-                        {
-                            float v = yoff + -anglesin * xx * zoom + anglecos * yy * zoom;
+                float xx = (float)x + ((float)i * inc) - xoff;
+                ux[x * q + i] = xoff + anglecos * xx * zoom;
+                vx[x * q + i] = yoff + -anglesin * xx * zoom;
+            }
+        }
+        for (int y = 0; y < layer->BufferHt; y++)
+        {
+            for (int j = 0; j < q; j++)
+            {
+                float yy = (float)y + ((float)j * inc) - yoff;
+                uy[y * q + j] = anglesin * yy * zoom;
+                vy[y * q + j] = anglecos * yy * zoom;
+            }
+        }
 
-                            if (v >= 0 && v < layer->BufferHt)
-                            {
-                                layer->buffer.SetPixel(u, v, c);
-                            }
-                        }
-                    }
-                }
+        std::vector<xlColor> column(layer->BufferHt);
+        for (int x = 0; x < layer->BufferWi; x++)
+        {
+            for (int y = 0; y < layer->BufferHt; y++)
+            {
+                orig.GetPixel(x, y, column[y]);
+            }
+            for (int i = 0; i < q; i++)
+            {
+                RotoZoomSamples(layer->buffer, ux[x * q + i], vx[x * q + i], &uy[0], &vy[0], hq, q, &column[0], layer->BufferWi, layer->BufferHt);
             }
         }
     }
@@ -2389,6 +2754,7 @@ void PixelBufferClass::PrepareVariableSubBuffer(int EffectPeriod, int layer)
     layers[layer]->buffer.Nodes.clear();
     model->InitRenderBufferNodes(type, camera, transform, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt);
     ComputeSubBuffer(subBuffer, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt, offset, layers[layer]->buffer.GetStartTimeMS(), layers[layer]->buffer.GetEndTimeMS());
+    layers[layer]->buffer.nodeLayout.Build(layers[layer]->buffer.Nodes);
     layers[layer]->buffer.BufferWi = layers[layer]->BufferWi;
     layers[layer]->buffer.BufferHt = layers[layer]->BufferHt;
 
@@ -2424,9 +2790,9 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
         if (layers[ii]->use_music_sparkle_count &&
             layers[ii]->buffer.GetMedia() != nullptr) {
             float f = 0.0;
-            std::list<float>* pf = layers[ii]->buffer.GetMedia()->GetFrameData(layers[ii]->buffer.curPeriod, FRAMEDATA_HIGH, "");
-            if (pf != nullptr) {
-                f = *pf->begin();
+            FrameDataSpan pf = layers[ii]->buffer.GetMedia()->GetFrameData(layers[ii]->buffer.curPeriod, FRAMEDATA_HIGH, "");
+            if (!pf.empty()) {
+                f = pf.front();
             }
             layers[ii]->music_sparkle_count_factor = f;
         } else {
@@ -2485,8 +2851,18 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
         }
     }
 
+    // work out everything about each layers blend that does not change from node to node
+    for (int layer = 0; layer < numLayers; layer++) {
+        if (validLayers[layer]) {
+            PrepareLayerBlend(layers[layer], EffectPeriod);
+        }
+    }
+
     // layer calculation and map to output
     size_t NodeCount = layers[0]->buffer.Nodes.size();
+    if (saveLayer == 0) {
+        outputColors.resize(NodeCount);
+    }
     int countValid = 0;
     for (auto x : validLayers) {
         if (x) {
@@ -2501,20 +2877,8 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
     if (countValid == test) {
         for (int vvv = 1000; vvv < (NodeCount + 1000); vvv += 1000) {
             wxStopWatch timer;
-            parallel_for(0, NodeCount, [this, saveLayer, &validLayers, EffectPeriod] (int i) {
-                if (!layers[saveLayer]->buffer.Nodes[i]->IsVisible()) {
-                    // unmapped pixel - set to black
-                    layers[saveLayer]->buffer.Nodes[i]->SetColor(xlBLACK);
-                } else {
-                    // get blend of two effects
-                    xlColor color;
-                    GetMixedColor(i,
-                                  color,
-                                  validLayers, EffectPeriod);
-
-                    // set color for physical output
-                    layers[saveLayer]->buffer.Nodes[i]->SetColor(color);
-                }
+            parallel_for_range(0, NodeCount, [this, saveLayer, &validLayers] (int start, int end) {
+                MixNodes(start, end, saveLayer, validLayers);
             }, vvv);
             printf("%d\t%d\t%lld\n", test, vvv, timer.TimeInMicro());
         }
@@ -2522,21 +2886,10 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool> & va
     }
     */
 
-    parallel_for(0, NodeCount, [this, saveLayer, &validLayers, EffectPeriod] (int i) {
-        if (!layers[saveLayer]->buffer.Nodes[i]->IsVisible()) {
-            // unmapped pixel - set to black
-            layers[saveLayer]->buffer.Nodes[i]->SetColor(xlBLACK);
-        } else {
-            // get blend of two effects
-            xlColor color;
-            GetMixedColor(i,
-                          color,
-                          validLayers, EffectPeriod);
-
-            // set color for physical output
-            layers[saveLayer]->buffer.Nodes[i]->SetColor(color);
-        }
+    parallel_for_range(0, NodeCount, [this, saveLayer, &validLayers] (int start, int end) {
+        MixNodes(start, end, saveLayer, validLayers);
     }, blockSize);
+    outputColorsValid = (saveLayer == 0);
 }
 
 static int DecodeType(const std::string &type)
@@ -84,6 +84,39 @@ enum MixTypes
     Mix_Min
 };
 
+struct LayerBlendParams;
+
+/**
+ * \brief blends a row of foreground colours onto the matching background colours, x and y are the buffer coordinates of each pixel
+ */
+typedef void (*LayerBlendFunction)(const LayerBlendParams& params, xlColor* fg, xlColor* bg, const int* x, const int* y, int count);
+
+/**
+ * \brief per layer mixing state which is constant for a whole frame so it is worked out once before any pixels are mixed
+ */
+struct LayerBlendParams
+{
+    MixTypes mixType = Mix_Normal;
+    LayerBlendFunction blendRow = nullptr;
+    double fadeFactor = 1.0;
+    bool fadeForeground = false; // the layer has no alpha channel so the fade is applied to the colour before mixing
+    float threshold = 0.0f;      // effect mix threshold for this frame
+    int valueCutoff = 0;         // a colour is above the threshold when max(r, g, b) >= valueCutoff
+    double emt = 1.0;            // effect 1/2 cross fade levels
+    double emtNot = 0.0;
+    int halfWi = 0;
+    int halfHt = 0;
+
+    // colour adjustments
+    float hueAdjust = 0.0f;
+    float saturationAdjust = 0.0f;
+    float valueAdjust = 0.0f;
+    bool sparkles = false;
+    int sparkleCount = 0;
+    int brightness = 100;
+    int contrast = 0;
+};
+
 class Effect;
 class SequenceElements;
 class SettingsMap;
@@ -215,6 +248,7 @@ private:
         float outMaskFactor;
         bool usingModelBuffers;
         std::vector<std::unique_ptr<RenderBuffer>> modelBuffers;
+        LayerBlendParams blend;
 
         std::vector<uint8_t> mask;
         void renderTransitions(bool isFirstFrame, const RenderBuffer* prevRB);
@@ -240,16 +274,19 @@ private:
     int numLayers;
     std::vector<LayerInfo*> layers;
     int frameTimeInMs;
+    std::vector<xlColor> outputColors; // mixed colour of each output node from the last CalcOutput
+    bool outputColorsValid;
 
     //both fg and bg may be modified, bg will contain the new, mixed color to be the bg for the next mix
     void mixColors(const wxCoord &x, const wxCoord &y, xlColor &fg, xlColor &bg, int layer);
+    void PrepareLayerBlend(LayerInfo* layer, int EffectPeriod);
+    void MixNodes(int start, int end, int saveLayer, const std::vector<bool> &validLayers);
     void reset(int layers, int timing, bool isNode = false);
 	void Blur(LayerInfo* layer, float offset);
     void RotoZoom(LayerInfo* layer, float offset);
     void RotateX(LayerInfo* layer, float offset);
     void RotateY(LayerInfo* layer, float offset);
     void RotateZAndZoom(LayerInfo* layer, float offset);
-    void GetMixedColor(int node, xlColor& c, const std::vector<bool> & validLayers, int EffectPeriod);
 
     std::string modelName;
     std::string lastBufferType;
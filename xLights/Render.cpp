@@ -7,6 +7,7 @@
 #include "xLightsXmlFile.h"
 #include "RenderCommandEvent.h"
 #include "effects/RenderableEffect.h"
+#include "effects/ImageCache.h"
 #include "RenderProgressDialog.h"
 #include "SeqExportDialog.h"
 #include "RenderUtils.h"
@@ -824,6 +825,8 @@ private:
                          SettingsMap& settingsMap) {
         settingsMap.clear();
         effect->CopySettingsMap(settingsMap, true);
+        // parse the settings once here rather than every frame
+        settingsMap.SetParameterBlock(std::make_shared<EffectParameterBlock>(settingsMap));
     }
 
     ModelElement *rowToRender;
@@ -1123,17 +1126,6 @@ public:
         ranges.push_back(NodeRange(start, end));
     }
 
-    bool Overlaps(RenderTreeData &e) {
-        for (auto it = ranges.begin(); it != ranges.end(); ++it) {
-            for (auto it2 = e.ranges.begin(); it2 != e.ranges.end(); ++it2) {
-                if (it->Overlaps(*it2)) {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-
     static void sortRanges(std::list<NodeRange> &ranges) {
         ranges.sort();
         auto it = ranges.begin();
@@ -1173,21 +1165,49 @@ void xLightsFrame::RenderTree::Clear() {
         delete *it;
     }
     data.clear();
+    index.Clear();
+    byName.clear();
 }
 
 void xLightsFrame::RenderTree::Add(Model *el) {
     RenderTreeData *elData = new RenderTreeData(el);
-    for (auto it = data.begin(); it != data.end(); ++it) {
-        RenderTreeData *elData2 = *it;
-        if (elData2->Overlaps(*elData)) {
-            elData->Add(elData2->model);
-            elData2->Add(el);
-        }
+    int owner = data.size();
+    for (auto it = elData->ranges.begin(); it != elData->ranges.end(); ++it) {
+        index.Add(*it, owner);
     }
-    elData->Add(el);
+    byName.emplace(el->GetName(), elData);
     data.push_back(elData);
 }
 
+void xLightsFrame::RenderTree::Build() {
+    index.Build();
+
+    std::vector<RenderTreeData*> byOwner(data.begin(), data.end());
+    std::vector<int> owners;
+    for (size_t x = 0; x < byOwner.size(); ++x) {
+        RenderTreeData *elData = byOwner[x];
+        owners.clear();
+        index.GetOverlappingOwners(elData->ranges, owners);
+        if (owners.empty()) {
+            // no channels, it still needs to render itself
+            owners.push_back(x);
+        }
+        // owners are sorted so this matches the order the models were added
+        elData->renderOrder.clear();
+        for (auto o : owners) {
+            elData->Add(byOwner[o]->model);
+        }
+    }
+}
+
+RenderTreeData *xLightsFrame::RenderTree::Find(const std::string &modelName) const {
+    auto it = byName.find(modelName);
+    if (it == byName.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
 void xLightsFrame::RenderTree::Print() {
     static log4cpp::Category &logger_render = log4cpp::Category::getInstance(std::string("log_render"));
     logger_render.debug("========== RENDER TREE");
@@ -1220,6 +1240,7 @@ void xLightsFrame::BuildRenderTree() {
                 }
             }
         }
+        renderTree.Build();
         renderTree.Print();
         renderTree.renderTreeChangeCount = curChangeCount;
     }
@@ -1253,7 +1274,8 @@ void xLightsFrame::Render(const std::list<Model*> models,
     int numRows = models.size();
     RenderJob **jobs = new RenderJob*[numRows];
     AggregatorRenderer **aggregators = new AggregatorRenderer*[numRows];
-    std::vector<std::set<int>> channelMaps(SeqData.NumChannels());
+    NodeRangeIndex channelIndex;
+    unsigned int numChannels = SeqData.NumChannels();
 
     size_t row = 0;
     for (auto it = models.begin(); it != models.end(); ++it, ++row) {
@@ -1296,20 +1318,10 @@ void xLightsFrame::Render(const std::list<Model*> models,
                     aggregators[row]->addNext(job);
                     size_t cn = buffer->GetChanCountPerNode();
                     for (int node = 0; node < buffer->GetNodeCount(); ++node) {
-                        int start = buffer->NodeStartChannel(node);
-                        for (int c = 0; c < cn; ++c) {
-                            int cnum = start + c;
-                            if (cnum < SeqData.NumChannels()) {
-                                for (auto i = channelMaps[cnum].begin(); i != channelMaps[cnum].end(); ++i) {
-                                    int idx = *i;
-                                    if (idx != row) {
-                                        if (jobs[idx]->addNext(aggregators[row])) {
-                                            aggregators[row]->incNumAggregated();
-                                        }
-                                    }
-                                }
-                                channelMaps[cnum].insert(row);
-                            }
+                        unsigned int start = buffer->NodeStartChannel(node);
+                        if (start < numChannels && cn > 0) {
+                            unsigned int end = std::min(start + (unsigned int)cn - 1, numChannels - 1);
+                            channelIndex.Add(start, end, row);
                         }
                     }
                 }
@@ -1317,9 +1329,42 @@ void xLightsFrame::Render(const std::list<Model*> models,
         }
     }
 
+    // each job must wait on every job above it that writes to any of the same channels
+    channelIndex.Build();
+    std::vector<int> overlapping;
+    for (row = 0; row < numRows; ++row) {
+        if (jobs[row] == nullptr) {
+            continue;
+        }
+        PixelBufferClass *buffer = jobs[row]->getBuffer();
+        size_t cn = buffer->GetChanCountPerNode();
+        std::vector<NodeRange> rowRanges;
+        for (int node = 0; node < buffer->GetNodeCount(); ++node) {
+            unsigned int start = buffer->NodeStartChannel(node);
+            if (start < numChannels && cn > 0) {
+                unsigned int end = std::min(start + (unsigned int)cn - 1, numChannels - 1);
+                if (!rowRanges.empty() && rowRanges.back().end + 1 == start) {
+                    rowRanges.back().end = end;
+                } else {
+                    rowRanges.push_back(NodeRange(start, end));
+                }
+            }
+        }
+        overlapping.clear();
+        channelIndex.GetOverlappingOwners(rowRanges, overlapping);
+        for (auto idx : overlapping) {
+            if (idx >= (int)row) {
+                break;
+            }
+            if (jobs[idx]->addNext(aggregators[row])) {
+                aggregators[row]->incNumAggregated();
+            }
+        }
+    }
+
     logger_render.debug("Aggregators created.");
 
-    channelMaps.clear();
+    channelIndex.Clear();
     RenderProgressDialog *renderProgressDialog = nullptr;
     if (progressDialog) {
         renderProgressDialog = new RenderProgressDialog(this);
@@ -1453,11 +1498,10 @@ void xLightsFrame::RenderDirtyModels() {
             if (st != -1) {
                 startms = std::min(startms, st);
                 endms = std::max(endms, ed);
-                for (auto it = renderTree.data.begin(); it != renderTree.data.end(); ++it) {
-                    if ((*it)->model->GetName() == el->GetModelName()) {
-                        restricts.push_back((*it)->model);
-                        addModelsUpTo(models, (*it)->renderOrder, (*it)->model);
-                    }
+                RenderTreeData *rtd = renderTree.Find(el->GetModelName());
+                if (rtd != nullptr) {
+                    restricts.push_back(rtd->model);
+                    addModelsUpTo(models, rtd->renderOrder, rtd->model);
                 }
             }
         }
@@ -1466,10 +1510,9 @@ void xLightsFrame::RenderDirtyModels() {
         return;
     }
     for (auto x = models.begin(); x != models.end(); ++x) {
-        for (auto it = renderTree.data.begin(); it != renderTree.data.end(); ++it) {
-            if ((*it)->model == *x) {
-                addModelsFrom(models, (*it)->renderOrder, (*it)->model);
-            }
+        RenderTreeData *rtd = renderTree.Find((*x)->GetName());
+        if (rtd != nullptr && rtd->model == *x) {
+            addModelsFrom(models, rtd->renderOrder, rtd->model);
         }
     }
     if (startms < 0) {
@@ -1612,33 +1655,31 @@ void xLightsFrame::RenderEffectForModel(const std::string &model, int startms, i
     if (endframe >= SeqData.NumFrames()) {
         endframe = SeqData.NumFrames() - 1;
     }
-    for (auto it = renderTree.data.begin(); it != renderTree.data.end(); ++it) {
-        if ((*it)->model->GetName() == model) {
-
-            for (auto it2 = renderProgressInfo.begin(); it2 != renderProgressInfo.end(); ++it2) {
-                //we're going to render this model, abort whatever is rendering and accumulate the frames
-                RenderProgressInfo *rpi = (*it2);
-                if (std::find(rpi->restriction.begin(), rpi->restriction.end(), (*it)->model) != rpi->restriction.end()) {
-                    if (startframe > rpi->startFrame) {
-                        startframe = rpi->startFrame;
-                    }
-                    if (endframe < rpi->endFrame) {
-                        endframe = rpi->endFrame;
-                    }
-                    for (size_t row = 0; row < rpi->numRows; ++row) {
-                        if (rpi->jobs[row]) {
-                            rpi->jobs[row]->AbortRender();
-                        }
+    RenderTreeData *rtd = renderTree.Find(model);
+    if (rtd != nullptr) {
+        for (auto it2 = renderProgressInfo.begin(); it2 != renderProgressInfo.end(); ++it2) {
+            //we're going to render this model, abort whatever is rendering and accumulate the frames
+            RenderProgressInfo *rpi = (*it2);
+            if (std::find(rpi->restriction.begin(), rpi->restriction.end(), rtd->model) != rpi->restriction.end()) {
+                if (startframe > rpi->startFrame) {
+                    startframe = rpi->startFrame;
+                }
+                if (endframe < rpi->endFrame) {
+                    endframe = rpi->endFrame;
+                }
+                for (size_t row = 0; row < rpi->numRows; ++row) {
+                    if (rpi->jobs[row]) {
+                        rpi->jobs[row]->AbortRender();
                     }
                 }
             }
-            std::list<Model *> m;
-            m.push_back((*it)->model);
+        }
+        std::list<Model *> m;
+        m.push_back(rtd->model);
 
-            logger_base.debug("Rendering %d models %d frames.", m.size(), endframe - startframe + 1);
+        logger_base.debug("Rendering %d models %d frames.", m.size(), endframe - startframe + 1);
 
-            Render((*it)->renderOrder, m, startframe, endframe, false, true, [] {});
-        }
+        Render(rtd->renderOrder, m, startframe, endframe, false, true, [] {});
     }
 }
 
@@ -1693,6 +1734,7 @@ void xLightsFrame::RenderTimeSlice(int startms, int endms, bool clear) {
     Render(models, restricts, startframe, endframe, true, clear, [this, sw] {
         static log4cpp::Category &logger_base2 = log4cpp::Category::getInstance(std::string("log_base"));
         logger_base2.info("   Effects done.");
+        ImageCache::LogStatistics();
         ProgressBar->SetValue(100);
         float elapsedTime = sw.Time()/1000.0; // now stop stopwatch timer and get elapsed time. change into seconds from ms
         wxString displayBuff = wxString::Format(_("Rendered in %7.3f seconds"),elapsedTime);
@@ -1893,7 +1935,7 @@ bool xLightsFrame::RenderEffectFromMap(Effect *effectObj, int layer, int period,
                 wxStopWatch sw;
 
                 if (effectObj != nullptr && reff->SupportsRenderCache(SettingsMap)) {
-                    if (!effectObj->GetFrame(b, _renderCache)) {
+                    if (!effectObj->GetFrame(b, _renderCache, reff->SupportsSharedRenderCache(SettingsMap))) {
                         reff->Render(effectObj, SettingsMap, b);
                         effectObj->AddFrame(b, _renderCache);
                     }
@@ -522,6 +522,7 @@ public:
 private:
     friend class PixelBufferClass;
     std::vector<NodeBaseClassPtr> Nodes;
+    NodeLayout nodeLayout;
     PathDrawingContext *_pathDrawingContext;
     TextDrawingContext *_textDrawingContext;
 
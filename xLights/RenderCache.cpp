@@ -7,70 +7,36 @@
 
 #include <wx/filename.h>
 #include <wx/dir.h>
+#include <wx/file.h>
+#include <wx/datetime.h>
 #include <functional>
+#include <memory>
+#include <cstring>
+
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#ifndef NO_ZSTD
+#include <zstd.h>
+#endif
 #include "xLightsVersion.h"
 #include "UtilFunctions.h"
-#include "TraceLog.h"
+#include "../xSchedule/md5.h"
 
 #pragma region RenderCache
 
-class RenderCacheLoadThread : public wxThread
-{
-public:
-    RenderCacheLoadThread(RenderCache* cache)
-    {
-        _cache = cache;
-        Run();
-    }
-
-private:
-    RenderCache* _cache;
-    virtual void* Entry() override
-    {
-        std::unique_lock<std::mutex> lock(_cache->GetLoadMutex());
-
-        static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-
-        logger_base.debug("Loading cache.");
-
-        wxString cacheFolder = _cache->GetCacheFolder();
-
-        wxDir dir(cacheFolder);
-        wxArrayString files;
-        dir.GetAllFiles(cacheFolder, &files, "*.cache");
-
-        for (const auto& it : files)
-        {
-            // allow up to 3 times physical memory
-            // This means the render cache will be swapped out ... but I think that is still better than re-rendering
-            // Abandon loading render cache if we use too much memory
-            if (IsExcessiveMemoryUsage(3.0))
-            {
-                logger_base.warn("Render cache loading abandoned due to too much memory use.");
-                break;
-            }
-
-            auto rci = new RenderCacheItem(_cache, it);
-            if (rci != nullptr && !rci->IsPurged())
-            {
-                _cache->AddCacheItem(rci);
-            }
-            else
-            {
-                logger_base.warn("Failed to load cache item %s.", (const char*)it.c_str());
-            }
-        }
-
-        logger_base.debug("Cache contained %d files.", (int)files.size());
-        TraceLog::ClearTraceMessages();
-        return nullptr;
-    }
-};
+// cache files that have not been used for this long are removed when a sequence is closed
+#define RENDER_CACHE_MAX_AGE_DAYS 30
 
 RenderCache::RenderCache()
 {
     _enabled = true;
 	_cacheFolder = "";
+    _sequence = "";
 }
 
 RenderCache::~RenderCache()
@@ -78,25 +44,68 @@ RenderCache::~RenderCache()
     Close();
 }
 
-void RenderCache::LoadCache()
+void RenderCache::LoadLegacyItems()
 {
-    // the thread self deletes so we dont need to track it
-    if (IsEnabled())
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    // Cache items used to be kept in a folder per sequence and found by where their effect was. We load them so they
+    // can be matched that way and moved into the shared folder under their key as their effects render.
+    logger_base.debug("Loading old render cache folder %s.", (const char *)_legacyFolder.c_str());
+
+    wxArrayString files;
+    wxDir::GetAllFiles(_legacyFolder, &files, "*.cache", wxDIR_FILES);
+
+    for (const auto& it : files)
     {
-        wxASSERT(GetBitness() != "32bit");
-        new RenderCacheLoadThread(this);
+        // allow up to 3 times physical memory
+        // This means the render cache will be swapped out ... but I think that is still better than re-rendering
+        // Abandon loading render cache if we use too much memory
+        if (IsExcessiveMemoryUsage(3.0))
+        {
+            logger_base.warn("Render cache loading abandoned due to too much memory use.");
+            break;
+        }
+
+        auto rci = new RenderCacheItem(this, it);
+        if (!rci->IsPurged())
+        {
+            _legacy.push_back(rci);
+        }
+        else
+        {
+            logger_base.warn("Failed to load cache item %s.", (const char*)it.c_str());
+            delete rci;
+        }
     }
+
+    logger_base.debug("Old render cache folder contained %d files.", (int)files.size());
 }
 
-void RenderCache::AddCacheItem(RenderCacheItem* rci)
+void RenderCache::CloseLegacyItems()
 {
-    if (rci != nullptr)
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_legacyFolder == "") return;
+
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        for (auto& it : _legacy)
+        {
+            delete it;
+        }
+        _legacy.clear();
+    }
+
+    // items that never found their effect go stale like any other ... once they are all gone so is the folder
+    RemoveStaleItems(_legacyFolder);
+    wxArrayString files;
+    wxDir::GetAllFiles(_legacyFolder, &files, "*.cache", wxDIR_FILES);
+    if (files.size() == 0)
     {
-        static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
-        logger_rcache.info("RenderCache item added " + rci->Description());
-        std::unique_lock<std::recursive_mutex> lock(_cacheLock);
-        _cache.push_back(rci);
+        logger_base.debug("Removing old render cache folder %s as it has been migrated.", (const char *)_legacyFolder.c_str());
+        wxDir::Remove(_legacyFolder, wxPATH_RMDIR_RECURSIVE);
     }
+    _legacyFolder = "";
 }
 
 void RenderCache::SetSequence(const std::string& path, const std::string& sequenceFile)
@@ -105,22 +114,21 @@ void RenderCache::SetSequence(const std::string& path, const std::string& sequen
 
     Close();
 
+    // where this sequence's cache items were kept before they were shared
+    wxString legacyFolder = path + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + sequenceFile + "_RENDER_CACHE";
+
     if (!IsEnabled())
     {
-        if (sequenceFile != "")
+        if (sequenceFile != "" && wxDir::Exists(legacyFolder))
         {
-            _cacheFolder = path + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + sequenceFile + "_RENDER_CACHE";
-            if (wxDir::Exists(_cacheFolder))
+            if (GetBitness() == "32bit")
             {
-                if (GetBitness() == "32bit")
-                {
-                    logger_base.debug("Render cache disabled but NOT removing folder %s as this is the 32 bt version.", (const char *)_cacheFolder.c_str());
-                }
-                else
-                {
-                    logger_base.debug("Render cache disabled so removing folder %s.", (const char *)_cacheFolder.c_str());
-                    wxDir::Remove(_cacheFolder, wxPATH_RMDIR_RECURSIVE);
-                }
+                logger_base.debug("Render cache disabled but NOT removing folder %s as this is the 32 bt version.", (const char *)legacyFolder.c_str());
+            }
+            else
+            {
+                logger_base.debug("Render cache disabled so removing folder %s.", (const char *)legacyFolder.c_str());
+                wxDir::Remove(legacyFolder, wxPATH_RMDIR_RECURSIVE);
             }
         }
         return;
@@ -128,17 +136,12 @@ void RenderCache::SetSequence(const std::string& path, const std::string& sequen
 
     if (sequenceFile != "")
     {
-        _cacheFolder = path + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + sequenceFile + "_RENDER_CACHE";
+        // the cache is shared by all the sequences in the folder so identical effects only get rendered once
+        _cacheFolder = path + wxFileName::GetPathSeparator() + "RenderCache";
+        _sequence = sequenceFile;
 
         if (!wxDir::Exists(_cacheFolder))
         {
-            wxString common = path + wxFileName::GetPathSeparator() + "RenderCache";
-            if (!wxDir::Exists(common))
-            {
-                logger_base.debug("Creating render cache folder %s.", (const char *)common.c_str());
-                wxDir::Make(common);
-            }
-
             logger_base.debug("Creating render cache folder %s.", (const char *)_cacheFolder.c_str());
             wxDir::Make(_cacheFolder);
         }
@@ -147,23 +150,34 @@ void RenderCache::SetSequence(const std::string& path, const std::string& sequen
             logger_base.debug("Opening render cache folder %s.", (const char *)_cacheFolder.c_str());
         }
 
-        LoadCache();
+        if (wxDir::Exists(legacyFolder))
+        {
+            _legacyFolder = legacyFolder;
+            LoadLegacyItems();
+        }
     }
 }
 
 void RenderCache::RemoveItem(RenderCacheItem *item) {
     static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
-    std::unique_lock<std::recursive_mutex> lock(_cacheLock);
-    for (auto it = _cache.begin(); it != _cache.end(); ++it) {
-        if (item == *it) {
-            logger_rcache.info("RenderCache item removed " + (*it)->Description());
-            _cache.erase(it);
-            break;
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        auto it = _users.find(item->GetKey());
+        if (it != _users.end() && --it->second <= 0) {
+            _users.erase(it);
         }
     }
+    logger_rcache.info("RenderCache item removed " + item->Description());
     delete item;
 }
 
+bool RenderCache::IsShared(RenderCacheItem *item) {
+    // identical effects share an item ... we only know about the ones in this sequence
+    std::unique_lock<std::mutex> lock(_cacheLock);
+    auto it = _users.find(item->GetKey());
+    return it != _users.end() && it->second > 1;
+}
+
 bool RenderCache::IsEffectOkForCaching(Effect* effect) const
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -207,7 +221,7 @@ bool RenderCache::IsEffectOkForCaching(Effect* effect) const
     return true;
 }
 
-RenderCacheItem* RenderCache::GetItem(Effect* effect, RenderBuffer* buffer)
+RenderCacheItem* RenderCache::GetItem(Effect* effect, RenderBuffer* buffer, bool shared)
 {
     static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
     if (!IsEnabled()) return nullptr;
@@ -215,51 +229,129 @@ RenderCacheItem* RenderCache::GetItem(Effect* effect, RenderBuffer* buffer)
 
     if (!IsEffectOkForCaching(effect)) return nullptr;
 
-    {
-        // wait for the cache to finish loading
-        std::unique_lock<std::mutex> lock(_loadMutex);
-    }
+    // shared items are keyed without anything that ties them to this sequence or to where the effect is in it
+    std::string sequence = shared ? "" : _sequence;
+    std::string key = RenderCacheItem::GetKey(effect, buffer, sequence);
+    std::string file = _cacheFolder + wxFileName::GetPathSeparator() + key + ".cache";
 
-    std::unique_lock<std::recursive_mutex> lock(_cacheLock);
-    for (auto it = _cache.begin(); it != _cache.end(); ++it) {
-        if ((*it)->IsMatch(effect, buffer)) {
-            RenderCacheItem *item = *it;
-            _cache.erase(it);
-            logger_rcache.info("RenderCache GetItem found an existing render cache item for effect %s on model %s on layer %d at start time %dms.",
+    if (wxFile::Exists(file)) {
+        RenderCacheItem* item = new RenderCacheItem(this, file);
+        if (item->IsMatch(effect, buffer, key)) {
+            // stop it being removed as stale
+            wxFileName(file).Touch();
+            {
+                std::unique_lock<std::mutex> lock(_cacheLock);
+                _users[key]++;
+            }
+            logger_rcache.info("RenderCache GetItem found an existing render cache item %s for effect %s on model %s on layer %d at start time %dms.",
+                (const char*)key.c_str(),
                 (const char*)effect->GetEffectName().c_str(),
                 (const char*)buffer->GetModelName().c_str(),
                 effect->GetParentEffectLayer()->GetLayerNumber(),
                 effect->GetStartTimeMS());
             return item;
         }
+        delete item;
+    }
+
+    RenderCacheItem* legacy = MigrateLegacyItem(effect, buffer, key, sequence);
+    if (legacy != nullptr) {
+        return legacy;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        _users[key]++;
     }
 
-    logger_rcache.info("RenderCache GetItem created a new render cache item for effect %s on model %s on layer %d at start time %dms.",
+    logger_rcache.info("RenderCache GetItem created a new render cache item %s for effect %s on model %s on layer %d at start time %dms.",
+        (const char*)key.c_str(),
         (const char*)effect->GetEffectName().c_str(),
         (const char*)buffer->GetModelName().c_str(),
         effect->GetParentEffectLayer()->GetLayerNumber(),
         effect->GetStartTimeMS());
 
-    return new RenderCacheItem(this, effect, buffer);
+    return new RenderCacheItem(this, effect, buffer, key, sequence);
 }
 
-void RenderCache::Close()
+RenderCacheItem* RenderCache::MigrateLegacyItem(Effect* effect, RenderBuffer* buffer, const std::string& key, const std::string& sequence)
+{
+    static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
+
+    RenderCacheItem* item = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        for (auto it = _legacy.begin(); it != _legacy.end(); ++it) {
+            if ((*it)->IsMatch(effect, buffer)) {
+                item = *it;
+                _legacy.erase(it);
+                break;
+            }
+        }
+    }
+    if (item == nullptr) return nullptr;
+
+    // write it into the shared folder under its key and then it is just like any other item
+    std::string oldFile = item->Description();
+    item->Rekey(_cacheFolder + wxFileName::GetPathSeparator() + key + ".cache", key, sequence);
+    item->Save();
+    if (item->IsPurged() || !wxFile::Exists(item->Description())) {
+        delete item;
+        return nullptr;
+    }
+    wxRemoveFile(oldFile);
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        _users[key]++;
+    }
+
+    logger_rcache.info("RenderCache GetItem moved old render cache item %s to %s for effect %s on model %s on layer %d at start time %dms.",
+        (const char*)oldFile.c_str(),
+        (const char*)key.c_str(),
+        (const char*)effect->GetEffectName().c_str(),
+        (const char*)buffer->GetModelName().c_str(),
+        effect->GetParentEffectLayer()->GetLayerNumber(),
+        effect->GetStartTimeMS());
+    return item;
+}
+
+void RenderCache::RemoveStaleItems(const std::string& folder, const std::string& spec)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-    if (_cacheFolder == "") return;
+    if (!wxDir::Exists(folder)) return;
 
-    logger_base.debug("Closing render cache folder %s.", (const char *)_cacheFolder.c_str());
+    wxArrayString files;
+    wxDir::GetAllFiles(folder, &files, spec, wxDIR_FILES);
 
+    wxDateTime cutoff = wxDateTime::Now() - wxDateSpan::Days(RENDER_CACHE_MAX_AGE_DAYS);
+    int removed = 0;
+    for (const auto& it : files)
     {
-        // wait for the cache to finish loading
-        std::unique_lock<std::mutex> lock(_loadMutex);
+        wxFileName fn(it);
+        if (fn.GetModificationTime() < cutoff && wxRemoveFile(it))
+        {
+            removed++;
+        }
     }
 
-    logger_base.debug("    Got lock.");
+    logger_base.debug("    Removed %d of %d render cache files in %s that have not been used for %d days.", removed, (int)files.size(), (const char *)folder.c_str(), RENDER_CACHE_MAX_AGE_DAYS);
+}
 
-    Purge(nullptr, false);
+void RenderCache::Close()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_cacheFolder == "") return;
+
+    logger_base.debug("Closing render cache folder %s.", (const char *)_cacheFolder.c_str());
+
+    CloseLegacyItems();
+    RemoveStaleItems(_cacheFolder);
+    // the audio analysis AudioManager caches alongside us ages out the same way
+    RemoveStaleItems(wxFileName(_cacheFolder).GetPath() + wxFileName::GetPathSeparator() + "AudioCache", "*");
     _cacheFolder = "";
+    _sequence = "";
 
     logger_base.debug("    Closed.");
 }
@@ -308,10 +400,14 @@ static void purgeCache(Element *em, bool del) {
     });
 }
 
-static bool findMatch(Element *em, RenderCacheItem* item) {
-    return doOnEffects(em, [item] (Effect* e) {
-        return item->IsMatch(e, nullptr);
-    });
+static bool findMatch(SequenceElements* sequenceElements, RenderCacheItem* item) {
+    for (int i = 0; i < sequenceElements->GetElementCount(); i++) {
+        Element* em = sequenceElements->GetElement(i);
+        if (doOnEffects(em, [item] (Effect* e) { return item->IsMatch(e, nullptr); })) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void RenderCache::CleanupCache(SequenceElements* sequenceElements)
@@ -320,34 +416,46 @@ void RenderCache::CleanupCache(SequenceElements* sequenceElements)
 
     logger_base.debug("Cleaning up the cache.");
 
-    // clean up cache
-    // Because effects are removed from the cache then if you go from cache enabled to cache disabled this wont actually
-    // clean out all the cache items ... as we dont know about them.
-    std::unique_lock<std::recursive_mutex> lock(_cacheLock);
+    // Items that belong to this sequence and no longer match any of its effects are removed. Shared items may be used
+    // by other sequences so they are removed when their effect changes or once they go stale.
     int deleted = 0;
-    auto it = _cache.begin();
-    while (it != _cache.end()) {
-        bool found = false;
-
-        for (int i = 0; i < sequenceElements->GetElementCount() && !found; i++) {
-            Element* em = sequenceElements->GetElement(i);
-            found = findMatch(em, *it);
+    if (_cacheFolder != "" && _sequence != "") {
+        wxLogNull logNo; //kludge: avoid user error messahe
+        wxArrayString files;
+        wxDir::GetAllFiles(_cacheFolder, &files, "*.cache", wxDIR_FILES);
+        for (const auto& it : files) {
+            RenderCacheItem item(this, it);
+            if (!item.IsPurged() && item.GetSequence() == _sequence && !findMatch(sequenceElements, &item)) {
+                // windows wont remove a file that is mapped
+                item.PurgeFrames();
+                if (wxRemoveFile(it)) {
+                    deleted++;
+                }
+            }
         }
+    }
 
-        if (!found) {
-            auto todelete = it;
-            ++it;
-            (*todelete)->Delete();
-            deleted++;
-        }
-        else
-        {
-            ++it;
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock);
+        auto it = _legacy.begin();
+        while (it != _legacy.end()) {
+            if (!findMatch(sequenceElements, *it)) {
+                std::string file = (*it)->Description();
+                delete *it;
+                it = _legacy.erase(it);
+                if (wxRemoveFile(file)) {
+                    deleted++;
+                }
+            }
+            else {
+                ++it;
+            }
         }
     }
 
     logger_base.debug("    Cleaned up %d items in the cache.", deleted);
 
+    // the cache items are all saved so the effects can let go of them ... they are found again by their key
     for (int i = 0; i < sequenceElements->GetElementCount(); i++) {
         Element* em = sequenceElements->GetElement(i);
         purgeCache(em, false);
@@ -360,36 +468,101 @@ void RenderCache::Purge(SequenceElements* sequenceElements, bool dodelete)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
+    if (sequenceElements) {
+        for (int i = 0; i < sequenceElements->GetElementCount(); i++) {
+            Element* em = sequenceElements->GetElement(i);
+            purgeCache(em, dodelete);
+        }
+    }
+
     if (dodelete && _cacheFolder != "")
     {
+        // shared items could belong to any sequence so purging removes everything
         logger_base.debug("Purging render cache folder %s.", (const char *)_cacheFolder.c_str());
-    }
 
-    std::unique_lock<std::recursive_mutex> lock(_cacheLock);
-    while (_cache.size() > 0)
-    {
-        if (dodelete)
-        {
-            _cache.front()->Delete();
-        }
-        else
+        wxLogNull logNo; //kludge: avoid user error messahe
+        wxArrayString files;
+        wxDir::GetAllFiles(_cacheFolder, &files, "*.cache", wxDIR_FILES);
+        for (const auto& it : files)
         {
-            _cache.front()->Save();
-            delete _cache.front();
-            _cache.pop_front();
+            wxRemoveFile(it);
         }
-    }
 
-    if (sequenceElements) {
-        for (int i = 0; i < sequenceElements->GetElementCount(); i++) {
-            Element* em = sequenceElements->GetElement(i);
-            purgeCache(em, dodelete);
+        if (_legacyFolder != "")
+        {
+            {
+                std::unique_lock<std::mutex> lock(_cacheLock);
+                for (auto& it : _legacy)
+                {
+                    delete it;
+                }
+                _legacy.clear();
+            }
+            wxDir::Remove(_legacyFolder, wxPATH_RMDIR_RECURSIVE);
+            _legacyFolder = "";
         }
     }
 }
 #pragma endregion RenderCache
 
 #pragma region RenderCacheItem
+
+// Cache files start with this marker. Files without it are in the original uncompressed format
+// and are converted the first time they are loaded.
+#define RENDER_CACHE_MAGIC "RC_V2"
+#define RENDER_CACHE_MAGIC_LEN 6
+
+// every frame that is a multiple of this is stored whole so a random frame never needs more than this many decompressions
+#define RENDER_CACHE_KEYFRAME_INTERVAL 32
+
+#define RCF_PRESENT 0x01
+#define RCF_DELTA   0x02
+#define RCF_ZSTD    0x04
+
+// offset, size, flags
+#define RENDER_CACHE_INDEX_ENTRY_SIZE 16
+
+#ifndef NO_ZSTD
+static ZSTD_CCtx* GetCompressionContext()
+{
+    static thread_local std::unique_ptr<ZSTD_CCtx, size_t(*)(ZSTD_CCtx*)> ctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
+    return ctx.get();
+}
+
+static ZSTD_DCtx* GetDecompressionContext()
+{
+    static thread_local std::unique_ptr<ZSTD_DCtx, size_t(*)(ZSTD_DCtx*)> ctx(ZSTD_createDCtx(), ZSTD_freeDCtx);
+    return ctx.get();
+}
+#endif
+
+static void XorFrame(unsigned char* dest, const unsigned char* a, const unsigned char* b, size_t len)
+{
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+    {
+        uint64_t x, y;
+        memcpy(&x, a + i, sizeof(x));
+        memcpy(&y, b + i, sizeof(y));
+        x ^= y;
+        memcpy(dest + i, &x, sizeof(x));
+    }
+    for (; i < len; i++)
+    {
+        dest[i] = a[i] ^ b[i];
+    }
+}
+
+static bool ReadCacheString(const unsigned char* data, size_t size, size_t& pos, std::string& out)
+{
+    if (pos >= size) return false;
+    const unsigned char* end = (const unsigned char*)memchr(data + pos, 0x00, size - pos);
+    if (end == nullptr) return false;
+    out.assign((const char*)data + pos, end - (data + pos));
+    pos = end - data + 1;
+    return true;
+}
+
 RenderCacheItem::~RenderCacheItem()
 {
     PurgeFrames();
@@ -398,15 +571,72 @@ RenderCacheItem::~RenderCacheItem()
 void RenderCacheItem::PurgeFrames()
 {
     _purged = true;
-    for (auto& it : _frames)
+    for (auto& it : _models)
     {
-        for (int x = it.second.size() - 1; x >= 0; --x) {
-            if (it.second[x]) {
-                free(it.second[x]);
-                it.second[x] = nullptr;
-            }
+        for (auto& f : it.second.frames)
+        {
+            f = CachedFrame();
         }
+        std::vector<unsigned char>().swap(it.second.lastAdded);
+        it.second.lastAddedFrame = -1;
+        std::vector<unsigned char>().swap(it.second.lastRead);
+        it.second.lastReadFrame = -1;
+    }
+    Unmap();
+}
+
+bool RenderCacheItem::Map()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    Unmap();
+
+    wxFile file;
+    if (!file.Open(_cacheFile)) return false;
+
+    size_t size = file.Length();
+    if (size == 0) return false;
+
+#ifdef __WXMSW__
+    HANDLE mapping = CreateFileMapping((HANDLE)_get_osfhandle(file.fd()), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        logger_base.warn("Unable to map render cache file %s.", (const char*)_cacheFile.c_str());
+        return false;
+    }
+    // the view keeps the mapping alive
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        logger_base.warn("Unable to map render cache file %s.", (const char*)_cacheFile.c_str());
+        return false;
+    }
+#else
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file.fd(), 0);
+    if (data == MAP_FAILED)
+    {
+        logger_base.warn("Unable to map render cache file %s.", (const char*)_cacheFile.c_str());
+        return false;
     }
+#endif
+
+    _map = (unsigned char*)data;
+    _mapSize = size;
+    return true;
+}
+
+void RenderCacheItem::Unmap()
+{
+    if (_map == nullptr) return;
+
+#ifdef __WXMSW__
+    UnmapViewOfFile(_map);
+#else
+    munmap(_map, _mapSize);
+#endif
+    _map = nullptr;
+    _mapSize = 0;
 }
 
 std::string RenderCacheItem::GetModelName(RenderBuffer* buffer)
@@ -428,26 +658,49 @@ std::string RenderCacheItem::GetModelName(RenderBuffer* buffer)
     }
 }
 
-RenderCacheItem::RenderCacheItem(RenderCache* renderCache, Effect* effect, RenderBuffer* buffer) : _renderCache(renderCache)
+std::string RenderCacheItem::GetKey(Effect* effect, RenderBuffer* buffer, const std::string& sequence)
 {
+    // everything the rendered frames depend on ... the separators stop adjacent values running into each other
+    MD5 md5;
+    auto add = [&md5](const std::string& s) { md5.update(s.c_str(), s.size() + 1); };
+
+    add(xlights_version_string.ToStdString());
+    add(effect->GetEffectName());
+    add(effect->GetParentEffectLayer()->GetParentElement()->GetFullName());
+    add(wxString::Format("%d,%d,%d,%d,%d", buffer->BufferWi, buffer->BufferHt, (int)buffer->pixels.size(),
+        buffer->curEffEndPer - buffer->curEffStartPer + 1, buffer->frameTimeInMs).ToStdString());
+    if (sequence != "")
+    {
+        add(sequence);
+        add(wxString::Format("%d,%d", effect->GetParentEffectLayer()->GetLayerNumber(), effect->GetStartTimeMS()).ToStdString());
+    }
+    for (const auto& it : effect->GetSettings())
+    {
+        add(it.first);
+        add(it.second);
+    }
+    for (const auto& it : effect->GetPaletteMap())
+    {
+        add(it.first);
+        add(it.second);
+    }
+
+    md5.finalize();
+    return md5.hexdigest();
+}
+
+RenderCacheItem::RenderCacheItem(RenderCache* renderCache, Effect* effect, RenderBuffer* buffer, const std::string& key, const std::string& sequence) : _renderCache(renderCache)
+{
+    _map = nullptr;
+    _mapSize = 0;
     _purged = false;
     _dirty = true;
     std::string mname = GetModelName(buffer);
     wxASSERT(mname != "");
-    _frameSize[mname] = sizeof(xlColor) * buffer->pixels.size();
-    wxString elname = effect->GetParentEffectLayer()->GetParentElement()->GetFullName();
-    elname.Replace("/", "_");
-    elname.Replace("\\", "_");
-    elname.Replace(":", "_");
-    elname.Replace("?", "_");
-    elname.Replace("*", "_");
-    elname.Replace("$", "_");
-    std::string file = wxString::Format("%s_%s_%d_%d.cache",
-            effect->GetEffectName(),
-            elname,
-            effect->GetParentEffectLayer()->GetLayerNumber(),
-            effect->GetStartTimeMS()).ToStdString();
-    _cacheFile = renderCache->GetCacheFolder() + wxFileName::GetPathSeparator() + file;
+    _models[mname].frameSize = sizeof(xlColor) * buffer->pixels.size();
+    _cacheFile = renderCache->GetCacheFolder() + wxFileName::GetPathSeparator() + key + ".cache";
+    _properties["Key"] = key;
+    _properties["Sequence"] = sequence;
     _properties["Effect"] = effect->GetEffectName();
     _properties["Element"] = effect->GetParentEffectLayer()->GetParentElement()->GetFullName();
     _properties["EffectLayer"] = wxString::Format("%d", effect->GetParentEffectLayer()->GetLayerNumber());
@@ -465,33 +718,61 @@ RenderCacheItem::RenderCacheItem(RenderCache* renderCache, Effect* effect, Rende
     }
 }
 
-bool RenderCacheItem::IsMatch(Effect* effect, RenderBuffer* buffer)
+const std::string& RenderCacheItem::GetProperty(const std::string& name) const
+{
+    static const std::string empty;
+    auto it = _properties.find(name);
+    return it == _properties.end() ? empty : it->second;
+}
+
+bool RenderCacheItem::IsMatch(Effect* effect, RenderBuffer* buffer, const std::string& key)
 {
-    static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
     if (_purged) return false;
-    if (!_renderCache->IsEffectOkForCaching(effect)) return false;
 
-    if (wxAtoi(_properties.at("StartMS")) != effect->GetStartTimeMS()) return false;
+    if (GetKey() != key) return false;
 
-    EffectLayer* el = effect->GetParentEffectLayer();
-    if (wxAtoi(_properties.at("EffectLayer")) != el->GetLayerNumber()) return false;
+    auto mit = _models.find(GetModelName(buffer));
+    if (mit == _models.end() || mit->second.frameSize != sizeof(xlColor) * buffer->pixels.size()) return false;
 
-    Element* e = el->GetParentElement();
-    if (_properties.at("Element") != e->GetFullName()) return false;
+    // The key covers everything else but we check the settings too so a hash collision cant give us the wrong frames
+    return MatchesSettings(effect);
+}
+
+// Matches an effect at the same place in the sequence ... this is how items from before they were keyed are found
+bool RenderCacheItem::IsMatch(Effect* effect, RenderBuffer* buffer)
+{
+    if (_purged) return false;
+
+    if (wxAtoi(GetProperty("StartMS")) != effect->GetStartTimeMS()) return false;
+    if (wxAtoi(GetProperty("EndMS")) != effect->GetEndTimeMS()) return false;
+    if (wxAtoi(GetProperty("EffectLayer")) != effect->GetParentEffectLayer()->GetLayerNumber()) return false;
 
     if (buffer != nullptr)
     {
-        std::string mname = GetModelName(buffer);
-        if (_frameSize.at(mname) != sizeof(xlColor) * buffer->pixels.size()) return false;
+        auto mit = _models.find(GetModelName(buffer));
+        if (mit == _models.end() || mit->second.frameSize != sizeof(xlColor) * buffer->pixels.size()) return false;
+        if (GetProperty("Frames") != "" && wxAtoi(GetProperty("Frames")) != buffer->curEffEndPer - buffer->curEffStartPer + 1) return false;
     }
 
-    if (wxAtoi(_properties.at("EndMS")) != effect->GetEndTimeMS()) return false;
-    if (_properties.at("Effect") != effect->GetEffectName()) return false;
+    return MatchesSettings(effect);
+}
+
+bool RenderCacheItem::MatchesSettings(Effect* effect)
+{
+    static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
+
+    if (GetProperty("Effect") != effect->GetEffectName()) return false;
+    if (GetProperty("Element") != effect->GetParentEffectLayer()->GetParentElement()->GetFullName()) return false;
 
     // We only log failures from here on because they should be relatively rare
 
-    // 8 is the number of predefined tags
-    if (_properties.size() - 7 != effect->GetSettings().size() + effect->GetPaletteMap().size())
+    // items from before they were keyed dont have all the predefined tags
+    size_t predefined = 0;
+    for (const auto& it : { "Key", "Sequence", "Effect", "Element", "EffectLayer", "StartMS", "EndMS", "Frames", "Models" })
+    {
+        predefined += _properties.count(it);
+    }
+    if (_properties.size() - predefined != effect->GetSettings().size() + effect->GetPaletteMap().size())
     {
         logger_rcache.debug("RenderCache no mantch because number of proprerties different.");
         return false;
@@ -532,12 +813,23 @@ bool RenderCacheItem::IsMatch(Effect* effect, RenderBuffer* buffer)
     return true;
 }
 
+void RenderCacheItem::Rekey(const std::string& file, const std::string& key, const std::string& sequence)
+{
+    _cacheFile = file;
+    _properties["Key"] = key;
+    _properties["Sequence"] = sequence;
+    _dirty = true;
+}
+
 void RenderCacheItem::Delete()
 {
     static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     wxLogNull logNo; //kludge: avoid user error messahe
-    if (!_purged && wxFile::Exists(_cacheFile)) {
+    // leave it for any other effect in the sequence that is using the same item
+    if (!_purged && !_renderCache->IsShared(this) && wxFile::Exists(_cacheFile)) {
+        // windows wont remove a file that is mapped
+        Unmap();
         if (!wxRemoveFile(_cacheFile))
         {
             logger_base.warn("Unable to remove cache file " + _cacheFile);
@@ -551,6 +843,130 @@ void RenderCacheItem::Delete()
     _renderCache->RemoveItem(this);
 }
 
+void RenderCacheItem::StoreFrame(CachedModel& model, int frame, const unsigned char* pixels)
+{
+    static thread_local std::vector<unsigned char> delta;
+    static thread_local std::vector<unsigned char> compressed;
+
+    size_t frameSize = model.frameSize;
+    CachedFrame& cf = model.frames[frame];
+
+    if (cf.flags & RCF_PRESENT)
+    {
+        // later frames may have been delta encoded against the one we are replacing
+        for (int f = frame + 1; f < model.frames.size() && (model.frames[f].flags & RCF_DELTA); f++)
+        {
+            model.frames[f] = CachedFrame();
+        }
+        model.lastReadFrame = -1;
+    }
+
+    const unsigned char* src = pixels;
+    uint32_t flags = RCF_PRESENT;
+    if (frame % RENDER_CACHE_KEYFRAME_INTERVAL != 0 && frame == model.lastAddedFrame + 1 && model.lastAdded.size() == frameSize)
+    {
+        delta.resize(frameSize);
+        XorFrame(&delta[0], pixels, &model.lastAdded[0], frameSize);
+        src = &delta[0];
+        flags |= RCF_DELTA;
+    }
+
+    cf = CachedFrame();
+#ifndef NO_ZSTD
+    compressed.resize(ZSTD_compressBound(frameSize));
+    size_t sz = ZSTD_compressCCtx(GetCompressionContext(), &compressed[0], compressed.size(), src, frameSize, 1);
+    if (!ZSTD_isError(sz) && sz < frameSize)
+    {
+        cf.data.assign(compressed.begin(), compressed.begin() + sz);
+        flags |= RCF_ZSTD;
+    }
+    else
+#endif
+    {
+        cf.data.assign(src, src + frameSize);
+    }
+    cf.size = cf.data.size();
+    cf.flags = flags;
+
+    model.lastAdded.assign(pixels, pixels + frameSize);
+    model.lastAddedFrame = frame;
+}
+
+const unsigned char* RenderCacheItem::GetFrameData(const CachedFrame& frame) const
+{
+    if (frame.data.empty())
+    {
+        return _map == nullptr ? nullptr : _map + frame.offset;
+    }
+    return &frame.data[0];
+}
+
+bool RenderCacheItem::DecompressFrame(const CachedFrame& frame, unsigned char* dest, long frameSize) const
+{
+    const unsigned char* src = GetFrameData(frame);
+    if (src == nullptr) return false;
+
+    if (frame.flags & RCF_ZSTD)
+    {
+#ifndef NO_ZSTD
+        size_t sz = ZSTD_decompressDCtx(GetDecompressionContext(), dest, frameSize, src, frame.size);
+        return !ZSTD_isError(sz) && sz == frameSize;
+#else
+        return false;
+#endif
+    }
+
+    if (frame.size != frameSize) return false;
+    memcpy(dest, src, frameSize);
+    return true;
+}
+
+bool RenderCacheItem::ReadFrame(CachedModel& model, int frame)
+{
+    static thread_local std::vector<unsigned char> delta;
+
+    if (frame == model.lastReadFrame) return true;
+
+    // walk back to a whole frame or the frame after the last one we read
+    int first = frame;
+    while (first > 0 && (model.frames[first].flags & RCF_DELTA) && model.lastReadFrame != first - 1)
+    {
+        first--;
+    }
+
+    if ((model.frames[first].flags & RCF_DELTA) && model.lastReadFrame != first - 1)
+    {
+        model.lastReadFrame = -1;
+        return false;
+    }
+
+    model.lastRead.resize(model.frameSize);
+    for (int f = first; f <= frame; f++)
+    {
+        const CachedFrame& cf = model.frames[f];
+        bool ok = (cf.flags & RCF_PRESENT) != 0;
+        if (ok && (cf.flags & RCF_DELTA))
+        {
+            delta.resize(model.frameSize);
+            ok = DecompressFrame(cf, &delta[0], model.frameSize);
+            if (ok) XorFrame(&model.lastRead[0], &model.lastRead[0], &delta[0], model.frameSize);
+        }
+        else if (ok)
+        {
+            ok = DecompressFrame(cf, &model.lastRead[0], model.frameSize);
+        }
+
+        if (!ok)
+        {
+            model.lastReadFrame = -1;
+            return false;
+        }
+        model.lastReadFrame = f;
+    }
+
+    return true;
+}
+
 void RenderCacheItem::AddFrame(RenderBuffer* buffer)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -584,13 +1000,15 @@ void RenderCacheItem::AddFrame(RenderBuffer* buffer)
     int frame = buffer->curPeriod - buffer->curEffStartPer;
 
     std::string mname = GetModelName(buffer);
-    if (_frameSize.find(mname) == _frameSize.end())
+    auto mit = _models.find(mname);
+    if (mit == _models.end())
     {
-        _frameSize[mname] = sizeof(xlColor) * buffer->pixels.size();
+        mit = _models.emplace(mname, CachedModel()).first;
+        mit->second.frameSize = sizeof(xlColor) * buffer->pixels.size();
     }
     else
     {
-        if (_frameSize[mname] != sizeof(xlColor) * buffer->pixels.size())
+        if (mit->second.frameSize != sizeof(xlColor) * buffer->pixels.size())
         {
             // the buffer size has changed ... we dont support this.
             logger_base.warn("RenderCacheItem::AddFrame buffer size changed ... we dont support this.");
@@ -598,42 +1016,22 @@ void RenderCacheItem::AddFrame(RenderBuffer* buffer)
             return;
         }
     }
+    CachedModel& model = mit->second;
 
-    if (_frames.find(mname) == _frames.end())
-    {
-        std::vector<unsigned char *> n;
-        _frames[mname] = n;
-    }
-
-    if (frame >= _frames.at(mname).size()) {
+    if (frame >= model.frames.size()) {
         int maxframe = std::max(frame+1,buffer->curEffEndPer - buffer->curEffStartPer + 1);
-        _frames.at(mname).resize(maxframe);
+        model.frames.resize(maxframe);
     }
 
-    unsigned char* frameBuffer = (unsigned char *)malloc(_frameSize.at(mname));
-    if (frameBuffer == nullptr)
-    {
-        logger_base.warn("RenderCacheItem::AddFrame failed to allocate frameBuffer.");
-        PurgeFrames();
-        wxASSERT(false);
-        return;
-    }
-    memcpy(frameBuffer, &buffer->pixels[0], _frameSize.at(mname));
-
-    if (_frames.at(mname)[frame] != nullptr) {
-        free(_frames.at(mname)[frame]);
-        _frames.at(mname)[frame] = nullptr;
-    }
-
-    _frames.at(mname)[frame] = frameBuffer;
+    StoreFrame(model, frame, (const unsigned char*)&buffer->pixels[0]);
     _dirty = true;
 
     if (buffer->curPeriod == buffer->curEffEndPer)
     {
-        // if multi models in this cache then only call save when none of them have null pointers at the end
-        for (const auto& itm : _frames)
+        // if multi models in this cache then only call save when none of them have missing frames at the end
+        for (const auto& itm : _models)
         {
-            if (itm.second.back() == nullptr)
+            if (!itm.second.frames.empty() && !(itm.second.frames.back().flags & RCF_PRESENT))
             {
                 //logger_base.warn("RenderCacheItem::AddFrame save abandoned due to null frame.");
                 return;
@@ -648,14 +1046,15 @@ bool RenderCacheItem::GetFrame(RenderBuffer* buffer)
 {
     static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
     std::string mname = GetModelName(buffer);
-    if (_frameSize.find(mname) == _frameSize.end())
+    auto mit = _models.find(mname);
+    if (mit == _models.end())
     {
         logger_rcache.info("RenderCache::GetFrame on model " + mname + " failed due to number of frames difference.");
         return false;
     }
 
-    auto modelFrames = _frames[mname];
-    if (_frameSize.at(mname) != (sizeof(xlColor) * buffer->pixels.size()))
+    CachedModel& model = mit->second;
+    if (model.frameSize != (sizeof(xlColor) * buffer->pixels.size()))
     {
         logger_rcache.info("RenderCache::GetFrame on model " + mname + " failed due to frame size difference.");
         return false;
@@ -663,11 +1062,19 @@ bool RenderCacheItem::GetFrame(RenderBuffer* buffer)
 
     int frame = buffer->curPeriod - buffer->curEffStartPer;
 
-    if (frame < modelFrames.size() && modelFrames[frame]) {
-        // its in memory ... read it from there
-        unsigned char* pc = modelFrames[frame];
-        memcpy(&buffer->pixels[0], pc, _frameSize.at(mname));
-        return true;
+    if (frame >= 0 && frame < model.frames.size() && (model.frames[frame].flags & RCF_PRESENT)) {
+        if (ReadFrame(model, frame)) {
+            memcpy(&buffer->pixels[0], &model.lastRead[0], model.frameSize);
+
+            // once the effect has been played through we dont need to hold onto the decoded frame
+            if (frame == model.frames.size() - 1) {
+                std::vector<unsigned char>().swap(model.lastRead);
+                model.lastReadFrame = -1;
+            }
+            return true;
+        }
+        logger_rcache.info("RenderCache::GetFrame %d on model %s failed to decompress.", frame, (const char*)mname.c_str());
+        return false;
     }
 
     logger_rcache.info("RenderCache::GetFrame %d on model %s failed due to fall through.", frame, (const char*)mname.c_str());
@@ -682,57 +1089,118 @@ void RenderCacheItem::Save()
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     //logger_base.debug("Saving render cache file %s.", (const char *)_cacheFile.c_str());
 
-    char zero = 0x00;
-
     // check all the data is there
-    for (const auto& itm : _frames)
+    for (const auto& itm : _models)
     {
-        for (const auto& it : itm.second)
+        for (const auto& it : itm.second.frames)
         {
             // we are missing data
             //wxASSERT(false);
-            if (it == nullptr) return;
+            if (!(it.flags & RCF_PRESENT)) return;
+        }
+    }
+
+    _properties["Models"] = wxString::Format("%d", (int)_models.size());
+
+    std::string header(RENDER_CACHE_MAGIC, RENDER_CACHE_MAGIC_LEN);
+    for (const auto& it : _properties)
+    {
+        header += it.first;
+        header.push_back(0x00);
+        header += it.second;
+        header.push_back(0x00);
+    }
+    header += "RC_HEADEREND";
+    header.push_back(0x00);
+
+    size_t frames = 0;
+    for (const auto& it : _models)
+    {
+        header += it.first;
+        header.push_back(0x00);
+        header += wxString::Format("%d", (int)it.second.frames.size()).ToStdString();
+        header.push_back(0x00);
+        header += wxString::Format("%ld", it.second.frameSize).ToStdString();
+        header.push_back(0x00);
+        frames += it.second.frames.size();
+    }
+
+    // the index holds where each compressed frame lives in the file so it can be found without reading the others
+    std::vector<unsigned char> index(frames * RENDER_CACHE_INDEX_ENTRY_SIZE);
+    std::vector<uint64_t> offsets;
+    offsets.reserve(frames);
+    uint64_t offset = header.size() + index.size();
+    unsigned char* pi = index.empty() ? nullptr : &index[0];
+    for (const auto& itm : _models)
+    {
+        for (const auto& it : itm.second.frames)
+        {
+            memcpy(pi, &offset, sizeof(uint64_t));
+            memcpy(pi + 8, &it.size, sizeof(uint32_t));
+            memcpy(pi + 12, &it.flags, sizeof(uint32_t));
+            pi += RENDER_CACHE_INDEX_ENTRY_SIZE;
+            offsets.push_back(offset);
+            offset += it.size;
         }
     }
 
+    // write to a temporary file as the frames may be coming from the mapped file we are replacing
+    std::string tempFile = _cacheFile + ".tmp";
     wxFile file;
 
-    if (file.Create(_cacheFile, true))
+    if (file.Create(tempFile, true))
     {
-        _properties["Models"] = wxString::Format("%d", (int)_frames.size());
-        // write the header fields
-        for (const auto& it : _properties)
+        bool ok = file.Write(header.c_str(), header.size()) == header.size();
+        if (ok && !index.empty()) ok = file.Write(&index[0], index.size()) == index.size();
+
+        for (const auto& itm : _models)
         {
-            file.Write(it.first);
-            file.Write(&zero, 1);
-            file.Write(it.second);
-            file.Write(&zero, 1);
+            for (const auto& it : itm.second.frames)
+            {
+                const unsigned char* data = GetFrameData(it);
+                if (!ok || data == nullptr)
+                {
+                    ok = false;
+                    break;
+                }
+                ok = file.Write(data, it.size) == it.size;
+            }
         }
 
-        file.Write("RC_HEADEREND");
-        file.Write(&zero, 1);
+        file.Close();
 
-        for (const auto& it : _frames)
+        // windows wont replace a file that is mapped
+        bool mapped = _map != nullptr;
+        Unmap();
+        if (!ok || !wxRenameFile(tempFile, _cacheFile, true))
         {
-            file.Write(it.first);
-            file.Write(&zero, 1);
-            file.Write(wxString::Format("%d", (int)it.second.size()));
-            file.Write(&zero, 1);
-            file.Write(wxString::Format("%ld", _frameSize.at(it.first)));
-            file.Write(&zero, 1);
+            logger_base.warn("    Failed to write render cache file %s.", (const char *)_cacheFile.c_str());
+            wxRemoveFile(tempFile);
+            if (mapped && !Map())
+            {
+                PurgeFrames();
+            }
+            return;
         }
 
-        // write the frames
-        for (const auto& itm : _frames)
+        // the frames now live in the file so we can drop our copies
+        size_t i = 0;
+        for (auto& itm : _models)
         {
-            for (const auto& it : itm.second)
+            for (auto& it : itm.second.frames)
             {
-                wxASSERT(it != nullptr);
-                file.Write(it, _frameSize.at(itm.first));
+                it.offset = offsets[i++];
+                std::vector<unsigned char>().swap(it.data);
             }
+            std::vector<unsigned char>().swap(itm.second.lastAdded);
+            itm.second.lastAddedFrame = -1;
         }
+        _dirty = false;
 
-        file.Close();
+        if (!Map())
+        {
+            PurgeFrames();
+        }
     }
     else
     {
@@ -744,8 +1212,8 @@ bool RenderCacheItem::IsDone(RenderBuffer* buffer) const
 {
     int frame = buffer->curPeriod - buffer->curEffStartPer;
     std::string mname = GetModelName(buffer);
-    auto modelFrames = _frames.at(mname);
-    return modelFrames[frame];
+    const auto& modelFrames = _models.at(mname).frames;
+    return (modelFrames[frame].flags & RCF_PRESENT) != 0;
 }
 
 RenderCacheItem::RenderCacheItem(RenderCache* renderCache, const std::string& filename) : _renderCache(renderCache)
@@ -753,10 +1221,88 @@ RenderCacheItem::RenderCacheItem(RenderCache* renderCache, const std::string& fi
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     _cacheFile = filename;
-    wxFileName fn(_cacheFile);
+    _map = nullptr;
+    _mapSize = 0;
     _purged = false;
     _dirty = false;
 
+    char magic[RENDER_CACHE_MAGIC_LEN];
+    memset(magic, 0x00, sizeof(magic));
+    {
+        wxFile file;
+        if (!file.Open(_cacheFile)) {
+            _purged = true;
+            return;
+        }
+        file.Read(magic, sizeof(magic));
+    }
+
+    if (memcmp(magic, RENDER_CACHE_MAGIC, RENDER_CACHE_MAGIC_LEN) == 0) {
+        if (!LoadMapped(filename)) {
+            logger_base.debug("Cache file %s appears corrupt.", (const char*)filename.c_str());
+            PurgeFrames();
+        }
+    }
+    else {
+        LoadLegacy(filename);
+        if (!_purged) {
+            // rewrite it in the compressed format so next time it is mapped
+            _dirty = true;
+            Save();
+        }
+    }
+}
+
+bool RenderCacheItem::LoadMapped(const std::string& filename)
+{
+    if (!Map()) return false;
+
+    size_t pos = RENDER_CACHE_MAGIC_LEN;
+    std::string key;
+    std::string value;
+    for (;;) {
+        if (!ReadCacheString(_map, _mapSize, pos, key)) return false;
+        if (key == "RC_HEADEREND") break;
+        if (key == "" || !ReadCacheString(_map, _mapSize, pos, value)) return false;
+        _properties[key] = value;
+    }
+
+    int models = wxAtoi(_properties["Models"]);
+    for (int i = 0; i < models; i++)
+    {
+        std::string model;
+        std::string frames;
+        std::string frameSize;
+        if (!ReadCacheString(_map, _mapSize, pos, model) ||
+            !ReadCacheString(_map, _mapSize, pos, frames) ||
+            !ReadCacheString(_map, _mapSize, pos, frameSize)) return false;
+
+        CachedModel& m = _models[model];
+        m.frames.resize(wxAtoi(frames));
+        m.frameSize = wxAtol(frameSize);
+    }
+
+    // frames were written in model name order which is the map order
+    for (auto& itm : _models)
+    {
+        for (auto& it : itm.second.frames)
+        {
+            if (pos + RENDER_CACHE_INDEX_ENTRY_SIZE > _mapSize) return false;
+            memcpy(&it.offset, _map + pos, sizeof(uint64_t));
+            memcpy(&it.size, _map + pos + 8, sizeof(uint32_t));
+            memcpy(&it.flags, _map + pos + 12, sizeof(uint32_t));
+            pos += RENDER_CACHE_INDEX_ENTRY_SIZE;
+            if (it.offset + it.size > _mapSize) return false;
+        }
+    }
+
+    return true;
+}
+
+void RenderCacheItem::LoadLegacy(const std::string& filename)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
     wxFile file;
 
     if (file.Open(_cacheFile)) {
@@ -799,31 +1345,27 @@ RenderCacheItem::RenderCacheItem(RenderCache* renderCache, const std::string& fi
             ps += strlen(ps) + 1;
             long fsz = wxAtol(frameSize);
 
-            std::vector<unsigned char *> n;
-            _frames[model] = n;
-            _frames.at(model).resize(fs);
-            _frameSize[model] = fsz;
+            _models[model].frames.resize(fs);
+            _models[model].frameSize = fsz;
         }
 
         long firstFrameOffset = ps - headerBuffer;
 
         file.Seek(firstFrameOffset);
 
-        for (auto& itm : _frames)
+        std::vector<unsigned char> frameBuffer;
+        for (auto& itm : _models)
         {
-            for (int i = 0; i < itm.second.size(); i++) {
-                unsigned char* frameBuffer = (unsigned char *)malloc(_frameSize.at(itm.first));
-
-                if (frameBuffer == nullptr)
+            frameBuffer.resize(itm.second.frameSize);
+            for (int i = 0; i < itm.second.frames.size(); i++) {
+                if (frameBuffer.empty() || file.Read(&frameBuffer[0], frameBuffer.size()) != frameBuffer.size())
                 {
                     file.Close();
                     PurgeFrames();
-                    logger_base.debug("Render Cache Item file %s fails due to memory allocation issue.", (const char*)filename.c_str());
+                    logger_base.debug("Render Cache Item file %s is truncated.", (const char*)filename.c_str());
                     return;
                 }
-
-                file.Read(frameBuffer, _frameSize.at(itm.first));
-                itm.second[i] = frameBuffer;
+                StoreFrame(itm.second, i, &frameBuffer[0]);
             }
         }
 
@@ -5,64 +5,106 @@
 #include <list>
 #include <map>
 #include <vector>
+#include <cstdint>
 #include <mutex>
 
 class Effect;
 class RenderCache;
 class SequenceElements;
 class RenderBuffer;
-class RenderCacheLoadThread;
 
 class RenderCacheItem
 {
+    // A frame is held compressed ... in memory until the item is saved and then in the mapped cache file
+    struct CachedFrame
+    {
+        std::vector<unsigned char> data;
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t flags = 0;
+    };
+
+    struct CachedModel
+    {
+        long frameSize = 0;
+        std::vector<CachedFrame> frames;
+        // frames are delta encoded against the previous frame so we keep the last one added and read uncompressed
+        std::vector<unsigned char> lastAdded;
+        int lastAddedFrame = -1;
+        std::vector<unsigned char> lastRead;
+        int lastReadFrame = -1;
+    };
+
     RenderCache* _renderCache;
     std::string _cacheFile;
     std::map<std::string, std::string> _properties;
-    std::map<std::string, std::vector<unsigned char *>> _frames;
-    std::map<std::string, long> _frameSize;
+    std::map<std::string, CachedModel> _models;
+    unsigned char* _map;
+    size_t _mapSize;
     bool _purged;
     bool _dirty;
     static std::string GetModelName(RenderBuffer* buffer);
+    const std::string& GetProperty(const std::string& name) const;
+    bool MatchesSettings(Effect* effect);
+    void LoadLegacy(const std::string& filename);
+    bool LoadMapped(const std::string& filename);
+    bool Map();
+    void Unmap();
+    void StoreFrame(CachedModel& model, int frame, const unsigned char* pixels);
+    bool ReadFrame(CachedModel& model, int frame);
+    bool DecompressFrame(const CachedFrame& frame, unsigned char* dest, long frameSize) const;
+    const unsigned char* GetFrameData(const CachedFrame& frame) const;
 
 public:
     RenderCacheItem(RenderCache* renderCache, const std::string& file);
-    RenderCacheItem(RenderCache* renderCache, Effect* effect, RenderBuffer* buffer);
+    RenderCacheItem(RenderCache* renderCache, Effect* effect, RenderBuffer* buffer, const std::string& key, const std::string& sequence);
+    static std::string GetKey(Effect* effect, RenderBuffer* buffer, const std::string& sequence);
     virtual ~RenderCacheItem();
     bool GetFrame(RenderBuffer* buffer);
     void AddFrame(RenderBuffer* buffer);
     void PurgeFrames();
     bool IsPurged() const { return _purged; }
+    bool IsMatch(Effect* effect, RenderBuffer* buffer, const std::string& key);
     bool IsMatch(Effect* effect, RenderBuffer* buffer);
+    void Rekey(const std::string& file, const std::string& key, const std::string& sequence);
+    const std::string& GetKey() const { return GetProperty("Key"); }
+    const std::string& GetSequence() const { return GetProperty("Sequence"); }
     void Delete();
     void Save();
     bool IsDone(RenderBuffer* buffer) const;
     const std::string& Description() const { return _cacheFile; }
 };
 
+// Cache items are named by a hash of everything the rendered frames depend on and live in a folder shared by
+// all the sequences so an effect that is reused is only rendered once
 class RenderCache
 {
-    std::recursive_mutex  _cacheLock;
+    std::mutex _cacheLock;
 	std::string _cacheFolder;
-	std::list<RenderCacheItem*> _cache;
+    std::string _sequence;
     std::string _enabled; // Disabled | Locked Only | Enabled
-    std::mutex _loadMutex;
+    std::map<std::string, int> _users; // how many effects are using each key
+    std::string _legacyFolder;
+    std::list<RenderCacheItem*> _legacy; // items from the old per sequence folder waiting for their effect
 
     void Close();
-    void LoadCache();
+    void RemoveStaleItems(const std::string& folder, const std::string& spec = "*.cache");
+    void LoadLegacyItems();
+    void CloseLegacyItems();
+    RenderCacheItem* MigrateLegacyItem(Effect* effect, RenderBuffer* buffer, const std::string& key, const std::string& sequence);
 
     public:
 		RenderCache();
 		virtual ~RenderCache();
         inline bool IsEnabled() const { return _enabled != "Disabled"; }
         void SetSequence(const std::string& path, const std::string& sequenceFile);
-		RenderCacheItem* GetItem(Effect* effect, RenderBuffer* buffer);
+		RenderCacheItem* GetItem(Effect* effect, RenderBuffer* buffer, bool shared);
         void RemoveItem(RenderCacheItem *item);
+        bool IsShared(RenderCacheItem *item);
         std::string GetCacheFolder() const { return _cacheFolder; }
         void CleanupCache(SequenceElements* sequenceElements);
         void Purge(SequenceElements* sequenceElements, bool dodelete);
         void Enable(std::string enabled) { _enabled = enabled; }
-        std::mutex& GetLoadMutex() { return _loadMutex; }
-        void AddCacheItem(RenderCacheItem* rci);
         bool IsEffectOkForCaching(Effect* effect) const;
 };
 
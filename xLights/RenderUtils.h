@@ -1,6 +1,9 @@
 #ifndef RENDERUTILS_H
 #define RENDERUTILS_H
 
+#include <vector>
+#include <algorithm>
+
 class NodeRange 
 {
 public:
@@ -49,4 +52,119 @@ public:
     }
 };
 
+// Static index of channel ranges each tagged with an owner id (typically a row or model index).
+// Entries are kept in one sorted vector treated as an implicit balanced interval tree so
+// "which owners overlap this channel range" is O(log n + k) and costs 16 bytes per range.
+// Add all the ranges, call Build() once, then query.
+class NodeRangeIndex
+{
+public:
+
+    void Clear() {
+        _entries.clear();
+        _built = true;
+    }
+
+    void Reserve(size_t n) {
+        _entries.reserve(n);
+    }
+
+    void Add(unsigned int start, unsigned int end, int owner) {
+        if (!_entries.empty() && _entries.back().owner == owner && _entries.back().end + 1 == start) {
+            // coalesce contiguous ranges from the same owner
+            _entries.back().end = end;
+        } else {
+            _entries.push_back({ start, end, end, owner });
+        }
+        _built = false;
+    }
+
+    void Add(const NodeRange &r, int owner) {
+        Add(r.start, r.end, owner);
+    }
+
+    void Build() {
+        std::sort(_entries.begin(), _entries.end(), [](const Entry &a, const Entry &b) {
+            return a.start < b.start;
+        });
+        BuildMaxEnd(0, _entries.size());
+        _built = true;
+    }
+
+    size_t size() const { return _entries.size(); }
+    bool empty() const { return _entries.empty(); }
+
+    // calls f(owner) for every indexed range overlapping [start, end]
+    // an owner is reported once per overlapping range so callers with multi-range owners should de-duplicate
+    template <class F>
+    void ForEachOverlap(unsigned int start, unsigned int end, F &&f) const {
+        if (_built) {
+            Query(0, _entries.size(), start, end, f);
+        }
+    }
+
+    // sorted, de-duplicated list of owners overlapping [start, end]
+    void GetOverlappingOwners(unsigned int start, unsigned int end, std::vector<int> &owners) const {
+        ForEachOverlap(start, end, [&owners](int o) { owners.push_back(o); });
+        SortUnique(owners);
+    }
+
+    template <class C>
+    void GetOverlappingOwners(const C &ranges, std::vector<int> &owners) const {
+        for (const auto &r : ranges) {
+            ForEachOverlap(r.start, r.end, [&owners](int o) { owners.push_back(o); });
+        }
+        SortUnique(owners);
+    }
+
+private:
+    struct Entry {
+        unsigned int start;
+        unsigned int end;
+        unsigned int maxEnd; // largest end in the subtree rooted at this entry
+        int owner;
+    };
+
+    static void SortUnique(std::vector<int> &v) {
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+    }
+
+    unsigned int BuildMaxEnd(size_t lo, size_t hi) {
+        if (lo >= hi) {
+            return 0;
+        }
+        size_t mid = lo + (hi - lo) / 2;
+        unsigned int m = _entries[mid].end;
+        m = std::max(m, BuildMaxEnd(lo, mid));
+        m = std::max(m, BuildMaxEnd(mid + 1, hi));
+        _entries[mid].maxEnd = m;
+        return m;
+    }
+
+    template <class F>
+    void Query(size_t lo, size_t hi, unsigned int start, unsigned int end, F &f) const {
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            const Entry &e = _entries[mid];
+            if (e.maxEnd < start) {
+                // nothing in this subtree reaches the query
+                return;
+            }
+            Query(lo, mid, start, end, f);
+            if (e.start > end) {
+                // everything to the right starts even later
+                return;
+            }
+            if (e.end >= start) {
+                f(e.owner);
+            }
+            lo = mid + 1;
+        }
+    }
+
+    std::vector<Entry> _entries;
+    bool _built = true;
+};
+
 #endif
\ No newline at end of file
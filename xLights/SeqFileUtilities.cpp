@@ -37,6 +37,7 @@
 #include "effects/MeteorsEffect.h"
 #include "effects/PinwheelEffect.h"
 #include "effects/SnowflakesEffect.h"
+#include "effects/ImageCache.h"
 #include "Vixen3.h"
 
 #include "osxMacUtils.h"
@@ -647,6 +648,8 @@ bool xLightsFrame::CloseSequence()
 
     _renderCache.CleanupCache(&mSequenceElements);
     _renderCache.SetSequence(renderCacheDirectory.ToStdString(), "");
+    ImageCache::LogStatistics();
+    ImageCache::Clear();
 
     // clear everything to prepare for new sequence
     displayElementsPanel->Clear();
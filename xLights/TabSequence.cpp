@@ -314,6 +314,7 @@ wxString xLightsFrame::LoadEffectsFileNoCheck()
         SetXmlSetting("renderCacheDir", showDirectory);
         UnsavedRgbEffectsChanges = true;
     }
+    AudioManager::SetFrameDataCacheFolder(renderCacheDirectory.ToStdString());
     if (!wxDir::Exists(backupDirectory))
     {
         logger_base.warn("Backup Directory not Found ... switching to Show Directory.");
@@ -2,6 +2,7 @@
 #define UTILCLASSES_H
 
 #include <map>
+#include <memory>
 #include <string>
 #include <algorithm>
 #include <wx/filepicker.h>
@@ -183,6 +184,8 @@ private:
     static const std::string EMPTY_STRING;
 };
 
+class EffectParameterBlock;
+
 class SettingsMap: public MapStringString {
 public:
     SettingsMap(): MapStringString() {
@@ -192,8 +195,20 @@ public:
     virtual void RemapKey(std::string &n, std::string &value) {
         RemapChangedSettingKey(n, value);
     }
+
+    void clear() {
+        MapStringString::clear();
+        _parameters.reset();
+    }
+
+    // the parsed form of these settings, set by the renderer once the settings are loaded
+    EffectParameterBlock *GetParameterBlock() const { return _parameters.get(); }
+    void SetParameterBlock(const std::shared_ptr<EffectParameterBlock> &p) { _parameters = p; }
+
 private:
     static void RemapChangedSettingKey(std::string &n,  std::string &value);
+
+    std::shared_ptr<EffectParameterBlock> _parameters;
 };
 
 class RangeAccumulator
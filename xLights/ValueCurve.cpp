@@ -1604,10 +1604,10 @@ float ValueCurve::GetValueAt(float offset, long startMS, long endMS)
             {
                 float x = (float)(cur - startMS) / (float)(endMS - startMS);
                 float f = 0.0;
-                auto pf = __audioManager->GetFrameData(FRAMEDATATYPE::FRAMEDATA_HIGH, "", cur);
-                if (pf != nullptr)
+                FrameDataSpan pf = __audioManager->GetFrameData(FRAMEDATATYPE::FRAMEDATA_HIGH, "", cur);
+                if (!pf.empty())
                 {
-                    f = *pf->begin();
+                    f = pf.front();
                 }
 
                 float y = min;
@@ -1637,10 +1637,10 @@ float ValueCurve::GetValueAt(float offset, long startMS, long endMS)
         {
             long time = (float)startMS + offset * (endMS - startMS);
             float f = 0.0;
-            auto pf = __audioManager->GetFrameData(FRAMEDATATYPE::FRAMEDATA_HIGH, "", time);
-            if (pf != nullptr)
+            FrameDataSpan pf = __audioManager->GetFrameData(FRAMEDATATYPE::FRAMEDATA_HIGH, "", time);
+            if (!pf.empty())
             {
-                f = ApplyGain(*pf->begin(), GetParameter3());
+                f = ApplyGain(pf.front(), GetParameter3());
                 if (_type == "Inverted Music")
                 {
                     f = 1.0 - f;
@@ -0,0 +1,547 @@
+#include "VideoFrameCache.h"
+#include "VideoReader.h"
+
+#include <wx/thread.h>
+#include <wx/filefn.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+
+#include <log4cpp/Category.hh>
+
+// frames are shared at up to this size and scaled down from there so large videos dont fill memory
+#define VIDEOFRAMECACHE_MAX_WIDTH 1280
+#define VIDEOFRAMECACHE_MAX_HEIGHT 720
+#define VIDEOFRAMECACHE_MAX_MEMORY (256 * 1024 * 1024)
+#define VIDEOFRAMECACHE_PREFETCH_FRAMES 10
+// readers showing the same video at different offsets each get a decoder so they dont keep seeking each other around
+#define VIDEOFRAMECACHE_MAX_DECODERS 4
+#define VIDEOFRAMECACHE_SEEK_WINDOW_MS 2000
+
+struct VideoFrame
+{
+    std::vector<uint8_t> data; // empty if the video has no frame at this time
+};
+
+class VideoFramePrefetchThread;
+
+class VideoFrameSource
+{
+    struct Decoder
+    {
+        std::mutex lock;
+        VideoReader* reader = nullptr;
+        long pos = -1000; // the last timestamp decoded, guarded by the sources lock
+        uint64_t lastUsed = 0;
+    };
+
+    struct CachedFrame
+    {
+        std::shared_ptr<const VideoFrame> frame;
+        std::list<long>::iterator lru;
+    };
+
+    struct Consumer
+    {
+        long last = 0;
+        long step = 0;
+        bool first = true;
+    };
+
+    std::string _filename;
+    int _width = 0;
+    int _height = 0;
+    int _nativeWidth = 0;
+    int _nativeHeight = 0;
+    bool _native = true;
+    int _lengthMS = 0;
+    size_t _frameBytes = 0;
+    bool _valid = false;
+
+    std::mutex _lock;
+    std::condition_variable _signal;
+    std::list<Decoder*> _decoders;
+    std::map<long, CachedFrame> _frames;
+    std::list<long> _lru; // most recently used first
+    std::set<long> _decoding;
+    std::map<const void*, Consumer> _consumers;
+    VideoFramePrefetchThread* _thread = nullptr;
+    bool _stop = false;
+    uint64_t _uses = 0;
+
+    // statistics
+    size_t _readers = 0;
+    size_t _hits = 0;
+    size_t _misses = 0;
+    size_t _decodes = 0;
+    size_t _prefetched = 0;
+
+    VideoReader* OpenReader();
+    Decoder* ChooseDecoder(long timestampMS);
+    std::shared_ptr<const VideoFrame> Decode(long timestampMS);
+    void AddFrame(long timestampMS, const std::shared_ptr<const VideoFrame>& frame);
+    bool NextPrefetch(long& timestampMS);
+
+public:
+    VideoFrameSource(const std::string& filename);
+    virtual ~VideoFrameSource();
+
+    bool IsValid() const { return _valid; }
+    int GetLengthMS() const { return _lengthMS; }
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    int GetNativeWidth() const { return _nativeWidth; }
+    int GetNativeHeight() const { return _nativeHeight; }
+
+    void AddConsumer(const void* consumer);
+    void RemoveConsumer(const void* consumer);
+    std::shared_ptr<const VideoFrame> GetFrame(const void* consumer, long timestampMS);
+
+    // used by the prefetch thread
+    bool PrefetchNext();
+    void Stop();
+};
+
+class VideoFramePrefetchThread : public wxThread
+{
+    VideoFrameSource* _source;
+
+public:
+
+    VideoFramePrefetchThread(VideoFrameSource* source) : wxThread(wxTHREAD_JOINABLE)
+    {
+        _source = source;
+    }
+
+    virtual void* Entry() override
+    {
+        while (_source->PrefetchNext())
+        {
+        }
+        return nullptr;
+    }
+};
+
+#pragma region VideoFrameSource
+
+VideoFrameSource::VideoFrameSource(const std::string& filename)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _filename = filename;
+
+    VideoReader* reader = new VideoReader(filename, 0, 0, false, true, true);
+    if (!reader->IsValid())
+    {
+        delete reader;
+        return;
+    }
+
+    _nativeWidth = reader->GetWidth();
+    _nativeHeight = reader->GetHeight();
+    _width = _nativeWidth;
+    _height = _nativeHeight;
+    _lengthMS = reader->GetLengthMS();
+
+    if (_nativeWidth > VIDEOFRAMECACHE_MAX_WIDTH || _nativeHeight > VIDEOFRAMECACHE_MAX_HEIGHT)
+    {
+        float shrink = std::min((float)VIDEOFRAMECACHE_MAX_WIDTH / (float)_nativeWidth, (float)VIDEOFRAMECACHE_MAX_HEIGHT / (float)_nativeHeight);
+        _width = std::max(1, (int)((float)_nativeWidth * shrink));
+        _height = std::max(1, (int)((float)_nativeHeight * shrink));
+        _native = false;
+        delete reader;
+        reader = OpenReader();
+        if (reader == nullptr) return;
+    }
+
+    _frameBytes = (size_t)_width * _height * 4;
+
+    Decoder* decoder = new Decoder();
+    decoder->reader = reader;
+    _decoders.push_back(decoder);
+    _valid = true;
+
+    logger_base.debug("Shared video %s opened %dx%d decoding at %dx%d.", (const char *)_filename.c_str(), _nativeWidth, _nativeHeight, _width, _height);
+
+    _thread = new VideoFramePrefetchThread(this);
+    if (_thread->Run() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("Failed to start video prefetch thread for %s ... frames will be read as they are needed.", (const char *)_filename.c_str());
+        delete _thread;
+        _thread = nullptr;
+    }
+}
+
+VideoFrameSource::~VideoFrameSource()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    Stop();
+    if (_thread != nullptr)
+    {
+        _thread->Wait();
+        delete _thread;
+        _thread = nullptr;
+    }
+
+    for (auto& it : _decoders)
+    {
+        delete it->reader;
+        delete it;
+    }
+    _decoders.clear();
+
+    if (_valid)
+    {
+        logger_base.debug("Shared video %s: readers %lu, hits %lu, misses %lu, frames decoded %lu, frames prefetched %lu.",
+            (const char *)_filename.c_str(),
+            (unsigned long)_readers,
+            (unsigned long)_hits,
+            (unsigned long)_misses,
+            (unsigned long)_decodes,
+            (unsigned long)_prefetched);
+    }
+}
+
+void VideoFrameSource::Stop()
+{
+    std::unique_lock<std::mutex> locker(_lock);
+    _stop = true;
+    _signal.notify_all();
+}
+
+VideoReader* VideoFrameSource::OpenReader()
+{
+    VideoReader* reader = nullptr;
+    if (_native)
+    {
+        reader = new VideoReader(_filename, 0, 0, false, true, true);
+    }
+    else
+    {
+        reader = new VideoReader(_filename, _width, _height, false, false, true);
+    }
+
+    if (!reader->IsValid() || reader->GetWidth() != _width || reader->GetHeight() != _height)
+    {
+        delete reader;
+        return nullptr;
+    }
+    return reader;
+}
+
+void VideoFrameSource::AddConsumer(const void* consumer)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+    _consumers[consumer] = Consumer();
+    _readers++;
+}
+
+void VideoFrameSource::RemoveConsumer(const void* consumer)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+    _consumers.erase(consumer);
+}
+
+VideoFrameSource::Decoder* VideoFrameSource::ChooseDecoder(long timestampMS)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    // prefer the decoder which can get there by reading forward the shortest distance
+    Decoder* decoder = nullptr;
+    for (auto& it : _decoders)
+    {
+        if (it->pos <= timestampMS && timestampMS - it->pos <= VIDEOFRAMECACHE_SEEK_WINDOW_MS && (decoder == nullptr || it->pos > decoder->pos))
+        {
+            decoder = it;
+        }
+    }
+
+    if (decoder == nullptr && _decoders.size() < VIDEOFRAMECACHE_MAX_DECODERS)
+    {
+        locker.unlock();
+        VideoReader* reader = OpenReader();
+        locker.lock();
+        if (reader != nullptr)
+        {
+            decoder = new Decoder();
+            decoder->reader = reader;
+            _decoders.push_back(decoder);
+        }
+    }
+
+    // otherwise the least recently used one will have to seek
+    if (decoder == nullptr)
+    {
+        for (auto& it : _decoders)
+        {
+            if (decoder == nullptr || it->lastUsed < decoder->lastUsed)
+            {
+                decoder = it;
+            }
+        }
+    }
+
+    decoder->lastUsed = ++_uses;
+    return decoder;
+}
+
+std::shared_ptr<const VideoFrame> VideoFrameSource::Decode(long timestampMS)
+{
+    Decoder* decoder = ChooseDecoder(timestampMS);
+
+    auto frame = std::make_shared<VideoFrame>();
+
+    std::unique_lock<std::mutex> decoderLocker(decoder->lock);
+    AVFrame* f = decoder->reader->GetNextFrame(timestampMS);
+    if (f != nullptr && f->data[0] != nullptr)
+    {
+        frame->data.assign(f->data[0], f->data[0] + _frameBytes);
+    }
+    long pos = decoder->reader->GetPos();
+    decoderLocker.unlock();
+
+    std::unique_lock<std::mutex> locker(_lock);
+    decoder->pos = pos;
+    _decodes++;
+    return frame;
+}
+
+// must be called with _lock held
+void VideoFrameSource::AddFrame(long timestampMS, const std::shared_ptr<const VideoFrame>& frame)
+{
+    if (_frames.find(timestampMS) != _frames.end()) return;
+
+    _lru.push_front(timestampMS);
+    _frames[timestampMS] = { frame, _lru.begin() };
+
+    while (_frames.size() > 1 && _frames.size() * _frameBytes > VIDEOFRAMECACHE_MAX_MEMORY)
+    {
+        _frames.erase(_lru.back());
+        _lru.pop_back();
+    }
+}
+
+// must be called with _lock held
+bool VideoFrameSource::NextPrefetch(long& timestampMS)
+{
+    // the nearest frame any reader is going to want next goes first
+    for (int i = 1; i <= VIDEOFRAMECACHE_PREFETCH_FRAMES; i++)
+    {
+        for (auto& it : _consumers)
+        {
+            if (it.second.first || it.second.step <= 0) continue;
+
+            long ts = it.second.last + i * it.second.step;
+            if (ts > _lengthMS) continue;
+
+            if (_frames.find(ts) == _frames.end() && _decoding.find(ts) == _decoding.end())
+            {
+                timestampMS = ts;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool VideoFrameSource::PrefetchNext()
+{
+    std::unique_lock<std::mutex> locker(_lock);
+    while (!_stop)
+    {
+        long next = 0;
+        if (NextPrefetch(next))
+        {
+            _decoding.insert(next);
+            locker.unlock();
+            auto frame = Decode(next);
+            locker.lock();
+            _decoding.erase(next);
+            AddFrame(next, frame);
+            _prefetched++;
+            _signal.notify_all();
+            return true;
+        }
+        _signal.wait(locker);
+    }
+    return false;
+}
+
+std::shared_ptr<const VideoFrame> VideoFrameSource::GetFrame(const void* consumer, long timestampMS)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    // learn how far apart this readers frames are so we know what to prefetch
+    auto& c = _consumers[consumer];
+    if (!c.first && timestampMS > c.last)
+    {
+        c.step = timestampMS - c.last;
+    }
+    c.last = timestampMS;
+    c.first = false;
+    _signal.notify_all();
+
+    while (true)
+    {
+        auto it = _frames.find(timestampMS);
+        if (it != _frames.end())
+        {
+            _hits++;
+            _lru.splice(_lru.begin(), _lru, it->second.lru);
+            return it->second.frame;
+        }
+
+        // if another reader or the prefetcher is already decoding it then waiting is quicker than decoding it again
+        if (_decoding.find(timestampMS) == _decoding.end()) break;
+        _signal.wait(locker);
+    }
+
+    _misses++;
+    _decoding.insert(timestampMS);
+    locker.unlock();
+    auto frame = Decode(timestampMS);
+    locker.lock();
+    _decoding.erase(timestampMS);
+    AddFrame(timestampMS, frame);
+    _signal.notify_all();
+    return frame;
+}
+
+#pragma endregion
+
+static std::mutex __sourcesLock;
+static std::map<std::string, std::weak_ptr<VideoFrameSource>> __sources;
+
+static std::shared_ptr<VideoFrameSource> GetSource(const std::string& filename)
+{
+    std::string key = filename + "|" + std::to_string((long long)wxFileModificationTime(filename));
+
+    std::unique_lock<std::mutex> locker(__sourcesLock);
+    for (auto it = __sources.begin(); it != __sources.end(); )
+    {
+        if (it->second.expired())
+        {
+            it = __sources.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    auto it = __sources.find(key);
+    if (it != __sources.end())
+    {
+        auto source = it->second.lock();
+        if (source != nullptr) return source;
+    }
+
+    auto source = std::make_shared<VideoFrameSource>(filename);
+    __sources[key] = source;
+    return source;
+}
+
+#pragma region SharedVideoReader
+
+SharedVideoReader::SharedVideoReader(const std::string& filename, int width, int height, bool keepaspectratio)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _source = GetSource(filename);
+    if (!_source->IsValid()) return;
+
+    _source->AddConsumer(this);
+
+    // the same size a VideoReader would have scaled to
+    if (keepaspectratio)
+    {
+        float shrink = std::min((float)width / (float)_source->GetNativeWidth(), (float)height / (float)_source->GetNativeHeight());
+        _width = (int)((float)_source->GetNativeWidth() * shrink);
+        _height = (int)((float)_source->GetNativeHeight() * shrink);
+    }
+    else
+    {
+        _width = width;
+        _height = height;
+    }
+    _width = std::max(_width, 1);
+    _height = std::max(_height, 1);
+
+    if (_width != _source->GetWidth() || _height != _source->GetHeight())
+    {
+        _swsCtx = sws_getContext(_source->GetWidth(), _source->GetHeight(), AV_PIX_FMT_RGBA,
+            _width, _height, AV_PIX_FMT_RGBA, SWS_BICUBIC, nullptr, nullptr, nullptr);
+        if (_swsCtx == nullptr)
+        {
+            logger_base.error("SharedVideoReader: Error creating SWSContext for %s.", (const char *)filename.c_str());
+        }
+        _scaled.resize((size_t)_width * _height * 4);
+    }
+}
+
+SharedVideoReader::~SharedVideoReader()
+{
+    if (_swsCtx != nullptr)
+    {
+        sws_freeContext(_swsCtx);
+        _swsCtx = nullptr;
+    }
+    _frame = nullptr;
+    if (_source != nullptr)
+    {
+        _source->RemoveConsumer(this);
+    }
+}
+
+bool SharedVideoReader::IsValid() const
+{
+    return _source->IsValid() && (_swsCtx != nullptr || _scaled.empty());
+}
+
+int SharedVideoReader::GetLengthMS() const
+{
+    return IsValid() ? _source->GetLengthMS() : 0;
+}
+
+void SharedVideoReader::Seek(int timestampMS)
+{
+    _atEnd = timestampMS >= GetLengthMS();
+}
+
+const uint8_t* SharedVideoReader::GetNextFrame(int timestampMS)
+{
+    if (!IsValid()) return nullptr;
+
+    if (timestampMS > _source->GetLengthMS())
+    {
+        _atEnd = true;
+        return nullptr;
+    }
+
+    _frame = _source->GetFrame(this, timestampMS);
+    if (_frame == nullptr || _frame->data.empty())
+    {
+        _atEnd = true;
+        return nullptr;
+    }
+
+    if (_swsCtx == nullptr)
+    {
+        return _frame->data.data();
+    }
+
+    const uint8_t* srcData[4] = { _frame->data.data(), nullptr, nullptr, nullptr };
+    int srcLinesize[4] = { _source->GetWidth() * 4, 0, 0, 0 };
+    uint8_t* dstData[4] = { _scaled.data(), nullptr, nullptr, nullptr };
+    int dstLinesize[4] = { _width * 4, 0, 0, 0 };
+    sws_scale(_swsCtx, srcData, srcLinesize, 0, _source->GetHeight(), dstData, dstLinesize);
+
+    return _scaled.data();
+}
+
+#pragma endregion
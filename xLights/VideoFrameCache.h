@@ -0,0 +1,42 @@
+#ifndef VIDEOFRAMECACHE_H
+#define VIDEOFRAMECACHE_H
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+class VideoFrameSource;
+struct VideoFrame;
+struct SwsContext;
+
+// A reader of a video file whose frames are shared with every other reader of the same file. Each timestamp is
+// decoded once, each reader scales the shared frame to its own size and the timestamps readers are likely to ask
+// for next are decoded ahead on a background thread. Frames are always RGBA.
+class SharedVideoReader
+{
+    std::shared_ptr<VideoFrameSource> _source;
+    std::shared_ptr<const VideoFrame> _frame;
+    std::vector<uint8_t> _scaled;
+    SwsContext* _swsCtx = nullptr;
+    int _width = 0;
+    int _height = 0;
+    bool _atEnd = false;
+
+public:
+    SharedVideoReader(const std::string& filename, int width, int height, bool keepaspectratio);
+    virtual ~SharedVideoReader();
+
+    bool IsValid() const;
+    int GetLengthMS() const;
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    int GetPixelChannels() const { return 4; }
+    bool AtEnd() const { return _atEnd; }
+    void Seek(int timestampMS);
+
+    // returns GetWidth() x GetHeight() pixels which remain valid until the next call or nullptr if there is no frame
+    const uint8_t* GetNextFrame(int timestampMS);
+};
+
+#endif // VIDEOFRAMECACHE_H
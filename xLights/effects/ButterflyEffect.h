@@ -22,6 +22,7 @@ class ButterflyEffect : public RenderableEffect
         virtual bool AppropriateOnNodes() const override { return false; }
         virtual bool CanRenderPartialTimeInterval() const override { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         virtual wxPanel *CreatePanel(wxWindow *parent) override;
@@ -55,6 +55,7 @@ class FanEffect : public RenderableEffect
         virtual bool SupportsRadialColorCurves(const SettingsMap &SettingsMap) const override { return true; }
         virtual bool CanRenderPartialTimeInterval() const override { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         virtual wxPanel *CreatePanel(wxWindow *parent) override;
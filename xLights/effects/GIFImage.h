@@ -24,7 +24,6 @@ class GIFImage
     bool _ok;
 	
 	void ReadFrameProperties();
-    int CalcFrameForTime(int msec, bool loop);
     wxPoint LoadRawImageFrame(wxImage& image, int frame, wxAnimationDisposal& disposal);
     void CopyImageToImage(wxImage& to, wxImage& from, wxPoint offset, bool overlay, bool dontaddtransparency = false);
     void DoCreate(const std::string& filename);
@@ -34,9 +33,11 @@ class GIFImage
 		virtual ~GIFImage();
 		wxImage GetFrame(int frame);
 		wxImage GetFrameForTime(int msec, bool loop);
+        int CalcFrameForTime(int msec, bool loop);
         int GetMSUntilNextFrame(int msec, bool loop);
         std::string GetFilename() const { return _filename; }
         bool IsOk() const { return _ok; }
+        wxSize GetImageSize() const { return _gifSize; }
 
 		static bool IsGIF(const std::string& filename);
 };
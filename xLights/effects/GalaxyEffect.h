@@ -45,6 +45,7 @@ class GalaxyEffect : public RenderableEffect
         virtual void SetDefaultParameters() override;
         virtual bool CanRenderPartialTimeInterval() const override { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         virtual wxPanel *CreatePanel(wxWindow *parent) override;
@@ -0,0 +1,286 @@
+#include "ImageCache.h"
+#include "GIFImage.h"
+
+#include <wx/filefn.h>
+#include <wx/log.h>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include <log4cpp/Category.hh>
+
+// GIF decoders hold every raw frame of the file so we only keep a few of them around
+#define IMAGECACHE_MAX_GIF_DECODERS 16
+
+struct CachedImage
+{
+    std::string key;
+    std::shared_ptr<const wxImage> image;
+    size_t bytes;
+};
+
+// GIF frames are built up from the frames before them so each file has one decoder used by one thread at a time
+struct CachedGIFDecoder
+{
+    std::mutex lock;
+    std::unique_ptr<GIFImage> gif;
+    time_t modified = 0;
+};
+
+static std::mutex __lock;
+static std::list<CachedImage> __images; // most recently used first
+static std::map<std::string, std::list<CachedImage>::iterator> __index;
+static std::map<std::string, std::pair<time_t, int>> __imageCounts;
+static std::list<std::pair<std::string, std::shared_ptr<CachedGIFDecoder>>> __decoders; // most recently used first
+static size_t __memory = 0;
+static size_t __hits = 0;
+static size_t __misses = 0;
+
+static size_t ImageBytes(const wxImage& image)
+{
+    size_t pixels = (size_t)image.GetWidth() * image.GetHeight();
+    return pixels * (image.HasAlpha() ? 4 : 3);
+}
+
+static std::string MakeKey(const std::string& filename, time_t modified, int frame, int width, int height, bool suppressGIFBackground)
+{
+    return filename + "|" + std::to_string((long long)modified) + "|" + std::to_string(frame) + "|" +
+        std::to_string(width) + "x" + std::to_string(height) + "|" + (suppressGIFBackground ? "1" : "0");
+}
+
+// must be called with __lock held
+static std::shared_ptr<const wxImage> FindImage(const std::string& key)
+{
+    auto it = __index.find(key);
+    if (it == __index.end())
+    {
+        __misses++;
+        return nullptr;
+    }
+
+    __hits++;
+    __images.splice(__images.begin(), __images, it->second);
+    return it->second->image;
+}
+
+// must be called with __lock held. Takes ownership of image.
+static std::shared_ptr<const wxImage> AddImage(const std::string& key, wxImage* image)
+{
+    // another thread may have loaded it while we were
+    auto it = __index.find(key);
+    if (it != __index.end())
+    {
+        delete image;
+        __images.splice(__images.begin(), __images, it->second);
+        return it->second->image;
+    }
+
+    CachedImage ci;
+    ci.key = key;
+    ci.image = std::shared_ptr<const wxImage>(image);
+    ci.bytes = ImageBytes(*image);
+    __images.push_front(ci);
+    __index[key] = __images.begin();
+    __memory += ci.bytes;
+
+    // the image we just added is always kept even if it is bigger than the limit
+    while (__memory > IMAGECACHE_MAX_MEMORY && __images.size() > 1)
+    {
+        __memory -= __images.back().bytes;
+        __index.erase(__images.back().key);
+        __images.pop_back();
+    }
+
+    return ci.image;
+}
+
+static std::shared_ptr<CachedGIFDecoder> GetDecoder(const std::string& filename, time_t modified, bool suppressGIFBackground)
+{
+    std::string key = filename + "|" + (suppressGIFBackground ? "1" : "0");
+
+    std::unique_lock<std::mutex> locker(__lock);
+    for (auto it = __decoders.begin(); it != __decoders.end(); ++it)
+    {
+        if (it->first == key)
+        {
+            if (it->second->modified == modified)
+            {
+                __decoders.splice(__decoders.begin(), __decoders, it);
+                return it->second;
+            }
+            __decoders.erase(it);
+            break;
+        }
+    }
+
+    auto decoder = std::make_shared<CachedGIFDecoder>();
+    decoder->modified = modified;
+    __decoders.push_front({ key, decoder });
+    while (__decoders.size() > IMAGECACHE_MAX_GIF_DECODERS)
+    {
+        __decoders.pop_back();
+    }
+    return decoder;
+}
+
+// must be called with the decoders lock held
+static bool OpenDecoder(CachedGIFDecoder* decoder, const std::string& filename, bool suppressGIFBackground)
+{
+    if (decoder->gif == nullptr)
+    {
+        decoder->gif = std::make_unique<GIFImage>(filename, suppressGIFBackground);
+    }
+    return decoder->gif->IsOk();
+}
+
+static wxImage* DecodeImage(const std::string& filename, time_t modified, int frame, bool animated, bool suppressGIFBackground)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (animated)
+    {
+        auto decoder = GetDecoder(filename, modified, suppressGIFBackground);
+        std::unique_lock<std::mutex> locker(decoder->lock);
+        if (!OpenDecoder(decoder.get(), filename, suppressGIFBackground)) return nullptr;
+
+        if (frame < 0)
+        {
+            return new wxImage(decoder->gif->GetImageSize());
+        }
+
+        // the decoder keeps its own reference to the frame so take a copy we can share between threads
+        return new wxImage(decoder->gif->GetFrame(frame).Copy());
+    }
+
+    wxLogNull logNo;  // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
+    wxImage* image = new wxImage();
+    if (!image->LoadFile(filename, wxBITMAP_TYPE_ANY, 0) || !image->IsOk())
+    {
+        logger_base.error("Error loading image file: %s.", (const char *)filename.c_str());
+        delete image;
+        return nullptr;
+    }
+    return image;
+}
+
+int ImageCache::GetImageCount(const std::string& filename)
+{
+    time_t modified = wxFileModificationTime(filename);
+
+    {
+        std::unique_lock<std::mutex> locker(__lock);
+        auto it = __imageCounts.find(filename);
+        if (it != __imageCounts.end() && it->second.first == modified)
+        {
+            return it->second.second;
+        }
+    }
+
+    wxLogNull logNo;  // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
+    int count = wxImage::GetImageCount(filename);
+
+    std::unique_lock<std::mutex> locker(__lock);
+    __imageCounts[filename] = { modified, count };
+    return count;
+}
+
+std::shared_ptr<const wxImage> ImageCache::GetImage(const std::string& filename, int frame, bool suppressGIFBackground)
+{
+    time_t modified = wxFileModificationTime(filename);
+    bool animated = GetImageCount(filename) > 1;
+    if (!animated)
+    {
+        frame = 0;
+        suppressGIFBackground = false;
+    }
+    std::string key = MakeKey(filename, modified, frame, 0, 0, suppressGIFBackground);
+
+    {
+        std::unique_lock<std::mutex> locker(__lock);
+        auto image = FindImage(key);
+        if (image != nullptr) return image;
+    }
+
+    // decode without holding the lock so other threads can keep using the cache
+    wxImage* image = DecodeImage(filename, modified, frame, animated, suppressGIFBackground);
+    if (image == nullptr) return nullptr;
+
+    std::unique_lock<std::mutex> locker(__lock);
+    return AddImage(key, image);
+}
+
+std::shared_ptr<const wxImage> ImageCache::GetImage(const std::string& filename, int frame, int width, int height, bool suppressGIFBackground)
+{
+    width = std::max(width, 1);
+    height = std::max(height, 1);
+
+    time_t modified = wxFileModificationTime(filename);
+    if (GetImageCount(filename) <= 1)
+    {
+        frame = 0;
+        suppressGIFBackground = false;
+    }
+    std::string key = MakeKey(filename, modified, frame, width, height, suppressGIFBackground);
+
+    {
+        std::unique_lock<std::mutex> locker(__lock);
+        auto image = FindImage(key);
+        if (image != nullptr) return image;
+    }
+
+    auto raw = GetImage(filename, frame, suppressGIFBackground);
+    if (raw == nullptr) return nullptr;
+    if (raw->GetWidth() == width && raw->GetHeight() == height) return raw;
+
+    wxImage* image = new wxImage(raw->Scale(width, height));
+
+    std::unique_lock<std::mutex> locker(__lock);
+    return AddImage(key, image);
+}
+
+int ImageCache::GetGIFFrameForTime(const std::string& filename, int msec, bool loop, bool suppressGIFBackground)
+{
+    auto decoder = GetDecoder(filename, wxFileModificationTime(filename), suppressGIFBackground);
+    std::unique_lock<std::mutex> locker(decoder->lock);
+    if (!OpenDecoder(decoder.get(), filename, suppressGIFBackground)) return -1;
+    return decoder->gif->CalcFrameForTime(msec, loop);
+}
+
+void ImageCache::Clear()
+{
+    std::unique_lock<std::mutex> locker(__lock);
+    __images.clear();
+    __index.clear();
+    __imageCounts.clear();
+    __decoders.clear();
+    __memory = 0;
+}
+
+void ImageCache::GetStatistics(size_t& hits, size_t& misses, size_t& images, size_t& bytes)
+{
+    std::unique_lock<std::mutex> locker(__lock);
+    hits = __hits;
+    misses = __misses;
+    images = __images.size();
+    bytes = __memory;
+}
+
+void ImageCache::LogStatistics()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    size_t hits;
+    size_t misses;
+    size_t images;
+    size_t bytes;
+    GetStatistics(hits, misses, images, bytes);
+
+    logger_base.debug("Image cache: hits %lu, misses %lu, hit rate %d%%, %lu images using %luKB.",
+        (unsigned long)hits,
+        (unsigned long)misses,
+        (hits + misses == 0) ? 0 : (int)(hits * 100 / (hits + misses)),
+        (unsigned long)images,
+        (unsigned long)(bytes / 1024));
+}
@@ -0,0 +1,31 @@
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <string>
+#include <memory>
+#include <wx/image.h>
+
+#define IMAGECACHE_MAX_MEMORY (256 * 1024 * 1024)
+
+// Process wide cache of decoded and rescaled images shared by every effect and model that shows the same file.
+// Entries are keyed by file, modification time, frame and size and the least recently used are dropped once the
+// cache holds more than its memory limit. Returned images are shared between render threads so must not be
+// modified or copied by assignment ... use Copy() if you need to change one.
+class ImageCache
+{
+public:
+
+    // returns nullptr if the file cannot be read. Frame is only used for animated GIFs where -1 is a blank frame
+    static std::shared_ptr<const wxImage> GetImage(const std::string& filename, int frame = 0, bool suppressGIFBackground = true);
+    static std::shared_ptr<const wxImage> GetImage(const std::string& filename, int frame, int width, int height, bool suppressGIFBackground = true);
+    static int GetImageCount(const std::string& filename);
+
+    // the GIF frame to show msec into the animation or -1 if a non looping animation has finished
+    static int GetGIFFrameForTime(const std::string& filename, int msec, bool loop, bool suppressGIFBackground = true);
+
+    static void Clear();
+    static void GetStatistics(size_t& hits, size_t& misses, size_t& images, size_t& bytes);
+    static void LogStatistics();
+};
+
+#endif
@@ -347,19 +347,19 @@ void MusicEffect::CreateEvents(RenderBuffer& buffer, std::vector<std::list<Music
     // go through each frame and extract the data i need
     for (int f = buffer.curEffStartPer; f <= buffer.curEffEndPer; f++)
     {
-        std::list<float>* pdata = buffer.GetMedia()->GetFrameData(f, FRAMEDATATYPE::FRAMEDATA_VU, "");
+        FrameDataSpan pdata = buffer.GetMedia()->GetFrameData(f, FRAMEDATATYPE::FRAMEDATA_VU, "");
 
-        if (pdata != nullptr)
+        if (!pdata.empty())
         {
-            auto pn = pdata->begin();
+            auto pn = pdata.begin();
 
             // skip to start note
-            for (int i = 0; i < startNote && pn != pdata->end(); i++)
+            for (int i = 0; i < startNote && pn != pdata.end(); i++)
             {
                 ++pn;
             }
 
-            for (int b = 0; b < bars && pn != pdata->end(); b++)
+            for (int b = 0; b < bars && pn != pdata.end(); b++)
             {
                 float val = 0.0;
                 int thisper = static_cast<int>(notesperbar);
@@ -367,7 +367,7 @@ void MusicEffect::CreateEvents(RenderBuffer& buffer, std::vector<std::list<Music
                 {
                     thisper = LogarithmicScale::GetLogSum(b + 1) - LogarithmicScale::GetLogSum(b);
                 }
-                for (auto n = 0; n < thisper && pn != pdata->end(); n++)
+                for (auto n = 0; n < thisper && pn != pdata.end(); n++)
                 {
                     val = std::max(val, *pn);
                     ++pn;
@@ -1,4 +1,5 @@
 #include <vector>
+#include <algorithm>
 
 #include "../../include/piano-16.xpm"
 #include "../../include/piano-64.xpm"
@@ -35,7 +36,7 @@ std::list<std::string> PianoEffect::CheckEffectSettings(const SettingsMap& setti
     }
     else
     {
-        std::map<int, std::list<float>> timings = LoadTimingTrack(settings.Get("E_CHOICE_Piano_MIDITrack_APPLYLAST", ""), 50);
+        std::map<int, std::vector<float>> timings = LoadTimingTrack(settings.Get("E_CHOICE_Piano_MIDITrack_APPLYLAST", ""), 50);
         if (timings.size() == 0)
         {
             res.push_back(wxString::Format("    ERR: Piano effect timing track '%s' has no notes. Model '%s', Start %s", settings.Get("E_CHOICE_Piano_MIDITrack_APPLYLAST", ""), model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
@@ -158,7 +159,7 @@ public:
 	PianoCache() { };
 	virtual ~PianoCache() { };
 
-	std::map<int, std::list<float>> _timings;
+	std::map<int, std::vector<float>> _timings;
 	std::string _MIDItrack;
 };
 
@@ -171,7 +172,7 @@ void PianoEffect::RenderPiano(RenderBuffer &buffer, SequenceElements *elements,
 		buffer.infoCache[id] = cache;
 	}
 
-	std::map<int, std::list<float>>& _timings = cache->_timings;
+	std::map<int, std::vector<float>>& _timings = cache->_timings;
 	std::string& _MIDITrack = cache->_MIDItrack;
 
 	if (buffer.needToInit)
@@ -208,22 +209,16 @@ void PianoEffect::RenderPiano(RenderBuffer &buffer, SequenceElements *elements,
 		em = startmidi + buffer.BufferWi - 1;
 	}
 
-    std::list<float> def;
-	std::list<float>* pdata = nullptr;
+	std::vector<float> pdata;
 
 	int time = buffer.curPeriod * buffer.frameTimeInMs;
-	if (_timings.find(time) != _timings.end())
+	auto it = _timings.find(time);
+	if (it != _timings.end())
 	{
-		pdata = &_timings[time];
+		// reduce into a copy so the cached notes are left untouched for the next render
+		pdata = ReduceChannels(it->second, startmidi, em, sharps);
 	}
 
-    if (pdata == nullptr)
-    {
-        pdata = &def;
-    }
-
-	ReduceChannels(pdata, startmidi, em, sharps);
-
 	if (type == "True Piano")
 	{
 		DrawTruePiano(buffer, pdata, sharps, startmidi, em, scale, xoffset);
@@ -245,48 +240,31 @@ bool PianoEffect::IsSharp(float f)
 		x == 10);
 }
 
-void PianoEffect::ReduceChannels(std::list<float>* pdata, int start, int end, bool sharps)
+std::vector<float> PianoEffect::ReduceChannels(const std::vector<float>& notes, int start, int end, bool sharps)
 {
-	auto it = pdata->begin();
-	while (it != pdata->end())
+	std::vector<float> res;
+	res.reserve(notes.size());
+	for (auto n : notes)
 	{
-		if (!sharps && IsSharp(*it))
-		{
-			float n = *it - 1.0;
-			bool found = false;
-			for (auto c = pdata->begin(); c != pdata->end(); ++c)
-			{
-				if (*c == n)
-				{
-					// already there
-					found = true;
-					break;
-				}
-			}
-			if (!found)
-			{
-				pdata->push_back(n);
-			}
-			pdata->remove(*it);
-			it = pdata->begin();
-		}
-		else if (*it < start || *it > end)
+		// without sharps a sharp is shown as the note below it
+		if (!sharps && IsSharp(n))
 		{
-			pdata->remove(*it);
-			it = pdata->begin();
+			n -= 1.0;
 		}
-		else
+
+		if (n >= start && n <= end && std::find(res.begin(), res.end(), n) == res.end())
 		{
-			++it;
+			res.push_back(n);
 		}
 	}
+	return res;
 }
 
-bool PianoEffect::KeyDown(std::list<float>* pdata, int ch)
+bool PianoEffect::KeyDown(const std::vector<float>& pdata, int ch)
 {
-	for (auto it = pdata->begin(); it != pdata->end(); ++it)
+	for (const auto& it : pdata)
 	{
-		if (ch == (int)(*it))
+		if (ch == (int)it)
 		{
 			return true;
 		}
@@ -295,7 +273,7 @@ bool PianoEffect::KeyDown(std::list<float>* pdata, int ch)
 	return false;
 }
 
-void PianoEffect::DrawTruePiano(RenderBuffer &buffer, std::list<float>* pdata, bool sharps, int start, int end, int scale, int xoffset)
+void PianoEffect::DrawTruePiano(RenderBuffer &buffer, const std::vector<float>& pdata, bool sharps, int start, int end, int scale, int xoffset)
 {
     int truexoffset = xoffset * buffer.BufferWi / 100;
 	xlColor wkcolour, bkcolour, wkdcolour, bkdcolour, kbcolour;
@@ -479,7 +457,7 @@ void PianoEffect::DrawTruePiano(RenderBuffer &buffer, std::list<float>* pdata, b
 	}
 }
 
-void PianoEffect::DrawBarsPiano(RenderBuffer &buffer, std::list<float>* pdata, bool sharps, int start, int end, int scale, int xoffset)
+void PianoEffect::DrawBarsPiano(RenderBuffer &buffer, const std::vector<float>& pdata, bool sharps, int start, int end, int scale, int xoffset)
 {
     int truexoffset = xoffset * buffer.BufferWi / 100;
     xlColor wkcolour, bkcolour, wkdcolour, bkdcolour;
@@ -711,10 +689,10 @@ int PianoEffect::ConvertNote(std::string& note)
     return number;
 }
 
-std::map<int, std::list<float>> PianoEffect::LoadTimingTrack(std::string track, int intervalMS)
+std::map<int, std::vector<float>> PianoEffect::LoadTimingTrack(std::string track, int intervalMS)
 {
     static log4cpp::Category &logger_pianodata = log4cpp::Category::getInstance(std::string("log_pianodata"));
-    std::map<int, std::list<float>> res;
+    std::map<int, std::vector<float>> res;
 
     logger_pianodata.debug("Loading timings from timing track " + track);
 
@@ -735,7 +713,7 @@ std::map<int, std::list<float>> PianoEffect::LoadTimingTrack(std::string track,
 
     for (int j = 0; j < el->GetEffectCount(); j++)
     {
-        std::list<float> notes;
+        std::vector<float> notes;
         int starttime = el->GetEffect(j)->GetStartTimeMS();
         int endtime = el->GetEffect(j)->GetEndTimeMS();
         std::string label = el->GetEffect(j)->GetEffectName();
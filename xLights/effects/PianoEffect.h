@@ -36,12 +36,12 @@ class PianoEffect : public RenderableEffect
     
 		PianoPanel* _panel;
 		void RenderPiano(RenderBuffer &buffer, SequenceElements *elements, const int startmidi, const int endmidi, const bool sharps, const std::string type, int scale, std::string MIDITrack, int xoffset);
-		void ReduceChannels(std::list<float>* pdata, int start, int end, bool sharps);
-		void DrawTruePiano(RenderBuffer &buffer, std::list<float>* pdata, bool sharps, int start, int end, int scale, int xoffset);
-		void DrawBarsPiano(RenderBuffer &buffer, std::list<float>* pdata, bool sharps, int start, int end, int scale, int xoffset);
+		std::vector<float> ReduceChannels(const std::vector<float>& notes, int start, int end, bool sharps);
+		void DrawTruePiano(RenderBuffer &buffer, const std::vector<float>& pdata, bool sharps, int start, int end, int scale, int xoffset);
+		void DrawBarsPiano(RenderBuffer &buffer, const std::vector<float>& pdata, bool sharps, int start, int end, int scale, int xoffset);
 		bool IsSharp(float f);
-		bool KeyDown(std::list<float>* pdata, int ch);
-        std::map<int, std::list<float>> LoadTimingTrack(std::string track, int intervalMS);
+		bool KeyDown(const std::vector<float>& pdata, int ch);
+        std::map<int, std::vector<float>> LoadTimingTrack(std::string track, int intervalMS);
         std::list<std::string> ExtractNotes(std::string& label);
         int ConvertNote(std::string& note);
 };
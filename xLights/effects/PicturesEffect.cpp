@@ -19,7 +19,7 @@
 #include "../xLightsXmlFile.h"
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
-#include "GIFImage.h"
+#include "ImageCache.h"
 #include "../xLightsMain.h" 
 
 #include <log4cpp/Category.hh>
@@ -237,22 +237,17 @@ typedef std::vector< std::pair<wxPoint, xlColor> > PixelVector;
 
 class PicturesRenderCache : public EffectRenderCache {
 public:
-    PicturesRenderCache() : imageCount(0), frame(0),  gifImage(nullptr), maxmovieframes(0) {};
-    virtual ~PicturesRenderCache()
-    {
-        if (gifImage != nullptr) {
-            delete gifImage;
-            gifImage = nullptr;
-        }
-    };
+    PicturesRenderCache() : imageCount(0), frame(0), maxmovieframes(0), placeholder(false) {};
+    virtual ~PicturesRenderCache() {};
 
-    wxImage image;
-    wxImage rawimage;
+    // decoded images are shared with other buffers through the ImageCache so must not be modified
+    std::shared_ptr<const wxImage> image;
+    std::shared_ptr<const wxImage> rawimage;
     int imageCount;
     int frame;
     int maxmovieframes;
+    bool placeholder;
     wxString PictureName;
-    GIFImage* gifImage;
     std::vector<PixelVector> PixelsByFrame;
 };
 
@@ -283,12 +278,10 @@ void PicturesEffect::LoadPixelsFromTextFile(RenderBuffer &buffer, wxFile& debug,
     wxByte rgb[3] = { 0,0,0 };
     PicturesRenderCache *cache = GetCache(buffer);
     cache->imageCount = 0;
-    wxImage &image = cache->image;
-    wxImage &rawimage = cache->rawimage;
     std::vector<PixelVector> &PixelsByFrame = cache->PixelsByFrame;
 
-    if (image.GetWidth() && image.GetHeight()) image.Clear(); //CAUTION: image must be non-empty to clear it (memory error otherwise)
-    if (rawimage.GetWidth() && rawimage.GetHeight()) rawimage.Clear(); //CAUTION: image must be non-empty to clear it (memory error otherwise)
+    cache->image.reset();
+    cache->rawimage.reset();
 
     if (!cache->PictureName.CmpNoCase(filename)) { wrdebug("no change: " + filename); return; }
     if (!wxFileExists(filename)) { wrdebug("not found: " + filename); return; }
@@ -477,6 +470,25 @@ void PicturesEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuff
     );
 }
 
+// rescaled images come from the shared cache unless we are showing a placeholder for a file that could not be read
+static std::shared_ptr<const wxImage> GetScaledImage(const std::string& filename, int frame, const std::shared_ptr<const wxImage>& rawimage, int width, int height, bool suppressGIFBackground, bool placeholder)
+{
+    width = std::max(width, 1);
+    height = std::max(height, 1);
+    if (rawimage->GetWidth() == width && rawimage->GetHeight() == height) return rawimage;
+
+    std::shared_ptr<const wxImage> image;
+    if (!placeholder)
+    {
+        image = ImageCache::GetImage(filename, frame, width, height, suppressGIFBackground);
+    }
+    if (image == nullptr)
+    {
+        image = std::make_shared<wxImage>(rawimage->Scale(width, height));
+    }
+    return image;
+}
+
 void PicturesEffect::Render(RenderBuffer &buffer,
     const std::string & dirstr, const std::string &NewPictureName2,
     float movementSpeed, float frameRateAdj,
@@ -509,9 +521,8 @@ void PicturesEffect::Render(RenderBuffer &buffer,
     //      ffmpeg -i XXXX.mts -s 16x50 XXXX-%d.jpg
 
     PicturesRenderCache *cache = GetCache(buffer);
-    wxImage &image = cache->image;
-    wxImage &rawimage = cache->rawimage;
-    GIFImage*& gifImage = cache->gifImage;
+    std::shared_ptr<const wxImage> &image = cache->image;
+    std::shared_ptr<const wxImage> &rawimage = cache->rawimage;
     std::vector<PixelVector> &PixelsByFrame = cache->PixelsByFrame;
     int &frame = cache->frame;
 
@@ -576,18 +587,19 @@ void PicturesEffect::Render(RenderBuffer &buffer,
         return;
     }
 
+    std::string pictureName = NewPictureName.ToStdString();
+    int gifFrame = 0;
+
     if (NewPictureName != cache->PictureName || buffer.needToInit)
     {
         buffer.needToInit = false;
         scale_image = true;
 
-        wxLogNull logNo;  // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
-
         // There seems to be a bug on linux where this function crashes occasionally
 #ifdef LINUX
         logger_base.debug("About to count images in bitmap %s.", (const char *)NewPictureName.c_str());
 #endif
-        cache->imageCount = wxImage::GetImageCount(NewPictureName);
+        cache->imageCount = ImageCache::GetImageCount(pictureName);
         if (cache->imageCount <= 0)
         {
             logger_base.error("Image %s reports %d frames which is invalid. Overriding it to be 1.", (const char *)NewPictureName.c_str(), cache->imageCount);
@@ -596,39 +608,28 @@ void PicturesEffect::Render(RenderBuffer &buffer,
             cache->imageCount = 1;
         }
 
-        if (!image.LoadFile(NewPictureName, wxBITMAP_TYPE_ANY, 0))
-        {
-            logger_base.error("Error loading image file: %s.", (const char *)NewPictureName.c_str());
-            image.Create(5, 5, true);
-        }
-
-        rawimage = image;
         cache->PictureName = NewPictureName;
+        cache->placeholder = false;
 
         if (cache->imageCount > 1)
         {
 #ifdef DEBUG_GIF
             logger_base.debug("Preparing GIF file for reading: %s", (const char *)NewPictureName.c_str());
 #endif
-            if (gifImage != nullptr && gifImage->GetFilename() != NewPictureName)
-            {
-                delete gifImage;
-                gifImage = nullptr;
-            }
-            gifImage = new GIFImage(NewPictureName.ToStdString(), suppressGIFBackground);
-
-            if (!gifImage->IsOk())
+            rawimage = ImageCache::GetImage(pictureName, 0, suppressGIFBackground);
+        }
+        else
+        {
+            rawimage = ImageCache::GetImage(pictureName);
+            if (rawimage == nullptr)
             {
-                delete gifImage;
-                gifImage = nullptr;
-                return;
+                rawimage = std::make_shared<wxImage>(5, 5, true);
+                cache->placeholder = true;
             }
-
-            image = gifImage->GetFrame(0);
-            rawimage = image;
         }
+        image = rawimage;
 
-        if (!image.IsOk())
+        if (image == nullptr || !image->IsOk())
             return;
     }
 
@@ -639,17 +640,17 @@ void PicturesEffect::Render(RenderBuffer &buffer,
 
         if (loopGIF)
         {
-            image = gifImage->GetFrameForTime((buffer.curPeriod - buffer.curEffStartPer) * buffer.frameTimeInMs * frameRateAdj, true);
+            gifFrame = ImageCache::GetGIFFrameForTime(pictureName, (buffer.curPeriod - buffer.curEffStartPer) * buffer.frameTimeInMs * frameRateAdj, true, suppressGIFBackground);
         }
         else
         {
-            int ii = cache->imageCount * buffer.GetEffectTimeIntervalPosition(frameRateAdj) * 0.99;
-            image = gifImage->GetFrame(ii);
+            gifFrame = cache->imageCount * buffer.GetEffectTimeIntervalPosition(frameRateAdj) * 0.99;
         }
 
-        rawimage = image;
+        rawimage = ImageCache::GetImage(pictureName, gifFrame, suppressGIFBackground);
+        image = rawimage;
 
-        if (!rawimage.IsOk())
+        if (rawimage == nullptr || !rawimage->IsOk())
             return;
     }
 
@@ -659,29 +660,31 @@ void PicturesEffect::Render(RenderBuffer &buffer,
         scale_image = true;
     }
 
-    int imgwidth = image.GetWidth();
-    int imght = image.GetHeight();
+    // a vixen remap may have released the images
+    if (image == nullptr || rawimage == nullptr)
+        return;
+
+    int imgwidth = image->GetWidth();
+    int imght = image->GetHeight();
     int yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
     int xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
 
     if (scale_to_fit == "Scale To Fit" && (BufferWi != imgwidth || BufferHt != imght))
     {
-        image = rawimage;
-        image.Rescale(BufferWi, BufferHt);
-        imgwidth = image.GetWidth();
-        imght = image.GetHeight();
+        image = GetScaledImage(pictureName, gifFrame, rawimage, BufferWi, BufferHt, suppressGIFBackground, cache->placeholder);
+        imgwidth = image->GetWidth();
+        imght = image->GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
         xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
     }
     else if (scale_to_fit == "Scale Keep Aspect Ratio")
     {
-        image = rawimage;
-        float xr = (float)BufferWi / (float)image.GetWidth();
-        float yr = (float)BufferHt / (float)image.GetHeight();
+        float xr = (float)BufferWi / (float)rawimage->GetWidth();
+        float yr = (float)BufferHt / (float)rawimage->GetHeight();
         float sc = std::min(xr, yr);
-        image.Rescale(image.GetWidth() * sc, image.GetHeight() * sc);
-        imgwidth = image.GetWidth();
-        imght = image.GetHeight();
+        image = GetScaledImage(pictureName, gifFrame, rawimage, rawimage->GetWidth() * sc, rawimage->GetHeight() * sc, suppressGIFBackground, cache->placeholder);
+        imgwidth = image->GetWidth();
+        imght = image->GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
         xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
     }
@@ -691,11 +694,19 @@ void PicturesEffect::Render(RenderBuffer &buffer,
         {
             int delta_scale = end_scale - start_scale;
             int current_scale = start_scale + delta_scale * position;
-            imgwidth = (image.GetWidth()*current_scale) / 100;
-            imght = (image.GetHeight()*current_scale) / 100;
+            imgwidth = (image->GetWidth()*current_scale) / 100;
+            imght = (image->GetHeight()*current_scale) / 100;
             imgwidth = std::max(imgwidth, 1);
             imght = std::max(imght, 1);
-            image.Rescale(imgwidth, imght);
+            if (start_scale == end_scale)
+            {
+                image = GetScaledImage(pictureName, gifFrame, rawimage, imgwidth, imght, suppressGIFBackground, cache->placeholder);
+            }
+            else
+            {
+                // the size changes every frame so there is no point sharing it
+                image = std::make_shared<wxImage>(image->Scale(imgwidth, imght));
+            }
             yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
             xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
         }
@@ -766,7 +777,7 @@ void PicturesEffect::Render(RenderBuffer &buffer,
     }
     // copy image to buffer
     xlColor c;
-    bool hasAlpha = image.HasAlpha();
+    bool hasAlpha = image->HasAlpha();
 
     int calc_position_wi = (imgwidth + BufferWi)*position;
     int calc_position_ht = (imght + BufferHt)*position;
@@ -775,10 +786,10 @@ void PicturesEffect::Render(RenderBuffer &buffer,
     {
         for (int y = 0; y < imght; y++)
         {
-            if (!image.IsTransparent(x, y))
+            if (!image->IsTransparent(x, y))
             {
-                unsigned char alpha = hasAlpha ? image.GetAlpha(x, y) : 255;
-                c.Set(image.GetRed(x, y), image.GetGreen(x, y), image.GetBlue(x, y), alpha);
+                unsigned char alpha = hasAlpha ? image->GetAlpha(x, y) : 255;
+                c.Set(image->GetRed(x, y), image->GetGreen(x, y), image->GetBlue(x, y), alpha);
                 if (!buffer.allowAlpha && alpha < 64) {
                     //almost transparent, but this mix doesn't support transparent unless it's black;
                     c = xlBLACK;
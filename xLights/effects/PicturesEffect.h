@@ -32,6 +32,7 @@ class PicturesEffect : public RenderableEffect
         virtual bool CleanupFileLocations(xLightsFrame* frame, SettingsMap &SettingsMap) override;
         static bool IsPictureFile(std::string filename);
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         virtual wxPanel *CreatePanel(wxWindow *parent) override;
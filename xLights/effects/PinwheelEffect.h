@@ -35,6 +35,7 @@ class PinwheelEffect : public RenderableEffect
         virtual void adjustSettings(const std::string &version, Effect *effect, bool removeDefaults = true) override;
         virtual bool CanRenderPartialTimeInterval() const override { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         enum Pinwheel3DType {
@@ -265,6 +265,25 @@ bool RenderableEffect::SupportsRenderCache(const SettingsMap& settings) const
     return false;
 }
 
+bool RenderableEffect::IsSequenceIndependent(const SettingsMap& settings)
+{
+    for (const auto& it : settings)
+    {
+        // value curves driven by the audio
+        if (Contains(it.second, "Type=Music") || Contains(it.second, "Type=Inverted Music"))
+        {
+            return false;
+        }
+
+        // anything driven by a timing track
+        if (Contains(it.first, "TimingTrack") && it.second != "")
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool RenderableEffect::needToAdjustSettings(const std::string &version) {
     return IsVersionOlder("2019.61", version);
 }
@@ -890,8 +909,164 @@ void RenderableEffect::SetRadioValue(wxRadioButton *r) {
     r->ProcessWindowEvent(evt);
 }
 
+EffectParameterBlock::EffectParameterBlock(const SettingsMap &settings)
+{
+    static const std::string SLIDER = "SLIDER_";
+    static const std::string TEXTCTRL = "TEXTCTRL_";
+    static const std::string VALUECURVE = "VALUECURVE_";
+
+    for (const auto& it : settings)
+    {
+        const std::string &key = it.first;
+        bool slider = key.compare(0, SLIDER.size(), SLIDER) == 0;
+        bool text = !slider && key.compare(0, TEXTCTRL.size(), TEXTCTRL) == 0;
+        if (slider || text)
+        {
+            Parameter &p = _parameters[key.substr(slider ? SLIDER.size() : TEXTCTRL.size())];
+            // the slider wins if there is both
+            if (p.fromSlider) continue;
+            p.fromSlider = slider;
+            p.intOk = false;
+            p.doubleOk = false;
+            if (it.second.length() != 0)
+            {
+                try
+                {
+                    p.intValue = stoi(it.second);
+                    p.intOk = true;
+                }
+                catch (...) {}
+                try
+                {
+                    p.doubleValue = stod(it.second);
+                    p.doubleOk = true;
+                }
+                catch (...) {}
+            }
+        }
+        else if (key.compare(0, VALUECURVE.size(), VALUECURVE) == 0)
+        {
+            _parameters[key.substr(VALUECURVE.size())].valueCurve = it.second;
+        }
+    }
+}
+
+// parses the curve the same way the settings were parsed every frame before there was a block
+void EffectParameterBlock::Parse(const Curve &c, ValueCurve &curve)
+{
+    if (c.divided)
+    {
+        curve.Deserialise(c.serialised);
+        curve.SetLimits(c.min, c.max);
+        curve.SetDivisor(c.divisor);
+    }
+    else
+    {
+        curve.SetDivisor(c.divisor);
+        curve.SetLimits(c.min, c.max);
+        curve.Deserialise(c.serialised);
+    }
+}
+
+// Curves are parsed the first time they are asked for as the limits and divisor they are parsed with come from the effect
+EffectParameterBlock::Curve *EffectParameterBlock::GetCurve(Parameter &p, const std::string &name, bool divided, float min, float max, int divisor, SettingsMap &settings)
+{
+    for (auto& it : p.curves)
+    {
+        if (it.divided == divided && it.min == min && it.max == max && it.divisor == divisor)
+        {
+            return &it;
+        }
+    }
+
+    p.curves.push_back(Curve());
+    Curve &c = p.curves.back();
+    c.divided = divided;
+    c.min = min;
+    c.max = max;
+    c.divisor = divisor;
+    c.serialised = p.valueCurve;
+    Parse(c, c.curve);
+
+    if (c.curve.IsActive() && p.valueCurve.find("RV=TRUE") == std::string::npos)
+    {
+        // this updates the settings map ... but not the actual settings on the effect ...
+        // this is a problem as the error will keep occuring next time the sequence is loaded.
+        // To fix it the user needs to click on the offending effect and save and it will go away
+        c.serialised = c.curve.Serialise();
+        settings["VALUECURVE_" + name] = c.serialised;
+    }
+    return &c;
+}
+
+float EffectParameterBlock::Evaluate(Curve &c, float offset, long startMS, long endMS)
+{
+    if (c.curve.GetType() == "Music Trigger Fade")
+    {
+        // this type adds points to the curve as it is evaluated so it needs a fresh copy every time
+        ValueCurve vc(c.curve);
+        return c.divided ? vc.GetOutputValueAtDivided(offset, startMS, endMS) : vc.GetOutputValueAt(offset, startMS, endMS);
+    }
+    if (c.curve.GetType() == "Random")
+    {
+        // parsing rolls new random points and the curve has always been parsed every frame
+        ValueCurve vc;
+        Parse(c, vc);
+        return c.divided ? vc.GetOutputValueAtDivided(offset, startMS, endMS) : vc.GetOutputValueAt(offset, startMS, endMS);
+    }
+    return c.divided ? c.curve.GetOutputValueAtDivided(offset, startMS, endMS) : c.curve.GetOutputValueAt(offset, startMS, endMS);
+}
+
+double EffectParameterBlock::GetValueCurveDouble(const std::string &name, double def, SettingsMap &settings, float offset, double min, double max, long startMS, long endMS, int divisor)
+{
+    auto it = _parameters.find(name);
+    if (it == _parameters.end())
+    {
+        return def;
+    }
+    Parameter &p = it->second;
+    double res = p.doubleOk ? p.doubleValue : def;
+    if (p.valueCurve != "")
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        Curve *c = GetCurve(p, name, true, min, max, divisor, settings);
+        if (c->curve.IsActive())
+        {
+            res = Evaluate(*c, offset, startMS, endMS);
+        }
+    }
+    return res;
+}
+
+int EffectParameterBlock::GetValueCurveInt(const std::string &name, int def, SettingsMap &settings, float offset, int min, int max, long startMS, long endMS, int divisor)
+{
+    auto it = _parameters.find(name);
+    if (it == _parameters.end())
+    {
+        return def;
+    }
+    Parameter &p = it->second;
+    int res = p.intOk ? p.intValue : def;
+    if (p.valueCurve != "")
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        Curve *c = GetCurve(p, name, false, min, max, divisor, settings);
+        if (c->curve.IsActive())
+        {
+            res = Evaluate(*c, offset, startMS, endMS);
+        }
+    }
+    return res;
+}
+
 double RenderableEffect::GetValueCurveDouble(const std::string &name, double def, SettingsMap &SettingsMap, float offset, double min, double max, long startMS, long endMS, int divisor)
 {
+    EffectParameterBlock *parameters = SettingsMap.GetParameterBlock();
+    if (parameters != nullptr)
+    {
+        return parameters->GetValueCurveDouble(name, def, SettingsMap, offset, min, max, startMS, endMS, divisor);
+    }
+
     double res = def;
 
     const std::string sn = "SLIDER_" + name;
@@ -945,6 +1120,12 @@ double RenderableEffect::GetValueCurveDouble(const std::string &name, double def
 
 int RenderableEffect::GetValueCurveInt(const std::string &name, int def, SettingsMap &SettingsMap, float offset, int min, int max, long startMS, long endMS, int divisor)
 {
+    EffectParameterBlock *parameters = SettingsMap.GetParameterBlock();
+    if (parameters != nullptr)
+    {
+        return parameters->GetValueCurveInt(name, def, SettingsMap, offset, min, max, startMS, endMS, divisor);
+    }
+
     int res = def;
     const std::string sn = "SLIDER_" + name;
     const std::string tn = "TEXTCTRL_" + name;
@@ -3,7 +3,11 @@
 
 #include <wx/bitmap.h>
 #include <string>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include "../Color.h"
+#include "../ValueCurve.h"
 #include "assist/AssistPanel.h"
 
 class wxPanel;
@@ -19,6 +23,49 @@ class wxCheckBox;
 class AudioManager;
 class wxSpinCtrl;
 
+// The SLIDER_, TEXTCTRL_ and VALUECURVE_ settings of an effect parsed once when the
+// effect is loaded for rendering so the per frame value curve lookups do not need to
+// build key strings, look them up or parse the numbers and curves every frame.
+// Only GetValueCurveInt/GetValueCurveDouble use it ... the effects still read their
+// other settings from the SettingsMap
+class EffectParameterBlock
+{
+    struct Curve
+    {
+        bool divided;
+        float min;
+        float max;
+        int divisor;
+        std::string serialised;
+        ValueCurve curve;
+    };
+    struct Parameter
+    {
+        Parameter() : fromSlider(false), intOk(false), intValue(0), doubleOk(false), doubleValue(0.0) {}
+        bool fromSlider;
+        bool intOk;
+        int intValue;
+        bool doubleOk;
+        double doubleValue;
+        std::string valueCurve;
+        std::list<Curve> curves;
+    };
+
+    std::unordered_map<std::string, Parameter> _parameters;
+    std::mutex _lock;
+
+    static void Parse(const Curve &c, ValueCurve &curve);
+    Curve *GetCurve(Parameter &p, const std::string &name, bool divided, float min, float max, int divisor, SettingsMap &settings);
+    float Evaluate(Curve &c, float offset, long startMS, long endMS);
+
+public:
+    EffectParameterBlock(const SettingsMap &settings);
+    virtual ~EffectParameterBlock() {}
+
+    double GetValueCurveDouble(const std::string &name, double def, SettingsMap &settings, float offset, double min, double max, long startMS, long endMS, int divisor);
+    int GetValueCurveInt(const std::string &name, int def, SettingsMap &settings, float offset, int min, int max, long startMS, long endMS, int divisor);
+};
+
 class RenderableEffect
 {
     public:
@@ -57,6 +104,9 @@ class RenderableEffect
         //Methods for rendering the effect
         virtual bool CanRenderOnBackgroundThread(Effect *effect, const SettingsMap &settings, RenderBuffer &buffer) { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const;
+        // true if the frames depend only on the settings, buffer size and duration so the render cache can reuse them
+        // for an identical effect on the same model at another time or in another sequence
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const { return false; }
         virtual void Render(Effect *effect, SettingsMap &settings, RenderBuffer &buffer) = 0;
         virtual void RenameTimingTrack(std::string oldname, std::string newname, Effect *effect) { }
         virtual std::list<std::string> CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache) { std::list<std::string> res; return res; };
@@ -76,6 +126,7 @@ class RenderableEffect
         virtual bool HasAssistPanel() { return false; }
 
     protected:
+        static bool IsSequenceIndependent(const SettingsMap& settings);
         static void SetSliderValue(wxSlider *slider, int value);
         static void SetSpinValue(wxSpinCtrl *spin, int value);
         static void SetChoiceValue(wxChoice* choice, std::string value);
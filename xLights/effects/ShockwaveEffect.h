@@ -33,6 +33,7 @@ class ShockwaveEffect : public RenderableEffect
         virtual bool SupportsRadialColorCurves(const SettingsMap &SettingsMap) const override { return true; }
         virtual bool CanRenderPartialTimeInterval() const override { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings); }
 
     protected:
         virtual wxPanel *CreatePanel(wxWindow *parent) override;
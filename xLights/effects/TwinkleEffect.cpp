@@ -213,45 +213,47 @@ void TwinkleEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuffe
         }
     }
     
-    parallel_for(0, strobe.size(), [&strobe, &buffer, max_modulo, max_modulo2, colorcnt, reRandomize, Strobe](int x) {
-        strobe[x].duration++;
-        if (strobe[x].duration < 0) {
-            return;
-        }
-        if (strobe[x].duration == max_modulo) {
-            strobe[x].duration = 0;
-            if (reRandomize) {
-                strobe[x].duration -= rand() % max_modulo2;
-                strobe[x].colorindex = rand() % colorcnt;
+    parallel_for_range(0, strobe.size(), [&strobe, &buffer, max_modulo, max_modulo2, colorcnt, reRandomize, Strobe](int start, int end) {
+        for (int x = start; x < end; x++) {
+            strobe[x].duration++;
+            if (strobe[x].duration < 0) {
+                continue;
             }
-        }
-        int i7 = strobe[x].duration;
-        HSVValue hsv;
-        buffer.palette.GetHSV(strobe[x].colorindex, hsv);
-        double v;
-        if(i7<=max_modulo2) {
-            if(max_modulo2>0) v = (1.0*i7)/max_modulo2;
-            else v =0;
-        } else {
-            if(max_modulo2>0)v = (max_modulo-i7)*1.0/(max_modulo2);
-            else v = 0;
-        }
-        if (v<0.0) v=0.0;
-        
-        if (Strobe) {
-            if (i7==max_modulo2) v = 1.0;
-            else v = 0.0;
-        }
-        if (buffer.allowAlpha) {
-            xlColor color;
-            buffer.palette.GetColor(strobe[x].colorindex, color);
-            color.alpha = 255.0 * v;
-            buffer.SetPixel(strobe[x].x,strobe[x].y,color); // Turn pixel on
-        } else {
+            if (strobe[x].duration == max_modulo) {
+                strobe[x].duration = 0;
+                if (reRandomize) {
+                    strobe[x].duration -= rand() % max_modulo2;
+                    strobe[x].colorindex = rand() % colorcnt;
+                }
+            }
+            int i7 = strobe[x].duration;
+            HSVValue hsv;
             buffer.palette.GetHSV(strobe[x].colorindex, hsv);
-            //  we left the Hue and Saturation alone, we are just modifiying the Brightness Value
-            hsv.value = v;
-            buffer.SetPixel(strobe[x].x,strobe[x].y,hsv); // Turn pixel on
+            double v;
+            if(i7<=max_modulo2) {
+                if(max_modulo2>0) v = (1.0*i7)/max_modulo2;
+                else v =0;
+            } else {
+                if(max_modulo2>0)v = (max_modulo-i7)*1.0/(max_modulo2);
+                else v = 0;
+            }
+            if (v<0.0) v=0.0;
+        
+            if (Strobe) {
+                if (i7==max_modulo2) v = 1.0;
+                else v = 0.0;
+            }
+            if (buffer.allowAlpha) {
+                xlColor color;
+                buffer.palette.GetColor(strobe[x].colorindex, color);
+                color.alpha = 255.0 * v;
+                buffer.SetPixel(strobe[x].x,strobe[x].y,color); // Turn pixel on
+            } else {
+                buffer.palette.GetHSV(strobe[x].colorindex, hsv);
+                //  we left the Hue and Saturation alone, we are just modifiying the Brightness Value
+                hsv.value = v;
+                buffer.SetPixel(strobe[x].x,strobe[x].y,hsv); // Turn pixel on
+            }
         }
     }, 500);
 }
@@ -7,6 +7,7 @@
 #include "VideoEffect.h"
 #include "VideoPanel.h"
 #include "../VideoReader.h"
+#include "../VideoFrameCache.h"
 #include "../sequencer/Effect.h"
 #include "../RenderBuffer.h"
 #include "../UtilClasses.h"
@@ -218,7 +219,7 @@ public:
 		}
 	};
 
-    VideoReader* _videoreader;
+    SharedVideoReader* _videoreader;
 	int _videoframerate;
 	int _loops;
     int _frameMS;
@@ -274,7 +275,7 @@ void VideoEffect::Render(RenderBuffer &buffer, std::string filename,
     }
 
     int &_loops = cache->_loops;
-    VideoReader* &_videoreader = cache->_videoreader;
+    SharedVideoReader* &_videoreader = cache->_videoreader;
     int& _frameMS = cache->_frameMS;
     int& _nextManualMS = cache->_nextManualMS;
 
@@ -312,7 +313,7 @@ void VideoEffect::Render(RenderBuffer &buffer, std::string filename,
             // have to open the file
             int width = buffer.BufferWi * 100 / (cropRight - cropLeft);
             int height = buffer.BufferHt * 100 / (cropTop - cropBottom);
-            _videoreader = new VideoReader(filename, width, height, aspectratio, false, true);
+            _videoreader = new SharedVideoReader(filename, width, height, aspectratio);
 
             if (_videoreader == nullptr)
             {
@@ -396,7 +397,7 @@ void VideoEffect::Render(RenderBuffer &buffer, std::string filename,
         }
 
         // get the image for the current frame
-        AVFrame* image = _videoreader->GetNextFrame(frame);
+        const uint8_t* image = _videoreader->GetNextFrame(frame);
 
         // if we have reached the end and we are to loop
         if (_videoreader->AtEnd() && durationTreatment == "Loop")
@@ -432,7 +433,7 @@ void VideoEffect::Render(RenderBuffer &buffer, std::string filename,
             xlColor c;
             for (int y = 0; y < _videoreader->GetHeight() - yoffset - ytail; y++)
             {
-                uint8_t* ptr = image->data[0] + (_videoreader->GetHeight() - 1 - y - yoffset) * _videoreader->GetWidth() * ch + xoffset * ch;
+                const uint8_t* ptr = image + (_videoreader->GetHeight() - 1 - y - yoffset) * _videoreader->GetWidth() * ch + xoffset * ch;
 
                 for (int x = 0; x < _videoreader->GetWidth() - xoffset - xtail; x++)
                 {
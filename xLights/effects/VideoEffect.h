@@ -19,6 +19,7 @@ class VideoEffect : public RenderableEffect
         virtual bool CleanupFileLocations(xLightsFrame* frame, SettingsMap &SettingsMap) override;
         virtual bool AppropriateOnNodes() const override { return false; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const override { return true; }
+        virtual bool SupportsSharedRenderCache(const SettingsMap& settings) const override { return IsSequenceIndependent(settings) && !settings.GetBool("CHECKBOX_SynchroniseWithAudio", false); }
         static bool IsVideoFile(std::string filename);
 
         // Currently not possible but I think changes could be made to make it support partial
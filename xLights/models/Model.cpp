@@ -1987,6 +1987,23 @@ bool Model::UpdateStartChannelFromChannelString(std::map<std::string, Model*>& m
     return valid;
 }
 
+std::list<std::string> Model::GetStartChannelStrings() const
+{
+    std::list<std::string> res;
+    res.push_back(ModelXml->GetAttribute("StartChannel", "1").ToStdString());
+
+    if (!zeroBased && ModelXml->GetAttribute("Advanced", "0") == "1") {
+        size_t NumberOfStrings = HasOneString(DisplayAs) ? 1 : parm1;
+        for (int i = 0; i < NumberOfStrings; i++) {
+            auto tempstr = StartChanAttrName(i);
+            if (ModelXml->HasAttribute(tempstr)) {
+                res.push_back(ModelXml->GetAttribute(tempstr, "1").ToStdString());
+            }
+        }
+    }
+    return res;
+}
+
 int Model::GetNumberFromChannelString(const std::string &sc) const {
     bool v = false;
     std::string dependsonmodel;
@@ -35,6 +35,8 @@
 #include "UtilFunctions.h"
 #include "outputs/Output.h"
 
+#include <set>
+
 #include <log4cpp/Category.hh>
 
 ModelManager::ModelManager(OutputManager* outputManager, xLightsFrame* xl) :
@@ -60,6 +62,7 @@ void ModelManager::clear() {
         }
     }
     models.clear();
+    _startChannelStates.clear();
 }
 
 BaseObject *ModelManager::GetObject(const std::string &name) const
@@ -274,96 +277,136 @@ void ModelManager::ReplaceIPInStartChannels(const std::string& oldIP, const std:
     }
 }
 
+// adds the model a chained start channel such as ">Arch1:1" or "@Arch1:1" depends on
+static void AddStartChannelDependency(const std::string& sc, std::set<std::string>& dependsOn)
+{
+    if (sc.size() < 2 || (sc[0] != '>' && sc[0] != '@' && sc[0] != '<')) return;
+
+    auto colon = sc.find(':');
+    if (colon == std::string::npos) return;
+
+    // submodels take their channels from their parent
+    std::string model = sc.substr(1, colon - 1);
+    auto slash = model.find('/');
+    if (slash != std::string::npos) model = model.substr(0, slash);
+    dependsOn.insert(model);
+}
+
+// what the start channels currently resolve to ... if this has not changed neither has the model
+static std::string GetStartChannelSignature(Model* model, const std::list<std::string>& startChannels)
+{
+    std::string res;
+    for (const auto& it : startChannels) {
+        bool valid = false;
+        std::string dependsonmodel;
+        int sc = model->GetNumberFromChannelString(it, valid, dependsonmodel);
+        res += it + "=" + std::to_string(sc) + (valid ? ";" : "!;");
+    }
+    return res;
+}
+
 bool ModelManager::RecalcStartChannels() const {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     wxStopWatch sw;
     bool changed = false;
-    std::list<std::string> modelsDone;
-
-    for (const auto& it : models) {
-        it.second->CouldComputeStartChannel = false;
-    }
+    int reloaded = 0;
 
-    // first go through all models whose start channels are not dependent on other models
+    // build the graph of which models each model's start channels are chained to
+    std::map<Model*, std::list<std::string>> startChannels;
+    std::map<Model*, int> waitingOn;
+    std::map<std::string, std::list<Model*>> dependents;
+    std::vector<Model*> order;
     for (const auto& it : models) {
         if (it.second->GetDisplayAs() != "ModelGroup")
         {
-            char first = '0';
-            if (it.second->ModelStartChannel != "") first = it.second->ModelStartChannel[0];
-            if (first != '>' && first != '@')
-            {
-                modelsDone.push_back(it.first);
-                auto oldsc = it.second->GetFirstChannel();
-                it.second->SetFromXml(it.second->GetModelXml());
-                if (oldsc != it.second->GetFirstChannel())
-                {
-                    changed = true;
-                }
+            auto& sc = startChannels[it.second];
+            sc = it.second->GetStartChannelStrings();
+
+            std::set<std::string> dependsOn;
+            for (const auto& it2 : sc) {
+                AddStartChannelDependency(it2, dependsOn);
             }
+            for (const auto& it2 : dependsOn) {
+                dependents[it2].push_back(it.second);
+            }
+            waitingOn[it.second] = dependsOn.size();
+            if (dependsOn.empty()) order.push_back(it.second);
         }
     }
 
-    // now go through all undone models that depend on something
-    bool workDone = false;
-    do
-    {
-        workDone = false;
-
-        for (const auto& it : models) {
-            if (it.second->GetDisplayAs() != "ModelGroup")
-            {
-                char first = '0';
-                if (it.second->ModelStartChannel != "") first = it.second->ModelStartChannel[0];
-                if ((first == '>' || first == '@') && !it.second->CouldComputeStartChannel)
-                {
-                    std::string dependsOn = it.second->ModelStartChannel.substr(1, it.second->ModelStartChannel.find(':') - 1);
-                    if (std::find(modelsDone.begin(), modelsDone.end(), dependsOn) != modelsDone.end())
-                    {
-                        // the depends on model is done
-                        modelsDone.push_back(it.first);
-                        auto oldsc = it.second->GetFirstChannel();
-                        it.second->SetFromXml(it.second->GetModelXml());
-                        if (oldsc != it.second->GetFirstChannel())
-                        {
-                            changed = true;
-                        }
-                        if (it.second->CouldComputeStartChannel)
-                        {
-                            workDone = true;
-                        }
-                    }
-                }
+    // order the models so each comes after everything it depends on. Models chained in a loop or to a model
+    // that does not exist never become ready
+    for (size_t i = 0; i < order.size(); i++) {
+        auto it = dependents.find(order[i]->GetName());
+        if (it != dependents.end()) {
+            for (const auto& it2 : it->second) {
+                if (--waitingOn[it2] == 0) order.push_back(it2);
             }
         }
+    }
 
-    } while (workDone);
+    // a model only needs reloading if it has been edited or what its start channels resolve to has changed
+    for (const auto& it : order) {
+        std::string signature = GetStartChannelSignature(it, startChannels[it]);
+        auto state = _startChannelStates.find(it->GetName());
+        if (it->CouldComputeStartChannel && state != _startChannelStates.end() && state->second.model == it &&
+            state->second.changeCount == it->GetChangeCount() && state->second.signature == signature) {
+            continue;
+        }
 
-    // now process anything unprocessed
-    int countInvalid = 0;
+        auto oldsc = it->GetFirstChannel();
+        it->SetFromXml(it->GetModelXml());
+        reloaded++;
+        if (oldsc != it->GetFirstChannel())
+        {
+            changed = true;
+        }
+        auto& newState = _startChannelStates[it->GetName()];
+        newState.model = it;
+        newState.changeCount = it->GetChangeCount();
+        newState.signature = signature;
+    }
+
+    // now process anything unprocessed ... these cannot be valid so none of them can be relied on by the others
+    std::list<Model*> unordered;
     for (const auto& it : models) {
-        if (it.second->GetDisplayAs() != "ModelGroup")
+        auto w = waitingOn.find(it.second);
+        if (w != waitingOn.end() && w->second > 0)
         {
-            char first = '0';
-            if (it.second->ModelStartChannel != "") first = it.second->ModelStartChannel[0];
-            if ((first == '>' || first == '@') && !it.second->CouldComputeStartChannel)
-            {
-                modelsDone.push_back(it.first);
-                auto oldsc = it.second->GetFirstChannel();
-                it.second->SetFromXml(it.second->GetModelXml());
-                if (oldsc != it.second->GetFirstChannel())
-                {
-                    changed = true;
-                }
-            }
-            if (!it.second->CouldComputeStartChannel) countInvalid++;
+            unordered.push_back(it.second);
+            it.second->CouldComputeStartChannel = false;
+            _startChannelStates.erase(it.first);
         }
     }
 
+    std::string unorderedNames;
+    for (const auto& it : unordered) {
+        if (unorderedNames != "") unorderedNames += ", ";
+        unorderedNames += it->GetName();
+
+        auto oldsc = it->GetFirstChannel();
+        it->SetFromXml(it->GetModelXml());
+        reloaded++;
+        if (oldsc != it->GetFirstChannel())
+        {
+            changed = true;
+        }
+    }
+
+    int countInvalid = 0;
+    for (const auto& it : waitingOn) {
+        if (!it.first->CouldComputeStartChannel) countInvalid++;
+    }
+
+    if (unorderedNames != "") {
+        logger_base.warn("Models with start channels chained in a loop or to a missing model: %s", (const char*)unorderedNames.c_str());
+    }
+
     ResetModelGroups();
 
     long end = sw.Time();
-    logger_base.debug("RecalcStartChannels takes %ldms.", end);
+    logger_base.debug("RecalcStartChannels takes %ldms, reloaded %d of %d models.", end, reloaded, (int)startChannels.size());
 
     if (countInvalid > 0) {
         DisplayStartChannelCalcWarning();
@@ -68,6 +68,15 @@ class ModelManager : public ObjectManager
     int previewWidth;
     int previewHeight;
     std::map<std::string, Model *> models;
+
+    // what each model's start channels resolved to the last time it was loaded so unchanged models can be skipped
+    struct StartChannelState
+    {
+        Model* model = nullptr;
+        unsigned long changeCount = 0;
+        std::string signature;
+    };
+    mutable std::map<std::string, StartChannelState> _startChannelStates;
 };
 
 #endif // MODELMANAGER_H
@@ -136,3 +136,53 @@ void NodeClassRGBW::GetForChannels(unsigned char *buf) const {
             break;
     }
 }
+
+void NodeLayout::Build(const std::vector<NodeBaseClassPtr>& nodes) {
+    size_t count = nodes.size();
+    size_t coords = 0;
+    for (const auto& n : nodes) {
+        coords += n->Coords.size();
+    }
+
+    coordStart.resize(count + 1);
+    bufX.resize(coords);
+    bufY.resize(coords);
+    startChannel.resize(count);
+    channelOffsets.resize(count * 3);
+    channelCount.resize(count);
+    direct.resize(count);
+    models.resize(count);
+    sparkle.resize(count);
+
+    uint32_t c = 0;
+    for (size_t i = 0; i < count; i++) {
+        const NodeBaseClass* n = nodes[i].get();
+        coordStart[i] = c;
+        for (const auto& a : n->Coords) {
+            bufX[c] = a.bufX;
+            bufY[c] = a.bufY;
+            c++;
+        }
+        startChannel[i] = n->ActChan;
+        for (int x = 0; x < 3; x++) {
+            channelOffsets[i * 3 + x] = n->GetChannelOffset(x);
+        }
+        channelCount[i] = n->GetChanCount();
+        direct[i] = n->HasDirectChannels() ? 1 : 0;
+        models[i] = n->model;
+        sparkle[i] = n->sparkle;
+    }
+    coordStart[count] = c;
+}
+
+void NodeLayout::Clear() {
+    coordStart.clear();
+    bufX.clear();
+    bufY.clear();
+    startChannel.clear();
+    channelOffsets.clear();
+    channelCount.clear();
+    direct.clear();
+    models.clear();
+    sparkle.clear();
+}
@@ -130,6 +130,13 @@ public:
     uint32_t GetChanCount() const {
         return chanCnt;
     }
+    uint8_t GetChannelOffset(int x) const {
+        return offsets[x];
+    }
+    // true when the channel values are just the colour components placed by the channel offsets
+    virtual bool HasDirectChannels() const {
+        return true;
+    }
     bool IsVisible() const {
         return Coords.size() > 0;
     }
@@ -308,6 +315,9 @@ public:
             c[0] = 0;
         }
     }
+    virtual bool HasDirectChannels() const override {
+        return false;
+    }
     virtual NodeBaseClass *clone() const override {
         return new NodeClassCustom(*this);
     }
@@ -352,6 +362,9 @@ public:
         HSVValue hsv2 = color.asHSV();
         c[0]=hsv2.value * 255.0;
     }
+    virtual bool HasDirectChannels() const override {
+        return false;
+    }
     virtual NodeBaseClass *clone() const override {
         return new NodeClassIntensity(*this);
     }
@@ -382,6 +395,9 @@ public:
     virtual const std::string &GetNodeType() const override {
         return WHITE;
     }
+    virtual bool HasDirectChannels() const override {
+        return false;
+    }
     virtual NodeBaseClass *clone() const override {
         return new NodeClassWhite(*this);
     }
@@ -404,7 +420,10 @@ public:
     virtual void SetFromChannels(const unsigned char *buf) override;
     virtual void GetForChannels(unsigned char *buf) const override;
     virtual const std::string &GetNodeType() const override;
-    
+    virtual bool HasDirectChannels() const override {
+        return false;
+    }
+
     virtual NodeBaseClass *clone() const override {
         return new NodeClassRGBW(*this);
     }
@@ -416,6 +435,29 @@ private:
 
 typedef std::unique_ptr<NodeBaseClass> NodeBaseClassPtr;
 
+// Structure of arrays copy of the per node data the renderer walks every frame. Each node is a
+// separate heap object with its own coordinate vector so going through the nodes themselves costs
+// a cache miss or two per node. Build it again whenever the nodes change.
+class NodeLayout
+{
+public:
+    void Build(const std::vector<NodeBaseClassPtr>& nodes);
+    void Clear();
+
+    size_t size() const { return startChannel.size(); }
+    bool IsVisible(size_t node) const { return coordStart[node] != coordStart[node + 1]; }
+
+    std::vector<uint32_t> coordStart;    // index of each nodes first coordinate, with an extra entry for the end
+    std::vector<int> bufX;               // buffer coordinates of all the nodes one after the other
+    std::vector<int> bufY;
+    std::vector<uint32_t> startChannel;
+    std::vector<uint8_t> channelOffsets; // 3 per node in rgb order, 255 when the component is not output
+    std::vector<uint8_t> channelCount;
+    std::vector<uint8_t> direct;         // the node object is not needed to convert between colours and channels
+    std::vector<const Model*> models;
+    std::vector<uint16_t> sparkle;
+};
+
 
 #endif /* Node_h */
 
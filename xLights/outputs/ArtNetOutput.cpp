@@ -405,7 +405,7 @@ void ArtNetOutput::EndFrame(int suppressFrames)
     if (_changed || NeedToOutput(suppressFrames))
     {
         _data[12] = _sequenceNum;
-        _datagram->SendTo(_remoteAddr, _data, ARTNET_PACKET_LEN - (512 - _channels));
+        SendDatagram(_datagram, _remoteAddr, _data, ARTNET_PACKET_LEN - (512 - _channels));
         _sequenceNum = _sequenceNum == 255 ? 0 : _sequenceNum + 1;
         FrameOutput();
         _changed = false;
@@ -249,6 +249,15 @@ void DDPOutput::EndFrame(int suppressFrames)
         int32_t chan = _keepChannelNumbers ? (_startChannel - 1) : 0;
         int32_t tosend = _channels;
 
+        // when batching the payload is sent straight from _fulldata so each packet just needs its own header
+        bool batching = IsBatching();
+        if (batching)
+        {
+            size_t packets = (_channels + _channelsPerPacket - 1) / _channelsPerPacket;
+            if (_headers.size() < packets * DDP_PACKET_HEADERLEN) _headers.resize(packets * DDP_PACKET_HEADERLEN);
+        }
+        int packet = 0;
+
         while (tosend > 0)
         {
             int32_t thissend = (tosend < _channelsPerPacket) ? tosend : _channelsPerPacket;
@@ -280,9 +289,18 @@ void DDPOutput::EndFrame(int suppressFrames)
             _data[8] = (thissend & 0xFF00) >> 8;
             _data[9] = thissend & 0x00FF;
 
-            memcpy(&_data[10], _fulldata + index, thissend);
-
-            _datagram->SendTo(_remoteAddr, &_data[0], DDP_PACKET_LEN - (1440 - thissend));
+            if (batching)
+            {
+                uint8_t* header = &_headers[packet * DDP_PACKET_HEADERLEN];
+                memcpy(header, _data, DDP_PACKET_HEADERLEN);
+                SendDatagram(_datagram, _remoteAddr, header, DDP_PACKET_HEADERLEN, _fulldata + index, thissend);
+            }
+            else
+            {
+                memcpy(&_data[10], _fulldata + index, thissend);
+                SendDatagram(_datagram, _remoteAddr, &_data[0], DDP_PACKET_LEN - (1440 - thissend));
+            }
+            packet++;
             _sequenceNum = _sequenceNum == 15 ? 1 : _sequenceNum + 1;
 
             tosend -= thissend;
@@ -4,6 +4,7 @@
 #include "IPOutput.h"
 #include <wx/sckaddr.h>
 #include <wx/socket.h>
+#include <vector>
 
 // ******************************************************
 // * This class represents a single universe for DDP
@@ -38,6 +39,7 @@ class DDPOutput : public IPOutput
     int _channelsPerPacket;
     bool _keepChannelNumbers;
     uint8_t* _fulldata;
+    std::vector<uint8_t> _headers; // a header for each packet when the payload is sent straight from _fulldata
     bool _autoStartChannels = false;
 
     // These are used for DDP sync
@@ -476,7 +476,7 @@ void E131Output::EndFrame(int suppressFrames)
         if (_changed || NeedToOutput(suppressFrames))
         {
             _data[111] = _sequenceNum;
-            _datagram->SendTo(_remoteAddr, _data, E131_PACKET_LEN - (512 - _channels));
+            SendDatagram(_datagram, _remoteAddr, _data, E131_PACKET_LEN - (512 - _channels));
             _sequenceNum = _sequenceNum == 255 ? 0 : _sequenceNum + 1;
             FrameOutput();
         }
@@ -13,11 +13,26 @@
 #include <icmpapi.h>
 #endif
 
+#ifdef __linux__
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#endif
+
 #include "../UtilFunctions.h"
 #include "../xSchedule/xSMSDaemon/Curl.h"
 
 #include <log4cpp/Category.hh>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 std::string IPOutput::__localIP = "";
 
 static std::map<std::string, std::string> resolvedIPMap;
@@ -99,6 +114,317 @@ std::string IPOutput::CleanupIP(const std::string &ip)
 }
 #pragma endregion Static Functions
 
+#pragma region Batched Sending
+// While a batch is open the ip outputs queue their packets here rather than sending them one at a time.
+// On Linux the queue is sent through a few shared sockets with sendmmsg so a frame with thousands of
+// universes costs a handful of system calls. Elsewhere, or if the shared sockets cannot be opened, the
+// packets are sent through each outputs own socket as before.
+namespace
+{
+    struct BatchedPacket
+    {
+        wxDatagramSocket* datagram;
+        const wxIPV4address* remoteAddr;
+        const uint8_t* header;
+        size_t headerLen;
+        const uint8_t* payload;
+        size_t payloadLen;
+    };
+
+    std::mutex __batchLock;
+    bool __batching = false;
+    std::vector<BatchedPacket> __batchPackets;
+    std::vector<uint8_t> __scratch; // used to join a header and payload when they cannot be sent separately
+
+    void SendJoined(wxDatagramSocket* datagram, const wxIPV4address& remoteAddr, const uint8_t* header, size_t headerLen, const uint8_t* payload, size_t payloadLen)
+    {
+        if (payloadLen == 0)
+        {
+            datagram->SendTo(remoteAddr, header, headerLen);
+        }
+        else
+        {
+            __scratch.resize(headerLen + payloadLen);
+            memcpy(&__scratch[0], header, headerLen);
+            memcpy(&__scratch[headerLen], payload, payloadLen);
+            datagram->SendTo(remoteAddr, &__scratch[0], __scratch.size());
+        }
+    }
+
+#ifdef __linux__
+    // packets for a given destination always go through the same socket so they arrive in order
+    const int BATCH_SOCKETS = 4;
+    const size_t BATCH_MAX_MESSAGES = 1024;
+    int __batchSockets[BATCH_SOCKETS] = { -1, -1, -1, -1 };
+    std::string __batchSocketsIP;
+    bool __batchSocketsFailed = false;
+
+    void CloseBatchSockets()
+    {
+        for (int i = 0; i < BATCH_SOCKETS; i++)
+        {
+            if (__batchSockets[i] >= 0) close(__batchSockets[i]);
+            __batchSockets[i] = -1;
+        }
+    }
+
+    bool OpenBatchSockets()
+    {
+        static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+        if (__batchSockets[0] >= 0 && __batchSocketsIP == IPOutput::GetLocalIP()) return true;
+        if (__batchSocketsFailed && __batchSocketsIP == IPOutput::GetLocalIP()) return false;
+
+        CloseBatchSockets();
+        __batchSocketsIP = IPOutput::GetLocalIP();
+        __batchSocketsFailed = false;
+
+        sockaddr_in local;
+        memset(&local, 0x00, sizeof(local));
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (__batchSocketsIP != "" && inet_pton(AF_INET, __batchSocketsIP.c_str(), &local.sin_addr) != 1)
+        {
+            local.sin_addr.s_addr = htonl(INADDR_ANY);
+        }
+
+        for (int i = 0; i < BATCH_SOCKETS; i++)
+        {
+            __batchSockets[i] = socket(AF_INET, SOCK_DGRAM, 0);
+            if (__batchSockets[i] < 0 || bind(__batchSockets[i], (sockaddr*)&local, sizeof(local)) != 0)
+            {
+                logger_base.warn("Unable to open batched UDP socket on %s : %s. Packets will be sent individually.", (const char*)__batchSocketsIP.c_str(), strerror(errno));
+                CloseBatchSockets();
+                __batchSocketsFailed = true;
+                return false;
+            }
+
+            // enough room for a large frame to be queued in the kernel without blocking
+            int sndbuf = 4 * 1024 * 1024;
+            setsockopt(__batchSockets[i], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        }
+        logger_base.debug("Batched UDP sockets opened on %s.", __batchSocketsIP == "" ? "any address" : (const char*)__batchSocketsIP.c_str());
+        return true;
+    }
+
+    void AddMessage(std::vector<mmsghdr>* msgs, sockaddr_in* addr, iovec* iov, int iovlen)
+    {
+        mmsghdr m;
+        memset(&m, 0x00, sizeof(m));
+        m.msg_hdr.msg_name = addr;
+        m.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        m.msg_hdr.msg_iov = iov;
+        m.msg_hdr.msg_iovlen = iovlen;
+        msgs[addr->sin_addr.s_addr % BATCH_SOCKETS].push_back(m);
+    }
+
+    void SendMessages(std::vector<mmsghdr>* msgs)
+    {
+        for (int s = 0; s < BATCH_SOCKETS; s++)
+        {
+            size_t sent = 0;
+            while (sent < msgs[s].size())
+            {
+                unsigned int count = std::min(msgs[s].size() - sent, BATCH_MAX_MESSAGES);
+                int res = sendmmsg(__batchSockets[s], &msgs[s][sent], count, MSG_DONTWAIT);
+                if (res <= 0)
+                {
+                    // like the non blocking wx sockets a packet which cannot be sent is dropped
+                    res = 1;
+                }
+                sent += res;
+            }
+        }
+    }
+
+    void SendBatchedPackets(size_t start, size_t end)
+    {
+        std::vector<mmsghdr> msgs[BATCH_SOCKETS];
+        std::vector<iovec> iovs((end - start) * 2);
+        std::vector<sockaddr_in> addrs(end - start);
+
+        for (size_t i = start; i < end; i++)
+        {
+            const BatchedPacket& p = __batchPackets[i];
+            size_t j = i - start;
+            memcpy(&addrs[j], p.remoteAddr->GetAddressData(), std::min(sizeof(sockaddr_in), (size_t)p.remoteAddr->GetAddressDataLen()));
+
+            // the kernel gathers the header and payload straight from the outputs buffers
+            iovec* iov = &iovs[j * 2];
+            iov[0].iov_base = (void*)p.header;
+            iov[0].iov_len = p.headerLen;
+            iov[1].iov_base = (void*)p.payload;
+            iov[1].iov_len = p.payloadLen;
+            AddMessage(msgs, &addrs[j], iov, p.payloadLen == 0 ? 1 : 2);
+        }
+        SendMessages(msgs);
+    }
+
+    // When pacing only the first slice goes out while the output manager holds its lock. The rest are
+    // copied out of the output buffers so they can be sent by SendPaced once the locks are released.
+    struct PacedPacket
+    {
+        sockaddr_in addr;
+        size_t offset;
+        size_t len;
+    };
+
+    struct PacedSchedule
+    {
+        std::vector<PacedPacket> packets;
+        std::vector<uint8_t> data;
+        size_t first = 0; // the batch index of packets[0]
+        size_t total = 0;
+        size_t slices = 0;
+        int pacedMS = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    std::mutex __pacedLock;
+    PacedSchedule __paced;
+
+    void SendPacedPackets(PacedSchedule& paced, size_t start, size_t end)
+    {
+        std::vector<mmsghdr> msgs[BATCH_SOCKETS];
+        std::vector<iovec> iovs(end - start);
+
+        for (size_t i = start; i < end; i++)
+        {
+            PacedPacket& p = paced.packets[i];
+            iovec* iov = &iovs[i - start];
+            iov->iov_base = &paced.data[p.offset];
+            iov->iov_len = p.len;
+            AddMessage(msgs, &p.addr, iov, 1);
+        }
+        SendMessages(msgs);
+    }
+#endif
+}
+
+void IPOutput::StartBatch()
+{
+    std::unique_lock<std::mutex> locker(__batchLock);
+    __batching = true;
+    __batchPackets.clear();
+}
+
+bool IPOutput::IsBatching()
+{
+#ifdef __linux__
+    std::unique_lock<std::mutex> locker(__batchLock);
+    return __batching;
+#else
+    return false;
+#endif
+}
+
+void IPOutput::SendDatagram(wxDatagramSocket* datagram, const wxIPV4address& remoteAddr, const uint8_t* header, size_t headerLen, const uint8_t* payload, size_t payloadLen)
+{
+#ifdef __linux__
+    {
+        std::unique_lock<std::mutex> locker(__batchLock);
+        if (__batching)
+        {
+            __batchPackets.push_back({ datagram, &remoteAddr, header, headerLen, payload, payloadLen });
+            return;
+        }
+    }
+#endif
+
+    if (payloadLen == 0)
+    {
+        datagram->SendTo(remoteAddr, header, headerLen);
+    }
+    else
+    {
+        std::unique_lock<std::mutex> locker(__batchLock);
+        SendJoined(datagram, remoteAddr, header, headerLen, payload, payloadLen);
+    }
+}
+
+bool IPOutput::EndBatch(int pacedMS)
+{
+    std::unique_lock<std::mutex> locker(__batchLock);
+    __batching = false;
+    if (__batchPackets.size() == 0) return false;
+
+#ifdef __linux__
+    if (OpenBatchSockets())
+    {
+        // send in slices spread evenly across the time we have been given
+        size_t slices = pacedMS <= 0 ? 1 : std::max((size_t)1, std::min(__batchPackets.size() / 16, (size_t)pacedMS));
+        size_t first = __batchPackets.size() / slices;
+        SendBatchedPackets(0, first);
+        if (slices == 1)
+        {
+            __batchPackets.clear();
+            return false;
+        }
+
+        PacedSchedule paced;
+        paced.first = first;
+        paced.total = __batchPackets.size();
+        paced.slices = slices;
+        paced.pacedMS = pacedMS;
+        paced.start = std::chrono::steady_clock::now();
+        paced.packets.resize(__batchPackets.size() - first);
+        size_t size = 0;
+        for (size_t i = first; i < __batchPackets.size(); i++)
+        {
+            size += __batchPackets[i].headerLen + __batchPackets[i].payloadLen;
+        }
+        paced.data.resize(size);
+        size_t offset = 0;
+        for (size_t i = first; i < __batchPackets.size(); i++)
+        {
+            const BatchedPacket& p = __batchPackets[i];
+            PacedPacket& pp = paced.packets[i - first];
+            memset(&pp.addr, 0x00, sizeof(pp.addr));
+            memcpy(&pp.addr, p.remoteAddr->GetAddressData(), std::min(sizeof(sockaddr_in), (size_t)p.remoteAddr->GetAddressDataLen()));
+            pp.offset = offset;
+            pp.len = p.headerLen + p.payloadLen;
+            memcpy(&paced.data[offset], p.header, p.headerLen);
+            if (p.payloadLen != 0) memcpy(&paced.data[offset + p.headerLen], p.payload, p.payloadLen);
+            offset += pp.len;
+        }
+        __batchPackets.clear();
+
+        std::unique_lock<std::mutex> pacedLocker(__pacedLock);
+        std::swap(__paced, paced);
+        return true;
+    }
+#endif
+
+    for (const auto& it : __batchPackets)
+    {
+        SendJoined(it.datagram, *it.remoteAddr, it.header, it.headerLen, it.payload, it.payloadLen);
+    }
+    __batchPackets.clear();
+    return false;
+}
+
+void IPOutput::SendPaced()
+{
+#ifdef __linux__
+    PacedSchedule paced;
+    {
+        std::unique_lock<std::mutex> pacedLocker(__pacedLock);
+        std::swap(__paced, paced);
+    }
+
+    for (size_t i = 1; i < paced.slices; i++)
+    {
+        std::this_thread::sleep_until(paced.start + std::chrono::microseconds((long long)paced.pacedMS * 1000 * i / paced.slices));
+
+        // only hold the lock while sending ... the sockets may have been closed or reopened while we waited
+        std::unique_lock<std::mutex> locker(__batchLock);
+        if (__batchSockets[0] < 0) break;
+        SendPacedPackets(paced, paced.total * i / paced.slices - paced.first, paced.total * (i + 1) / paced.slices - paced.first);
+    }
+#endif
+}
+#pragma endregion Batched Sending
+
 wxXmlNode* IPOutput::Save()
 {
     wxXmlNode* node = new wxXmlNode(wxXML_ELEMENT_NODE, "network");
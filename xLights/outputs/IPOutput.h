@@ -3,12 +3,22 @@
 
 #include "Output.h"
 
+class wxDatagramSocket;
+class wxIPV4address;
+
 class IPOutput : public Output
 {
 protected:
 
     virtual void Save(wxXmlNode* node) override;
 
+    // Sends the packet now or, if a batch is open, queues it to be sent when the batch ends. Queued packets
+    // are not copied so the buffers must not change until the batch ends. The packet sent is the header
+    // followed by the payload which lets the payload be sent from where the channel data already is.
+    static void SendDatagram(wxDatagramSocket* datagram, const wxIPV4address& remoteAddr, const uint8_t* data, size_t len) { SendDatagram(datagram, remoteAddr, data, len, nullptr, 0); }
+    static void SendDatagram(wxDatagramSocket* datagram, const wxIPV4address& remoteAddr, const uint8_t* header, size_t headerLen, const uint8_t* payload, size_t payloadLen);
+    static bool IsBatching();
+
 public:
 
     static std::string __localIP;
@@ -29,6 +39,16 @@ public:
     static std::string GetLocalIP() { return __localIP; }
     #pragma endregion Static Functions
 
+    #pragma region Batched Sending
+    // The output manager opens a batch around the end of each frame so all the packets for the frame can
+    // be sent with a few system calls. If pacedMS is not zero the packets are spread over that many ms ...
+    // EndBatch sends the first slice and returns true if the rest are waiting for SendPaced which the
+    // caller should call once it has released its locks as it sleeps between slices.
+    static void StartBatch();
+    static bool EndBatch(int pacedMS = 0);
+    static void SendPaced();
+    #pragma endregion Batched Sending
+
     #pragma region Getters and Setters
     virtual bool IsIpOutput() const override { return true; }
     virtual bool IsSerialOutput() const override { return false; }
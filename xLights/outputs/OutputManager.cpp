@@ -15,6 +15,9 @@
 
 #include <log4cpp/Category.hh>
 
+#include <algorithm>
+#include <chrono>
+
 int OutputManager::_lastSecond = -10;
 int OutputManager::_currentSecond = -10;
 int OutputManager::_lastSecondCount = 0;
@@ -27,6 +30,8 @@ bool OutputManager::_isInteractive = true;
 OutputManager::OutputManager()
 {
     _parallelTransmission = false;
+    _pacedTransmission = false;
+    _lastFrameTime = 0;
     _syncEnabled = false;
     _dirty = false;
     _syncUniverse = 0;
@@ -252,6 +257,8 @@ bool OutputManager::Discover(wxWindow* frame, std::map<std::string, std::string>
         }
     }
 
+    BuildChannelIndex();
+
     return found;
 }
 #pragma endregion Controller Discovery
@@ -265,6 +272,11 @@ Output* OutputManager::GetOutput(int outputNumber) const
         return nullptr;
     }
 
+    if (_outputIndex.size() == _outputs.size())
+    {
+        return _outputIndex[outputNumber];
+    }
+
     auto iter = _outputs.begin();
     std::advance(iter, outputNumber);
     return *iter;
@@ -287,6 +299,13 @@ void OutputManager::SuspendAll(bool suspend)
 // get an output based on an absolute channel number
 Output* OutputManager::GetOutput(int32_t absoluteChannel, int32_t& startChannel) const
 {
+    const ChannelRange* range = FindChannelRange(_expandedRanges, absoluteChannel);
+    if (range != nullptr)
+    {
+        startChannel = absoluteChannel - range->startChannel + 1;
+        return range->output;
+    }
+
     for (const auto& it : _outputs)
     {
         if (it->IsOutputCollection() && absoluteChannel >= it->GetStartChannel() && absoluteChannel <= it->GetEndChannel())
@@ -318,6 +337,13 @@ Output* OutputManager::GetOutput(int32_t absoluteChannel, int32_t& startChannel)
 // get an output based on an absolute channel number
 Output* OutputManager::GetLevel1Output(int32_t absoluteChannel, int32_t& startChannel) const
 {
+    const ChannelRange* range = FindChannelRange(_level1Ranges, absoluteChannel);
+    if (range != nullptr)
+    {
+        startChannel = absoluteChannel - range->startChannel + 1;
+        return range->output;
+    }
+
     for (const auto& it : _outputs)
     {
         if (absoluteChannel >= it->GetStartChannel() && absoluteChannel <= it->GetEndChannel())
@@ -589,6 +615,72 @@ void OutputManager::SomethingChanged() const
 
         start += it->GetChannels() * it->GetUniverses();
     }
+
+    BuildChannelIndex();
+}
+
+void OutputManager::BuildChannelIndex() const
+{
+    _outputIndex.clear();
+    _level1Ranges.clear();
+    _expandedRanges.clear();
+    _outputIndex.reserve(_outputs.size());
+    _level1Ranges.reserve(_outputs.size());
+    _expandedRanges.reserve(_outputs.size());
+
+    // outputs are laid out in list order so the ranges should already be sorted ... if they are not, or they
+    // overlap, the index would not give the same answer as walking the list so we leave the lookups to do that
+    bool ordered = true;
+    for (const auto& it : _outputs)
+    {
+        _outputIndex.push_back(it);
+
+        int32_t start = it->GetStartChannel();
+        int32_t end = it->GetEndChannel();
+        if (end < start) continue;
+
+        if (!_level1Ranges.empty() && start <= _level1Ranges.back().endChannel) ordered = false;
+        _level1Ranges.push_back({ start, end, it });
+
+        if (it->IsOutputCollection())
+        {
+            for (const auto& it2 : it->GetOutputs())
+            {
+                int32_t start2 = it2->GetStartChannel();
+                int32_t end2 = it2->GetEndChannel();
+                if (end2 < start2) continue;
+
+                if (start2 < start || end2 > end) ordered = false;
+                if (!_expandedRanges.empty() && start2 <= _expandedRanges.back().endChannel) ordered = false;
+                _expandedRanges.push_back({ start2, end2, it2 });
+            }
+        }
+        else
+        {
+            if (!_expandedRanges.empty() && start <= _expandedRanges.back().endChannel) ordered = false;
+            _expandedRanges.push_back({ start, end, it });
+        }
+    }
+
+    if (!ordered)
+    {
+        _level1Ranges.clear();
+        _expandedRanges.clear();
+    }
+}
+
+// Returns the range holding the channel or nullptr if it is not in the index. The output is checked against its
+// current channels in case it has been resized since the index was built in which case the caller should scan.
+const OutputManager::ChannelRange* OutputManager::FindChannelRange(const std::vector<ChannelRange>& ranges, int32_t absoluteChannel)
+{
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), absoluteChannel, [](int32_t channel, const ChannelRange& r) { return channel < r.startChannel; });
+    if (it == ranges.begin()) return nullptr;
+    --it;
+
+    if (absoluteChannel > it->endChannel) return nullptr;
+    if (it->startChannel != it->output->GetStartChannel() || it->endChannel != it->output->GetEndChannel()) return nullptr;
+
+    return &(*it);
 }
 
 void OutputManager::SetForceFromIP(const std::string& forceFromIP)
@@ -853,6 +945,8 @@ void OutputManager::Replace(Output* replacethis, Output* withthis)
         }
     }
     _outputs = newoutputs;
+
+    BuildChannelIndex();
 }
 #pragma endregion Output Management
 
@@ -884,6 +978,17 @@ void OutputManager::EndFrame()
     if (!_outputting) return;
     if (!_outputCriticalSection.TryEnter()) return;
 
+    // when pacing the packets are spread over half the time since the last frame
+    long long now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    int pacedMS = 0;
+    if (_pacedTransmission && _lastFrameTime != 0)
+    {
+        pacedMS = std::min((int)(now - _lastFrameTime) / 2, 50);
+    }
+    _lastFrameTime = now;
+
+    // the ip outputs queue their packets and they are all sent together once every output has its data ready
+    IPOutput::StartBatch();
     if (_parallelTransmission)
     {
         std::function<void(Output*&, int)> f = [this](Output*&o, int n) {
@@ -898,6 +1003,19 @@ void OutputManager::EndFrame()
             (*it)->EndFrame(_suppressFrames);
         }
     }
+    if (IPOutput::EndBatch(pacedMS))
+    {
+        // the rest of the paced packets are sent with the lock released so start, stop and all off are not
+        // locked out while we wait between slices
+        _outputCriticalSection.Leave();
+        IPOutput::SendPaced();
+        if (!_outputCriticalSection.TryEnter()) return;
+        if (!_outputting)
+        {
+            _outputCriticalSection.Leave();
+            return;
+        }
+    }
 
     if (IsSyncEnabled())
     {
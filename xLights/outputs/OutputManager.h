@@ -6,6 +6,7 @@
 #include <list>
 #include <string>
 #include <map>
+#include <vector>
 
 class Output;
 class Controller;
@@ -25,8 +26,22 @@ class OutputManager
     bool _dirty;
     int _suppressFrames;
     bool _parallelTransmission;
+    bool _pacedTransmission; // spread each frames packets over part of the frame interval rather than sending them all at once
+    long long _lastFrameTime; // ms ... used to work out the frame interval when pacing
     bool _outputting; // true if we are currently sending out data
     wxCriticalSection _outputCriticalSection; // used to protect areas that must be single threaded
+
+    // Channel ranges sorted by start channel so per frame channel lookups are a binary search.
+    // These are rebuilt whenever the output list or the output start channels change.
+    struct ChannelRange
+    {
+        int32_t startChannel;
+        int32_t endChannel;
+        Output* output;
+    };
+    mutable std::vector<Output*> _outputIndex; // level 1 outputs in output number order
+    mutable std::vector<ChannelRange> _level1Ranges;
+    mutable std::vector<ChannelRange> _expandedRanges; // outputs in collections are listed individually
     #pragma endregion Member Variables
 
     static bool __isSync; // copied here so it can be accessed statically
@@ -38,6 +53,8 @@ class OutputManager
     static bool _isInteractive;
 
     bool SetGlobalOutputtingFlag(bool state, bool force = false);
+    void BuildChannelIndex() const;
+    static const ChannelRange* FindChannelRange(const std::vector<ChannelRange>& ranges, int32_t absoluteChannel);
 
 public:
 
@@ -91,6 +108,8 @@ public:
     std::list<std::string> GetAutoLayoutControllerNames() const;
     void SetParallelTransmission(bool parallel) { _parallelTransmission = parallel; }
     bool GetParallelTransmission() const { return _parallelTransmission; }
+    void SetPacedTransmission(bool paced) { _pacedTransmission = paced; }
+    bool GetPacedTransmission() const { return _pacedTransmission; }
     bool IsOutputUsingIP(const std::string& ip) const;
     #pragma endregion Output Management
 
@@ -69,6 +69,7 @@ SequenceFileSettingsPanel::SequenceFileSettingsPanel(wxWindow* parent,xLightsFra
 	FSEQVersionChoice->SetSelection( FSEQVersionChoice->Append(_("V2 ZSTD (Default)")) );
 	FSEQVersionChoice->Append(_("V2 Uncompressed"));
 	FSEQVersionChoice->Append(_("V2 ZLIB"));
+	FSEQVersionChoice->Append(_("V2.1 ZSTD Per Output"));
 	GridBagSizer1->Add(FSEQVersionChoice, wxGBPosition(5, 1), wxDefaultSpan, wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
 	SetSizer(GridBagSizer1);
 	GridBagSizer1->Fit(this);
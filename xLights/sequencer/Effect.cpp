@@ -648,10 +648,10 @@ bool operator<(const Effect &e1, const Effect &e2)
     return false;
 }
 
-bool Effect::GetFrame(RenderBuffer &buffer, RenderCache &renderCache) {
+bool Effect::GetFrame(RenderBuffer &buffer, RenderCache &renderCache, bool shared) {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
     if (mCache == nullptr) {
-        mCache = renderCache.GetItem(this, &buffer);
+        mCache = renderCache.GetItem(this, &buffer, shared);
     }
     return mCache && mCache->GetFrame(&buffer);
 }
@@ -3030,11 +3030,8 @@ std::map<int, std::list<float>> xLightsFrame::LoadPolyphonicTranscription(AudioM
 
         for (size_t i = 0; i < frames; i++)
         {
-            std::list<float>* pdata = audio->GetFrameData(i, FRAMEDATA_NOTES, "");
-            if (pdata != nullptr)
-            {
-                res[i*intervalMS] = *pdata;
-            }
+            FrameDataSpan pdata = audio->GetFrameData(i, FRAMEDATA_NOTES, "");
+            res[i*intervalMS] = std::list<float>(pdata.begin(), pdata.end());
         }
 
         if (logger_pianodata.isDebugEnabled())
@@ -8622,6 +8622,7 @@ void xLightsFrame::OnButtonOtherFoldersClick(wxCommandEvent& event)
         logger_base.debug("FSEQ directory set to : %s.", (const char *)fseqDirectory.c_str());
         renderCacheDirectory = dlg.RenderCacheDirectory;
         logger_base.debug("Render Cache directory set to : %s.", (const char*)renderCacheDirectory.c_str());
+        AudioManager::SetFrameDataCacheFolder(renderCacheDirectory.ToStdString());
         backupDirectory = dlg.BackupDirectory;
         logger_base.debug("Backup directory set to : %s.", (const char *)backupDirectory.c_str());
         mAltBackupDir = dlg.AltBackupDirectory;
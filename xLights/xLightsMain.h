@@ -1335,10 +1335,14 @@ private:
         ~RenderTree() { Clear(); }
         void Clear();
         void Add(Model *el);
+        void Build();
         void Print();
+        RenderTreeData *Find(const std::string &modelName) const;
 
         unsigned int renderTreeChangeCount;
         std::list<RenderTreeData*> data;
+        NodeRangeIndex index;
+        std::unordered_map<std::string, RenderTreeData*> byName;
     } renderTree;
     int mAutoSaveInterval;
     int BackupPurgeDays;
@@ -1,18 +1,46 @@
 #include "Blend.h"
 
-//#define SIMD
+// SSE2 is always there on 64 bit x86 ... everything else uses the plain loops which compilers can vectorise
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD
+#endif
 
 #ifdef SIMD
-#include "emmintrin.h"
-#define ALIGNMENT (128 / 8)
-
-int GetMisalignedBytes(uint8_t* b1, uint8_t* b2)
+#include <emmintrin.h>
+#define SIMD_BYTES 16
+// pixel modes work on 16 pixels at a time which is 3 registers
+#define SIMD_PIXELS 16
+
+// byte j of the result is byte j + k of the 32 bytes a then b
+#define SIMD_DOWN(a, b, k) _mm_or_si128(_mm_srli_si128(a, k), _mm_slli_si128(b, 16 - k))
+// byte j of the result is byte j - k of the 32 bytes prev then a
+#define SIMD_UP(prev, a, k) _mm_or_si128(_mm_slli_si128(a, k), _mm_srli_si128(prev, 16 - k))
+
+// sets every byte of each of the 16 pixels at p to 0xFF if the pixel is not black and to 0x00 if it is
+static inline void PixelNotBlack(const uint8_t* p, __m128i& m0, __m128i& m1, __m128i& m2)
 {
-    int m1 = (size_t)b1 % ALIGNMENT;
-    int m2 = (size_t)b2 % ALIGNMENT;
-
-    if (m1 == m2) return m1;
-    return -1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ff = _mm_set1_epi8((char)0xFF);
+
+    // 0xFF for every channel that is not zero
+    __m128i v0 = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), zero), ff);
+    __m128i v1 = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 16)), zero), ff);
+    __m128i v2 = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 32)), zero), ff);
+
+    // combine each channel with the two after it so the first channel of each pixel covers the whole pixel
+    __m128i a0 = _mm_or_si128(v0, _mm_or_si128(SIMD_DOWN(v0, v1, 1), SIMD_DOWN(v0, v1, 2)));
+    __m128i a1 = _mm_or_si128(v1, _mm_or_si128(SIMD_DOWN(v1, v2, 1), SIMD_DOWN(v1, v2, 2)));
+    __m128i a2 = _mm_or_si128(v2, _mm_or_si128(_mm_srli_si128(v2, 1), _mm_srli_si128(v2, 2)));
+
+    // keep just the first channel of each pixel
+    a0 = _mm_and_si128(a0, _mm_setr_epi8(-1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1));
+    a1 = _mm_and_si128(a1, _mm_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0));
+    a2 = _mm_and_si128(a2, _mm_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0));
+
+    // and copy it to the other two
+    m0 = _mm_or_si128(a0, _mm_or_si128(_mm_slli_si128(a0, 1), _mm_slli_si128(a0, 2)));
+    m1 = _mm_or_si128(a1, _mm_or_si128(SIMD_UP(a0, a1, 1), SIMD_UP(a0, a1, 2)));
+    m2 = _mm_or_si128(a2, _mm_or_si128(SIMD_UP(a1, a2, 1), SIMD_UP(a1, a2, 2)));
 }
 #endif
 
@@ -139,6 +167,7 @@ void Blend(uint8_t* buffer, size_t bufferSize, uint8_t* blendBuffer, size_t blen
     }
 }
 
+
 void Overwrite(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
     memcpy(buffer, blendBuffer, channels);
@@ -146,113 +175,67 @@ void Overwrite(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 
 void OverwriteIfZero(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(buffer + i) == 0x00)
-            {
-                *(buffer + i) = *(blendBuffer + i);
-            }
-        }
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
 
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(b, zero); // sets FF where B is zero
-            __m128i newv = _mm_and_si128(mask, bb); // grab bb where B has zero
-            __m128i r = _mm_or_si128(b, newv); // merge them
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(buffer + offset) == 0)
-            {
-                *(buffer + offset) = *(blendBuffer + offset);
-            }
-        }
+        __m128i mask = _mm_cmpeq_epi8(b, zero); // sets FF where B is zero
+        __m128i newv = _mm_and_si128(mask, bb); // grab bb where B has zero
+        _mm_storeu_si128((__m128i*)(buffer + i), _mm_or_si128(b, newv)); // merge them
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
+        if (*(buffer + i) == 0x00)
         {
-            if (*(buffer + i) == 0x00)
-            {
-                *(buffer + i) = *(blendBuffer + i);
-            }
+            *(buffer + i) = *(blendBuffer + i);
         }
     }
 }
 
 void Mask(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(blendBuffer + i) > 0)
-            {
-                *(buffer + i) = 0x00;
-            }
-        }
-
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
 
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
-            __m128i r = _mm_and_si128(mask, b); // and the mask
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(blendBuffer + offset) > 0)
-            {
-                *(buffer + offset) = 0x00;
-            }
-        }
+        __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
+        _mm_storeu_si128((__m128i*)(buffer + i), _mm_and_si128(mask, b));
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
+        if (*(blendBuffer + i) > 0)
         {
-            if (*(blendBuffer + i) > 0)
-            {
-                *(buffer + i) = 0x00;
-            }
+            *(buffer + i) = 0x00;
         }
     }
 }
 
 void MaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
+    size_t i = 0;
+#ifdef SIMD
+    for (; i + SIMD_PIXELS <= pixels; i += SIMD_PIXELS)
+    {
+        __m128i m[3];
+        PixelNotBlack(blendBuffer + i * 3, m[0], m[1], m[2]);
+        for (int j = 0; j < 3; j++)
+        {
+            __m128i* p = (__m128i*)(buffer + i * 3 + j * 16);
+            _mm_storeu_si128(p, _mm_andnot_si128(m[j], _mm_loadu_si128(p)));
+        }
+    }
+#endif
+    for (; i < pixels; ++i)
     {
         uint8_t* p = blendBuffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
@@ -268,59 +251,43 @@ void MaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 
 void Unmask(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(blendBuffer + i) == 0)
-            {
-                *(buffer + i) = 0x00;
-            }
-        }
-
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
-            __m128i r = _mm_andnot_si128(mask, b); // invert the mask and then and it
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
 
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(blendBuffer + offset) == 0)
-            {
-                *(buffer + offset) = 0x00;
-            }
-        }
+        __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
+        _mm_storeu_si128((__m128i*)(buffer + i), _mm_andnot_si128(mask, b)); // invert the mask and then and it
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
+        if (*(blendBuffer + i) == 0)
         {
-            if (*(blendBuffer + i) == 0)
-            {
-                *(buffer + i) = 0x00;
-            }
+            *(buffer + i) = 0x00;
         }
     }
 }
 
 void UnmaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
+    size_t i = 0;
+#ifdef SIMD
+    for (; i + SIMD_PIXELS <= pixels; i += SIMD_PIXELS)
+    {
+        __m128i m[3];
+        PixelNotBlack(blendBuffer + i * 3, m[0], m[1], m[2]);
+        for (int j = 0; j < 3; j++)
+        {
+            __m128i* p = (__m128i*)(buffer + i * 3 + j * 16);
+            _mm_storeu_si128(p, _mm_and_si128(m[j], _mm_loadu_si128(p)));
+        }
+    }
+#endif
+    for (; i < pixels; ++i)
     {
         uint8_t* p = blendBuffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
@@ -336,132 +303,76 @@ void UnmaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 
 void Average(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    const __m128i one = _mm_set1_epi8(1);
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = (uint8_t)(((int)*(buffer + i) + (int)*(blendBuffer + i)) / 2);
-        }
-
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_avg_epu8(b, bb);
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
 
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = (uint8_t)(((int)*(buffer + offset) + (int)*(blendBuffer + offset)) / 2);
-        }
+        // _mm_avg_epu8 rounds up so take off the odd bit to match the integer division below
+        __m128i r = _mm_sub_epi8(_mm_avg_epu8(b, bb), _mm_and_si128(_mm_xor_si128(b, bb), one));
+        _mm_storeu_si128((__m128i*)(buffer + i), r);
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = (uint8_t)(((int)*(buffer + i) + (int)*(blendBuffer + i)) / 2);
-        }
+        *(buffer + i) = (uint8_t)(((int)*(buffer + i) + (int)*(blendBuffer + i)) / 2);
     }
 }
 
 void Maximum(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = std::max(*(buffer + i), *(blendBuffer + i));
-        }
-
-        // do the aligned pieces using SIMD instructions ... up to 16 times faster
-        int simd = (channels - misaligned) / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_max_epu8(b, bb);
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-                                }
-
-        // do the residual part at the end where we dont have enough bytes to process
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = std::max(*(buffer + offset), *(blendBuffer + offset));
-        }
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
+        _mm_storeu_si128((__m128i*)(buffer + i), _mm_max_epu8(b, bb));
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = std::max(*(buffer + i), *(blendBuffer + i));
-        }
+        *(buffer + i) = std::max(*(buffer + i), *(blendBuffer + i));
     }
 }
 
 void Minimum(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
+    size_t i = 0;
 #ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
+    for (; i + SIMD_BYTES <= channels; i += SIMD_BYTES)
     {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = std::min(*(buffer + i), *(blendBuffer + i));
-        }
-
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_min_epu8(b, bb);
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = std::min(*(buffer + offset), *(blendBuffer + offset));
-        }
+        __m128i b = _mm_loadu_si128((__m128i*)(buffer + i));
+        __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i));
+        _mm_storeu_si128((__m128i*)(buffer + i), _mm_min_epu8(b, bb));
     }
-    else
 #endif
+    for (; i < channels; ++i)
     {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = std::min(*(buffer + i), *(blendBuffer + i));
-        }
+        *(buffer + i) = std::min(*(buffer + i), *(blendBuffer + i));
     }
 }
 
 void OverwriteIfBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
+    size_t i = 0;
+#ifdef SIMD
+    for (; i + SIMD_PIXELS <= pixels; i += SIMD_PIXELS)
+    {
+        __m128i m[3];
+        PixelNotBlack(buffer + i * 3, m[0], m[1], m[2]);
+        for (int j = 0; j < 3; j++)
+        {
+            __m128i* p = (__m128i*)(buffer + i * 3 + j * 16);
+            __m128i bb = _mm_loadu_si128((__m128i*)(blendBuffer + i * 3 + j * 16));
+            _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(m[j], _mm_loadu_si128(p)), _mm_andnot_si128(m[j], bb)));
+        }
+    }
+#endif
+    for (; i < pixels; ++i)
     {
         uint8_t* p = buffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
@@ -474,3 +385,100 @@ void OverwriteIfBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
         }
     }
 }
+
+static bool IsPixelMethod(APPLYMETHOD applyMethod)
+{
+    return applyMethod == APPLYMETHOD::METHOD_OVERWRITEIFBLACK ||
+        applyMethod == APPLYMETHOD::METHOD_MASKPIXEL ||
+        applyMethod == APPLYMETHOD::METHOD_UNMASKPIXEL;
+}
+
+void BlendCompositor::Add(uint8_t* blendBuffer, size_t blendBufferSize, APPLYMETHOD applyMethod, size_t offset)
+{
+    if (blendBuffer == nullptr || blendBufferSize == 0) return;
+    _layers.push_back({ blendBuffer, blendBufferSize, applyMethod, offset });
+}
+
+void BlendCompositor::Composite(uint8_t* buffer, size_t bufferSize)
+{
+    struct Range
+    {
+        size_t start;
+        size_t end;
+        size_t done;
+        bool pixels;
+    };
+
+    // work out the part of the buffer each layer covers the same way Blend does
+    std::vector<Range> ranges;
+    ranges.reserve(_layers.size());
+    for (const auto& it : _layers)
+    {
+        Range r;
+        r.pixels = IsPixelMethod(it.applyMethod);
+        r.start = std::min(it.offset, bufferSize);
+        size_t bytes = it.offset > bufferSize ? 0 : std::min(bufferSize - it.offset, it.blendBufferSize);
+        if (r.pixels) bytes = bytes / 3 * 3;
+        r.end = r.start + bytes;
+        r.done = r.start;
+        ranges.push_back(r);
+    }
+
+    // each layer may only go as far as the layers before it so the result is the same as blending them one at a time.
+    // Pixel layers stop at their last whole pixel and pick up the rest with the next block
+    for (size_t block = 0; block < bufferSize; block += BLEND_COMPOSITOR_BLOCK)
+    {
+        size_t frontier = std::min(bufferSize, block + BLEND_COMPOSITOR_BLOCK);
+        for (size_t i = 0; i < _layers.size(); i++)
+        {
+            auto& r = ranges[i];
+            if (r.pixels && frontier > r.start && frontier < r.end)
+            {
+                frontier = r.start + (frontier - r.start) / 3 * 3;
+            }
+
+            size_t to = std::min(frontier, r.end);
+            if (to > r.done)
+            {
+                const auto& l = _layers[i];
+                size_t bytes = to - r.done;
+                uint8_t* pb = buffer + r.done;
+                uint8_t* pbb = l.blendBuffer + (r.done - r.start);
+                switch (l.applyMethod)
+                {
+                case APPLYMETHOD::METHOD_OVERWRITE:
+                    Overwrite(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_OVERWRITEIFZERO:
+                    OverwriteIfZero(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_MASK:
+                    Mask(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_UNMASK:
+                    Unmask(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_AVERAGE:
+                    Average(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_MAX:
+                    Maximum(pb, pbb, bytes);
+                    break;
+                case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+                    OverwriteIfBlack(pb, pbb, bytes / 3);
+                    break;
+                case APPLYMETHOD::METHOD_MASKPIXEL:
+                    MaskPixel(pb, pbb, bytes / 3);
+                    break;
+                case APPLYMETHOD::METHOD_UNMASKPIXEL:
+                    UnmaskPixel(pb, pbb, bytes / 3);
+                    break;
+                case APPLYMETHOD::METHOD_MIN:
+                    Minimum(pb, pbb, bytes);
+                    break;
+                }
+                r.done = to;
+            }
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #define BLEND_H
 
 #include <string>
+#include <vector>
 #include <wx/wx.h>
 
 class wxChoice;
@@ -36,4 +37,27 @@ void UnmaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels);
 APPLYMETHOD EncodeBlendMode(const std::string blendMode);
 std::string DecodeBlendMode(APPLYMETHOD blendMode);
 
+// bytes of the buffer blended by every layer before moving on ... small enough to stay in the cache
+#define BLEND_COMPOSITOR_BLOCK (16 * 1024)
+
+// Blends a stack of buffers in one pass over the target giving the same result as calling Blend for each in the
+// order they were added. The blend buffers must remain valid until Composite is called.
+class BlendCompositor
+{
+    struct Layer
+    {
+        uint8_t* blendBuffer;
+        size_t blendBufferSize;
+        APPLYMETHOD applyMethod;
+        size_t offset;
+    };
+    std::vector<Layer> _layers;
+
+public:
+    void Add(uint8_t* blendBuffer, size_t blendBufferSize, APPLYMETHOD applyMethod, size_t offset = 0);
+    void Composite(uint8_t* buffer, size_t bufferSize);
+    void Clear() { _layers.clear(); }
+    size_t GetLayerCount() const { return _layers.size(); }
+};
+
 #endif
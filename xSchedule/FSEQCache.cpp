@@ -0,0 +1,219 @@
+#include "FSEQCache.h"
+#include "../xLights/FSEQFile.h"
+
+#include <wx/thread.h>
+#include <chrono>
+#include <cstring>
+
+#include <log4cpp/Category.hh>
+
+class FSEQPrefetchThread : public wxThread
+{
+    CachedFSEQReader* _reader;
+
+public:
+
+    FSEQPrefetchThread(CachedFSEQReader* reader) : wxThread(wxTHREAD_JOINABLE)
+    {
+        _reader = reader;
+    }
+
+    virtual void* Entry() override
+    {
+        static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        logger_base.debug("FSEQ prefetch thread started.");
+
+        while (_reader->PrefetchNext())
+        {
+        }
+
+        logger_base.debug("FSEQ prefetch thread stopped.");
+        return nullptr;
+    }
+};
+
+CachedFSEQReader::CachedFSEQReader(FSEQFile* fseqFile, size_t frameSize, int framesToCache)
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _fseqFile = fseqFile;
+    _frameSize = frameSize;
+    _numFrames = fseqFile->getNumFrames();
+    _currentFrame = -1;
+    _decodingFrame = -1;
+    _stop = false;
+    _hits = 0;
+    _misses = 0;
+    _decodes = 0;
+    _decodeTimeUS = 0;
+    _maxDecodeTimeUS = 0;
+    _maxDecodeFrame = -1;
+
+    // all the buffers are allocated up front so playback never allocates
+    if (framesToCache < 2) framesToCache = 2;
+    _cache.resize(framesToCache);
+    for (auto& it : _cache)
+    {
+        it.data.resize(_frameSize);
+    }
+    _spare.resize(_frameSize);
+
+    _thread = new FSEQPrefetchThread(this);
+    if (_thread->Run() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("Failed to start FSEQ prefetch thread for %s ... frames will be read as they are needed.", (const char *)_fseqFile->getFilename().c_str());
+        delete _thread;
+        _thread = nullptr;
+    }
+}
+
+CachedFSEQReader::~CachedFSEQReader()
+{
+    Stop();
+    if (_thread != nullptr)
+    {
+        _thread->Wait();
+        delete _thread;
+        _thread = nullptr;
+    }
+    LogStatistics();
+}
+
+void CachedFSEQReader::Stop()
+{
+    std::unique_lock<std::mutex> locker(_cacheAccess);
+    _stop = true;
+    _signal.notify_all();
+}
+
+uint64_t CachedFSEQReader::Decode(long frame, uint8_t* buffer)
+{
+    std::unique_lock<std::mutex> locker(_fileAccess);
+    auto start = std::chrono::steady_clock::now();
+
+    FSEQFile::FrameData *data = _fseqFile->getFrame(frame);
+    if (data != nullptr)
+    {
+        data->readFrame(buffer, _frameSize);
+        delete data;
+    }
+    else
+    {
+        memset(buffer, 0x00, _frameSize);
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool CachedFSEQReader::PrefetchNext()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::unique_lock<std::mutex> locker(_cacheAccess);
+    while (!_stop)
+    {
+        long next = -1;
+        for (long f = _currentFrame + 1; InWindow(f); ++f)
+        {
+            if (_cache[f % _cache.size()].frame != f)
+            {
+                next = f;
+                break;
+            }
+        }
+
+        if (next >= 0)
+        {
+            _decodingFrame = next;
+            locker.unlock();
+            uint64_t us = Decode(next, &_spare[0]);
+            locker.lock();
+            _decodingFrame = -1;
+
+            _decodes++;
+            _decodeTimeUS += us;
+            if (us > _maxDecodeTimeUS)
+            {
+                _maxDecodeTimeUS = us;
+                _maxDecodeFrame = next;
+            }
+            if (us > (uint64_t)_fseqFile->getStepTime() * 1000)
+            {
+                logger_base.warn("FSEQ prefetch of frame %ld took %ldms which is longer than a frame.", next, (long)(us / 1000));
+            }
+
+            // the consumer may have jumped while we were decoding
+            auto& cf = _cache[next % _cache.size()];
+            if (InWindow(next) && cf.frame != next)
+            {
+                std::swap(cf.data, _spare);
+                cf.frame = next;
+            }
+            _signal.notify_all();
+            return true;
+        }
+        _signal.wait(locker);
+    }
+    return false;
+}
+
+uint8_t* CachedFSEQReader::GetFrame(long frame)
+{
+    // the file has no data for frames past the end
+    if (frame < 0 || frame >= _numFrames) return nullptr;
+
+    std::unique_lock<std::mutex> locker(_cacheAccess);
+    _currentFrame = frame;
+    _signal.notify_all();
+
+    auto& cf = _cache[frame % _cache.size()];
+    if (cf.frame == frame)
+    {
+        _hits++;
+        return &cf.data[0];
+    }
+
+    _misses++;
+
+    // if the prefetcher is already working on it then waiting is quicker than decoding it again
+    while (_decodingFrame == frame)
+    {
+        _signal.wait(locker);
+    }
+    if (cf.frame == frame)
+    {
+        return &cf.data[0];
+    }
+
+    // the prefetcher never writes to the current frames slot so we can decode into it unlocked
+    cf.frame = -1;
+    locker.unlock();
+    uint64_t us = Decode(frame, &cf.data[0]);
+    locker.lock();
+    cf.frame = frame;
+
+    _decodes++;
+    _decodeTimeUS += us;
+    if (us > _maxDecodeTimeUS)
+    {
+        _maxDecodeTimeUS = us;
+        _maxDecodeFrame = frame;
+    }
+
+    return &cf.data[0];
+}
+
+void CachedFSEQReader::LogStatistics()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::unique_lock<std::mutex> locker(_cacheAccess);
+    logger_base.debug("FSEQ prefetch %s: hits %lu, misses %lu, frames decoded %lu, average decode %luus, slowest decode %luus at frame %ld.",
+        (const char *)_fseqFile->getFilename().c_str(),
+        (unsigned long)_hits,
+        (unsigned long)_misses,
+        (unsigned long)_decodes,
+        (unsigned long)(_decodes == 0 ? 0 : _decodeTimeUS / _decodes),
+        (unsigned long)_maxDecodeTimeUS,
+        _maxDecodeFrame);
+}
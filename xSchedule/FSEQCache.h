@@ -0,0 +1,64 @@
+#ifndef FSEQCACHE_H
+#define FSEQCACHE_H
+
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+class FSEQFile;
+class FSEQPrefetchThread;
+
+// Decodes frames ahead of playback on a background thread into a ring of preallocated
+// buffers so a slow block decompress does not stall the frame timer
+class CachedFSEQReader
+{
+    struct CachedFrame
+    {
+        long frame = -1;
+        std::vector<uint8_t> data;
+    };
+
+    FSEQFile* _fseqFile;
+    std::vector<CachedFrame> _cache;
+    std::vector<uint8_t> _spare;
+    std::mutex _cacheAccess;
+    std::mutex _fileAccess;
+    std::condition_variable _signal;
+    FSEQPrefetchThread* _thread;
+    size_t _frameSize;
+    long _numFrames;
+    long _currentFrame;
+    long _decodingFrame;
+    bool _stop;
+
+    // statistics
+    size_t _hits;
+    size_t _misses;
+    size_t _decodes;
+    uint64_t _decodeTimeUS;
+    uint64_t _maxDecodeTimeUS;
+    long _maxDecodeFrame;
+
+    bool InWindow(long frame) const { return frame > _currentFrame && frame < _currentFrame + (long)_cache.size() && frame < _numFrames; }
+    uint64_t Decode(long frame, uint8_t* buffer);
+
+public:
+    CachedFSEQReader(FSEQFile* fseqFile, size_t frameSize, int framesToCache);
+    virtual ~CachedFSEQReader();
+
+    // the returned buffer is frameSize bytes and remains valid until the next call
+    uint8_t* GetFrame(long frame);
+    void LogStatistics();
+
+    // used by the prefetch thread
+    bool PrefetchNext();
+    void Stop();
+
+    size_t GetFrameSize() const { return _frameSize; }
+    size_t GetHits() const { return _hits; }
+    size_t GetMisses() const { return _misses; }
+};
+
+#endif // FSEQCACHE_H
@@ -6,6 +6,7 @@
 
 class wxXmlNode;
 class OutputManager;
+class OutputProcessingPlan;
 
 class OutputProcess
 {
@@ -46,6 +47,10 @@ class OutputProcess
         void Enable(bool enable) { _enabled = enable; _changeCount++; }
 
         virtual void Frame(uint8_t* buffer, size_t size) = 0;
+
+        // processes that set each channel from a single channel through a lookup table describe that to the plan
+        // so they can be run in one pass with the processes around them. Return false to be run through Frame
+        virtual bool Plan(OutputProcessingPlan& plan, size_t size) { return false; }
 };
 
 #endif
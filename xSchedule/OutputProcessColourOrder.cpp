@@ -1,4 +1,5 @@
 #include "OutputProcessColourOrder.h"
+#include "OutputProcessingPlan.h"
 #include <wx/xml/xml.h>
 
 OutputProcessColourOrder::OutputProcessColourOrder(OutputManager* outputManager, wxXmlNode* node) : OutputProcess(outputManager, node)
@@ -84,3 +85,32 @@ void OutputProcessColourOrder::Frame(uint8_t* buffer, size_t size)
 		}
     }
 }
+
+bool OutputProcessColourOrder::Plan(OutputProcessingPlan& plan, size_t size)
+{
+    if (!_enabled) return true;
+    if (_colourOrder == 123) return true;
+
+    // each digit is the input colour that ends up in that position
+    int from[3] = { _colourOrder / 100 - 1, (_colourOrder / 10) % 10 - 1, _colourOrder % 10 - 1 };
+    for (int i = 0; i < 3; i++)
+    {
+        if (from[i] < 0 || from[i] > 2) return false;
+    }
+    if (from[0] == from[1] || from[0] == from[2] || from[1] == from[2]) return false;
+
+    size_t sc = GetStartChannelAsNumber();
+    if (sc == 0 || sc > size) return true;
+
+    size_t nodes = std::min(_nodes, (size - (sc - 1)) / 3);
+
+    for (size_t i = 0; i < nodes; i++)
+    {
+        size_t node = sc - 1 + i * 3;
+        for (int c = 0; c < 3; c++)
+        {
+            plan.MapChannel(node + c, node + from[c]);
+        }
+    }
+    return true;
+}
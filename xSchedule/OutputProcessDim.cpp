@@ -1,4 +1,5 @@
 #include "OutputProcessDim.h"
+#include "OutputProcessingPlan.h"
 #include <wx/xml/xml.h>
 
 OutputProcessDim::OutputProcessDim(OutputManager* outputManager, wxXmlNode* node) : OutputProcess(outputManager, node)
@@ -75,3 +76,21 @@ void OutputProcessDim::Frame(uint8_t* buffer, size_t size)
         *(buffer + i + sc - 1) = _dimTable[*(buffer + i + sc - 1)];
     }
 }
+
+bool OutputProcessDim::Plan(OutputProcessingPlan& plan, size_t size)
+{
+    if (!_enabled) return true;
+    if (_dim == 100) return true;
+
+    size_t sc = GetStartChannelAsNumber();
+    if (sc == 0 || sc > size) return true;
+
+    size_t chs = std::min(_channels, size - (sc - 1));
+
+    uint16_t lut = plan.AddLUT(_dimTable);
+    for (size_t i = 0; i < chs; i++)
+    {
+        plan.MapChannel(sc - 1 + i, sc - 1 + i, lut);
+    }
+    return true;
+}
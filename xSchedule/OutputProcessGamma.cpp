@@ -1,4 +1,5 @@
 #include "OutputProcessGamma.h"
+#include "OutputProcessingPlan.h"
 #include <wx/xml/xml.h>
 
 OutputProcessGamma::OutputProcessGamma(OutputManager* outputManager, wxXmlNode* node) : OutputProcess(outputManager, node)
@@ -107,3 +108,33 @@ void OutputProcessGamma::Frame(uint8_t* buffer, size_t size)
         }
     }
 }
+
+bool OutputProcessGamma::Plan(OutputProcessingPlan& plan, size_t size)
+{
+    if (!_enabled) return true;
+    if (_gamma == 1.0) return true;
+    if (_gamma == 0.00 && _gammaR == 1.0 && _gammaG == 1.0 && _gammaB == 1.0) return true;
+
+    size_t sc = GetStartChannelAsNumber();
+    if (sc == 0 || sc > size) return true;
+
+    size_t nodes = std::min(_nodes, (size - (sc - 1)) / 3);
+
+    uint16_t luts[3];
+    if (_gamma != 0.0)
+    {
+        luts[0] = luts[1] = luts[2] = plan.AddLUT(_gammaData);
+    }
+    else
+    {
+        luts[0] = plan.AddLUT(_gammaDataR);
+        luts[1] = plan.AddLUT(_gammaDataG);
+        luts[2] = plan.AddLUT(_gammaDataB);
+    }
+
+    for (size_t i = 0; i < nodes * 3; i++)
+    {
+        plan.MapChannel(sc - 1 + i, sc - 1 + i, luts[i % 3]);
+    }
+    return true;
+}
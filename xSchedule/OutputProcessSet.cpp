@@ -1,4 +1,5 @@
 #include "OutputProcessSet.h"
+#include "OutputProcessingPlan.h"
 #include <wx/xml/xml.h>
 
 OutputProcessSet::OutputProcessSet(OutputManager* outputManager, wxXmlNode* node) : OutputProcess(outputManager, node)
@@ -44,3 +45,20 @@ void OutputProcessSet::Frame(uint8_t* buffer, size_t size)
 
     memset(buffer + sc - 1, (uint8_t)_value, chs);
 }
+
+bool OutputProcessSet::Plan(OutputProcessingPlan& plan, size_t size)
+{
+    size_t sc = GetStartChannelAsNumber();
+    if (sc == 0 || sc > size) return true;
+
+    size_t chs = std::min(_channels, size - (sc - 1));
+
+    uint8_t value[256];
+    memset(value, (uint8_t)_value, sizeof(value));
+    uint16_t lut = plan.AddLUT(value);
+    for (size_t i = 0; i < chs; i++)
+    {
+        plan.MapChannel(sc - 1 + i, sc - 1 + i, lut);
+    }
+    return true;
+}
@@ -0,0 +1,304 @@
+#include "OutputProcessingPlan.h"
+#include "OutputProcess.h"
+
+#include <cstring>
+
+// table ids are 16 bit and UINT16_MAX means we ran out
+#define OUTPUTPROCESSINGPLAN_MAX_LUTS 65535
+
+OutputProcessingPlan::OutputProcessingPlan(const std::list<OutputProcess*>& processes, size_t size)
+{
+    _size = size;
+
+    uint8_t identity[256];
+    for (int i = 0; i < 256; i++)
+    {
+        identity[i] = (uint8_t)i;
+    }
+    _luts.assign(identity, identity + 256);
+    _lutIndex[std::string((char*)identity, 256)] = 0;
+
+    _source.resize(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        _source[i] = (uint32_t)i;
+    }
+    _lut.assign(size, 0);
+
+    for (const auto& it : processes)
+    {
+        _processes.push_back({ it, it->IsEnabled() });
+
+        _pending.clear();
+        if (it->Plan(*this, size))
+        {
+            if (CommitProcess()) continue;
+
+            // we ran out of tables ... start a new pass and try again
+            _pending.clear();
+            FinishStage();
+            if (it->Plan(*this, size) && CommitProcess()) continue;
+        }
+
+        _pending.clear();
+        FinishStage();
+        Stage stage;
+        stage.process = it;
+        _stages.push_back(stage);
+    }
+    FinishStage();
+
+    for (const auto& it : _stages)
+    {
+        if (it.gather)
+        {
+            _scratch.resize(size);
+            break;
+        }
+    }
+
+    // these are only needed while building
+    std::vector<uint32_t>().swap(_source);
+    std::vector<uint16_t>().swap(_lut);
+    std::vector<ChannelMap>().swap(_pending);
+    _lutIndex.clear();
+    _composed.clear();
+}
+
+bool OutputProcessingPlan::IsValid(const std::list<OutputProcess*>& processes, size_t size) const
+{
+    if (size != _size || processes.size() != _processes.size()) return false;
+
+    auto it2 = _processes.begin();
+    for (const auto& it : processes)
+    {
+        if (it != it2->first || it->IsEnabled() != it2->second) return false;
+        ++it2;
+    }
+    return true;
+}
+
+uint16_t OutputProcessingPlan::AddLUT(const uint8_t* lut)
+{
+    std::string key((const char*)lut, 256);
+    auto it = _lutIndex.find(key);
+    if (it != _lutIndex.end()) return it->second;
+
+    size_t count = _luts.size() / 256;
+    if (count >= OUTPUTPROCESSINGPLAN_MAX_LUTS) return UINT16_MAX;
+
+    _luts.insert(_luts.end(), lut, lut + 256);
+    _lutIndex[key] = (uint16_t)count;
+    return (uint16_t)count;
+}
+
+void OutputProcessingPlan::MapChannel(size_t channel, size_t from, uint16_t lut)
+{
+    if (channel >= _size || from >= _size) return;
+    _pending.push_back({ channel, from, lut });
+}
+
+bool OutputProcessingPlan::Compose(uint16_t first, uint16_t second, uint16_t& result)
+{
+    if (second == UINT16_MAX) return false;
+
+    if (second == 0)
+    {
+        result = first;
+        return true;
+    }
+    if (first == 0)
+    {
+        result = second;
+        return true;
+    }
+
+    auto it = _composed.find({ first, second });
+    if (it != _composed.end())
+    {
+        result = it->second;
+        return true;
+    }
+
+    uint8_t lut[256];
+    const uint8_t* f = &_luts[(size_t)first * 256];
+    const uint8_t* s = &_luts[(size_t)second * 256];
+    for (int i = 0; i < 256; i++)
+    {
+        lut[i] = s[f[i]];
+    }
+
+    result = AddLUT(lut);
+    if (result == UINT16_MAX) return false;
+
+    _composed[{ first, second }] = result;
+    return true;
+}
+
+bool OutputProcessingPlan::CommitProcess()
+{
+    // every channel the process sets must read the values from before the process so work them all out first
+    std::vector<std::pair<uint32_t, uint16_t>> values;
+    values.reserve(_pending.size());
+    for (const auto& it : _pending)
+    {
+        uint16_t lut;
+        if (!Compose(_lut[it.from], it.lut, lut)) return false;
+        values.push_back({ _source[it.from], lut });
+    }
+
+    for (size_t i = 0; i < _pending.size(); i++)
+    {
+        _source[_pending[i].channel] = values[i].first;
+        _lut[_pending[i].channel] = values[i].second;
+    }
+    _pending.clear();
+
+    return true;
+}
+
+void OutputProcessingPlan::FinishStage()
+{
+    Stage stage;
+
+    size_t i = 0;
+    while (i < _size)
+    {
+        if (_source[i] == i && _lut[i] == 0)
+        {
+            i++;
+            continue;
+        }
+
+        Run run;
+        run.start = i;
+        run.offset = stage.luts.size();
+        bool singleLUT = true;
+        uint16_t lut = _lut[i];
+        while (i < _size && (_source[i] != i || _lut[i] != 0))
+        {
+            if (_source[i] != i) run.gather = true;
+            if (_lut[i] != lut) singleLUT = false;
+            stage.sources.push_back(_source[i]);
+            stage.luts.push_back(_lut[i]);
+
+            _source[i] = (uint32_t)i;
+            _lut[i] = 0;
+            i++;
+        }
+        run.end = i;
+        if (!run.gather && singleLUT) run.lut = lut;
+        stage.gather = stage.gather || run.gather;
+        stage.runs.push_back(run);
+    }
+
+    if (stage.runs.size() > 0)
+    {
+        if (!stage.gather) stage.sources.clear();
+        _stages.push_back(std::move(stage));
+    }
+}
+
+void OutputProcessingPlan::ApplyStage(Stage& stage, uint8_t* buffer, const uint8_t* brightness)
+{
+    const uint8_t* src = buffer;
+    if (stage.gather)
+    {
+        memcpy(_scratch.data(), buffer, _size);
+        src = _scratch.data();
+    }
+
+    size_t pos = 0;
+    for (const auto& run : stage.runs)
+    {
+        if (brightness != nullptr)
+        {
+            for (; pos < run.start; pos++)
+            {
+                buffer[pos] = brightness[buffer[pos]];
+            }
+        }
+
+        if (run.lut >= 0)
+        {
+            const uint8_t* lut = &_luts[(size_t)run.lut * 256];
+            if (brightness != nullptr)
+            {
+                for (size_t i = run.start; i < run.end; i++)
+                {
+                    buffer[i] = brightness[lut[buffer[i]]];
+                }
+            }
+            else
+            {
+                for (size_t i = run.start; i < run.end; i++)
+                {
+                    buffer[i] = lut[buffer[i]];
+                }
+            }
+        }
+        else
+        {
+            const uint16_t* luts = &stage.luts[run.offset];
+            if (run.gather)
+            {
+                const uint32_t* sources = &stage.sources[run.offset];
+                for (size_t i = run.start, j = 0; i < run.end; i++, j++)
+                {
+                    uint8_t v = _luts[(size_t)luts[j] * 256 + src[sources[j]]];
+                    buffer[i] = brightness == nullptr ? v : brightness[v];
+                }
+            }
+            else
+            {
+                for (size_t i = run.start, j = 0; i < run.end; i++, j++)
+                {
+                    uint8_t v = _luts[(size_t)luts[j] * 256 + buffer[i]];
+                    buffer[i] = brightness == nullptr ? v : brightness[v];
+                }
+            }
+        }
+        pos = run.end;
+    }
+
+    if (brightness != nullptr)
+    {
+        for (; pos < _size; pos++)
+        {
+            buffer[pos] = brightness[buffer[pos]];
+        }
+    }
+}
+
+void OutputProcessingPlan::Apply(uint8_t* buffer, size_t size, const uint8_t* brightness)
+{
+    if (size != _size) return;
+
+    // brightness is folded into the last pass if there is one at the end of the chain
+    bool brightnessDone = brightness == nullptr;
+    for (size_t i = 0; i < _stages.size(); i++)
+    {
+        auto& stage = _stages[i];
+        if (stage.process != nullptr)
+        {
+            stage.process->Frame(buffer, size);
+        }
+        else if (i == _stages.size() - 1 && !brightnessDone)
+        {
+            ApplyStage(stage, buffer, brightness);
+            brightnessDone = true;
+        }
+        else
+        {
+            ApplyStage(stage, buffer, nullptr);
+        }
+    }
+
+    if (!brightnessDone)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            buffer[i] = brightness[buffer[i]];
+        }
+    }
+}
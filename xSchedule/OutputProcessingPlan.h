@@ -0,0 +1,77 @@
+#ifndef OUTPUTPROCESSINGPLAN_H
+#define OUTPUTPROCESSINGPLAN_H
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class OutputProcess;
+
+// The output processing chain compiled for a given frame size. Runs of processes which only set each channel
+// from a single channel through a lookup table (Dim, Gamma, Set, Colour Order, Remap) are composed into one
+// table per channel and applied in a single pass. Processes that cannot be described that way are run through
+// their Frame function between the passes.
+class OutputProcessingPlan
+{
+    struct Run
+    {
+        size_t start = 0;
+        size_t end = 0;
+        size_t offset = 0; // into the stage sources and tables
+        bool gather = false;
+        int lut = -1; // if every channel in the run uses the same table and reads itself
+    };
+
+    struct Stage
+    {
+        OutputProcess* process = nullptr;
+        std::vector<Run> runs;
+        std::vector<uint32_t> sources;
+        std::vector<uint16_t> luts;
+        bool gather = false;
+    };
+
+    struct ChannelMap
+    {
+        size_t channel;
+        size_t from;
+        uint16_t lut;
+    };
+
+    size_t _size = 0;
+    std::vector<Stage> _stages;
+    std::vector<uint8_t> _luts; // 256 entries per table ... table 0 is the identity
+    std::vector<uint8_t> _scratch;
+    std::list<std::pair<OutputProcess*, bool>> _processes;
+
+    // only used while the plan is being built
+    std::vector<uint32_t> _source;
+    std::vector<uint16_t> _lut;
+    std::vector<ChannelMap> _pending;
+    std::map<std::string, uint16_t> _lutIndex;
+    std::map<std::pair<uint16_t, uint16_t>, uint16_t> _composed;
+
+    bool Compose(uint16_t first, uint16_t second, uint16_t& result);
+    bool CommitProcess();
+    void FinishStage();
+    void ApplyStage(Stage& stage, uint8_t* buffer, const uint8_t* brightness);
+
+public:
+
+    OutputProcessingPlan(const std::list<OutputProcess*>& processes, size_t size);
+
+    // true if the plan still describes these processes
+    bool IsValid(const std::list<OutputProcess*>& processes, size_t size) const;
+
+    // brightness is a table applied to every channel once processing is done or nullptr
+    void Apply(uint8_t* buffer, size_t size, const uint8_t* brightness);
+
+    // used by processes while the plan is built. Returns the table to pass to MapChannel
+    uint16_t AddLUT(const uint8_t* lut);
+    // after the process channel (0 based) holds the value channel from held before it passed through lut
+    void MapChannel(size_t channel, size_t from, uint16_t lut = 0);
+};
+
+#endif
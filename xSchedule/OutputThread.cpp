@@ -0,0 +1,325 @@
+#include "OutputThread.h"
+#include "../xLights/outputs/OutputManager.h"
+
+#include <wx/string.h>
+
+#include <log4cpp/Category.hh>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __WXMSW__
+#include <windows.h>
+#include <mmsystem.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "winmm.lib")
+#endif
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// if the clock falls this many frames behind we stop trying to catch up and start again from now
+#define OUTPUTTHREAD_MAX_BEHIND 4
+
+#pragma region FrameTimingHistogram
+void FrameTimingHistogram::Add(double ms)
+{
+    if (ms < 0.0) ms = 0.0;
+
+    if (_count == 0 || ms < _min) _min = ms;
+    if (_count == 0 || ms > _max) _max = ms;
+    _count++;
+    _total += ms;
+
+    size_t bucket = std::min((size_t)ms, _buckets.size() - 1);
+    _buckets[bucket]++;
+}
+
+void FrameTimingHistogram::Clear()
+{
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _count = 0;
+    _total = 0.0;
+    _min = 0.0;
+    _max = 0.0;
+}
+
+int FrameTimingHistogram::GetPercentile(double fraction) const
+{
+    if (_count == 0) return 0;
+
+    uint32_t target = (uint32_t)(fraction * _count);
+    uint32_t seen = 0;
+    for (size_t i = 0; i < _buckets.size(); i++)
+    {
+        seen += _buckets[i];
+        if (seen > target) return (int)i + 1;
+    }
+    return (int)_buckets.size();
+}
+
+std::string FrameTimingHistogram::GetJSON() const
+{
+    // drop the empty buckets off the end
+    size_t used = _buckets.size();
+    while (used > 0 && _buckets[used - 1] == 0)
+    {
+        used--;
+    }
+
+    std::string buckets;
+    for (size_t i = 0; i < used; i++)
+    {
+        if (i != 0) buckets += ",";
+        buckets += wxString::Format("%u", _buckets[i]).ToStdString();
+    }
+
+    return wxString::Format("{\"count\":\"%u\",\"min\":\"%.1f\",\"max\":\"%.1f\",\"mean\":\"%.1f\",\"p50\":\"%d\",\"p95\":\"%d\",\"p99\":\"%d\",\"buckets\":[%s]}",
+        _count, _min, _max, GetMean(), GetPercentile(0.5), GetPercentile(0.95), GetPercentile(0.99), (const char*)buckets.c_str()).ToStdString();
+}
+
+std::string FrameTimingHistogram::GetSummary() const
+{
+    return wxString::Format("%u frames min %.1fms mean %.1fms max %.1fms 50%% <%dms 99%% <%dms",
+        _count, _min, GetMean(), _max, GetPercentile(0.5), GetPercentile(0.99)).ToStdString();
+}
+#pragma endregion
+
+#pragma region OutputThread
+OutputThread::OutputThread(OutputManager* outputManager, std::function<void()> tick) : wxThread(wxTHREAD_JOINABLE)
+{
+    _outputManager = outputManager;
+    _tick = tick;
+    _stop = false;
+    _tickPending = false;
+}
+
+OutputThread::~OutputThread()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    logger_base.info("Frame clock lateness: %s.", (const char*)_lateness.GetSummary().c_str());
+    logger_base.info("Frame build time: %s.", (const char*)_build.GetSummary().c_str());
+    logger_base.info("Frame send time: %s.", (const char*)_send.GetSummary().c_str());
+    logger_base.info("Frame ticks skipped: %u.", _skipped);
+}
+
+void OutputThread::Stop()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _stop = true;
+    _signal.notify_all();
+}
+
+void OutputThread::StartClock(int intervalMS)
+{
+    static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
+
+    if (intervalMS < 1) intervalMS = 1;
+
+    std::unique_lock<std::mutex> lock(_lock);
+    if (intervalMS == _interval) return;
+
+    if (_interval == 0)
+    {
+        _next = clock::now() + std::chrono::milliseconds(intervalMS);
+    }
+    else
+    {
+        // keep the phase of the clock ... the next tick moves by the change in interval
+        _next += std::chrono::milliseconds(intervalMS - _interval);
+    }
+    logger_frame.debug("Frame clock interval %dms", intervalMS);
+    _interval = intervalMS;
+    _signal.notify_all();
+}
+
+void OutputThread::StopClock()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _interval = 0;
+    _tickPending = false;
+    _signal.notify_all();
+}
+
+int OutputThread::GetInterval()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _interval;
+}
+
+void OutputThread::SendFrame(long msec, const uint8_t* buffer, size_t size, bool allOff)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+
+    if (_frame.size() < size) _frame.resize(size);
+    memcpy(_frame.data(), buffer, size);
+    _frameSize = size;
+    _frameMS = msec;
+    _frameAllOff = allOff;
+    _framePending = true;
+
+    if (_tickPending && _interval != 0)
+    {
+        _build.Add(std::chrono::duration<double, std::milli>(clock::now() - _tickTime).count());
+    }
+
+    _signal.notify_all();
+}
+
+std::unique_lock<std::mutex> OutputThread::Flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _signal.wait(lock, [this] { return !_framePending || _stop || !IsRunning(); });
+    }
+    return std::unique_lock<std::mutex>(_outputLock);
+}
+
+std::string OutputThread::GetTimingJSON()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return wxString::Format("{\"interval\":\"%d\",\"skipped\":\"%u\",\"lateness\":%s,\"build\":%s,\"send\":%s}",
+        _interval, _skipped, (const char*)_lateness.GetJSON().c_str(), (const char*)_build.GetJSON().c_str(), (const char*)_send.GetJSON().c_str()).ToStdString();
+}
+
+void OutputThread::ResetTiming()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _lateness.Clear();
+    _build.Clear();
+    _send.Clear();
+    _skipped = 0;
+}
+
+void OutputThread::SetRealTimePriority()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+#ifdef __WXMSW__
+    // without this waits are only accurate to the 15.6ms system tick
+    timeBeginPeriod(1);
+    if (::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL))
+    {
+        logger_base.debug("Output thread running at time critical priority.");
+    }
+#else
+    sched_param param;
+    memset(&param, 0x00, sizeof(param));
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+    int res = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (res == 0)
+    {
+        logger_base.debug("Output thread running with real time priority.");
+    }
+    else
+    {
+        // this normally needs elevated privileges ... the thread still runs at the highest normal priority
+        logger_base.debug("Output thread could not get real time priority %d.", res);
+    }
+#endif
+}
+
+// called holding _lock which is released while the frame is sent
+void OutputThread::DoSend(std::unique_lock<std::mutex>& lock)
+{
+    static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
+
+    // take the output lock before letting go of the frame so Flush cannot get in ahead of us
+    std::unique_lock<std::mutex> outputLock(_outputLock);
+    std::swap(_frame, _sending);
+    size_t size = _frameSize;
+    long msec = _frameMS;
+    bool allOff = _frameAllOff;
+    _framePending = false;
+    lock.unlock();
+
+    auto start = clock::now();
+    _outputManager->StartFrame(msec);
+    if (allOff)
+    {
+        _outputManager->AllOff(false);
+    }
+    _outputManager->SetManyChannels(0, _sending.data(), size);
+    _outputManager->EndFrame();
+    double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    outputLock.unlock();
+
+    logger_frame.debug("Output thread: Frame sent %.1fms", ms);
+
+    lock.lock();
+    _send.Add(ms);
+    _signal.notify_all();
+}
+
+// called holding _lock
+void OutputThread::DoTick(clock::time_point now)
+{
+    static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
+
+    _lateness.Add(std::chrono::duration<double, std::milli>(now - _next).count());
+
+    auto interval = std::chrono::milliseconds(_interval);
+    _next += interval;
+    if (now - _next > interval * OUTPUTTHREAD_MAX_BEHIND)
+    {
+        uint32_t missed = (uint32_t)((now - _next) / interval);
+        logger_frame.warn("Output thread: Frame clock %u frames behind ... restarting it.", missed);
+        _skipped += missed;
+        _next = now + interval;
+    }
+
+    if (_tickPending.exchange(true))
+    {
+        // the main thread has not got to the last one yet ... dont queue up another
+        _skipped++;
+        return;
+    }
+
+    _tickTime = now;
+    _tick();
+}
+
+wxThread::ExitCode OutputThread::Entry()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    logger_base.debug("Output thread started.");
+
+    SetRealTimePriority();
+
+    std::unique_lock<std::mutex> lock(_lock);
+    while (!_stop)
+    {
+        if (_framePending)
+        {
+            DoSend(lock);
+        }
+        else if (_interval == 0)
+        {
+            _signal.wait(lock);
+        }
+        else
+        {
+            auto now = clock::now();
+            if (now >= _next)
+            {
+                DoTick(now);
+            }
+            else
+            {
+                _signal.wait_until(lock, _next);
+            }
+        }
+    }
+    _signal.notify_all();
+    lock.unlock();
+
+#ifdef __WXMSW__
+    timeEndPeriod(1);
+#endif
+
+    logger_base.debug("Output thread stopped.");
+
+    return nullptr;
+}
+#pragma endregion
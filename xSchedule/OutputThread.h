@@ -0,0 +1,104 @@
+#ifndef OUTPUTTHREAD_H
+#define OUTPUTTHREAD_H
+
+#include <wx/thread.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class OutputManager;
+
+// frame timings are counted in 1ms buckets ... anything longer lands in the last one
+#define FRAMETIMING_BUCKETS 200
+
+class FrameTimingHistogram
+{
+    std::vector<uint32_t> _buckets;
+    uint32_t _count = 0;
+    double _total = 0.0;
+    double _min = 0.0;
+    double _max = 0.0;
+
+public:
+    FrameTimingHistogram() : _buckets(FRAMETIMING_BUCKETS, 0) {}
+    void Add(double ms);
+    void Clear();
+    uint32_t GetCount() const { return _count; }
+    double GetMean() const { return _count == 0 ? 0.0 : _total / _count; }
+    // the time below which the given fraction of the frames fell
+    int GetPercentile(double fraction) const;
+    std::string GetJSON() const;
+    std::string GetSummary() const;
+};
+
+// Runs the xSchedule frame clock and sends frames to the lights.
+//
+// The clock ticks on absolute deadlines so the time taken to service a tick never pushes the following ones
+// later. Each tick asks the main thread for a frame using the tick function and when the frame is handed back
+// through SendFrame it is sent from this thread ... so the network never holds up the UI and the UI never holds
+// up a frame that is ready to go.
+class OutputThread : public wxThread
+{
+    typedef std::chrono::steady_clock clock;
+
+    OutputManager* _outputManager;
+    std::function<void()> _tick;
+    std::atomic<bool> _stop;
+    std::atomic<bool> _tickPending;
+
+    // protects everything below
+    std::mutex _lock;
+    std::condition_variable _signal;
+    int _interval = 0; // 0 while the clock is stopped
+    clock::time_point _next;
+    clock::time_point _tickTime;
+    std::vector<uint8_t> _frame;
+    size_t _frameSize = 0;
+    long _frameMS = 0;
+    bool _frameAllOff = false;
+    bool _framePending = false;
+    FrameTimingHistogram _lateness;
+    FrameTimingHistogram _build;
+    FrameTimingHistogram _send;
+    uint32_t _skipped = 0;
+
+    // held while a frame is being sent
+    std::mutex _outputLock;
+    std::vector<uint8_t> _sending;
+
+    void SetRealTimePriority();
+    void DoSend(std::unique_lock<std::mutex>& lock);
+    void DoTick(clock::time_point now);
+    virtual ExitCode Entry() override;
+
+public:
+
+    OutputThread(OutputManager* outputManager, std::function<void()> tick);
+    virtual ~OutputThread();
+
+    // the clock keeps its phase when the interval changes
+    void StartClock(int intervalMS);
+    void StopClock();
+    int GetInterval();
+
+    // called on the main thread when it has finished with a tick whether or not it sent a frame
+    void TickDone() { _tickPending = false; }
+
+    // copies the frame and queues it to be sent. If another frame is already waiting it is replaced
+    void SendFrame(long msec, const uint8_t* buffer, size_t size, bool allOff);
+
+    // waits for any queued frame to be sent and returns holding the lock that keeps the thread off the outputs
+    std::unique_lock<std::mutex> Flush();
+
+    std::string GetTimingJSON();
+    void ResetTiming();
+    void Stop();
+};
+
+#endif
@@ -102,9 +102,11 @@ void PlayListItemDim::Frame(uint8_t* buffer, size_t size, size_t ms, size_t fram
 
         int toset = std::min(_channels, size - ((size_t)sc - 1));
 
-        parallel_for(0, toset, [buffer, sc, toset, this](int i) {
-            *(buffer + sc - 1 + i) = *(buffer + sc - 1 + i) * _dim / 100;
-        });
+        parallel_for_range(0, toset, [buffer, sc, this](int start, int end) {
+            for (int i = start; i < end; i++) {
+                *(buffer + sc - 1 + i) = *(buffer + sc - 1 + i) * _dim / 100;
+            }
+        }, 4096);
     }
 }
 
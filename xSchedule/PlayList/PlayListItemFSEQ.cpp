@@ -6,6 +6,7 @@
 #include <log4cpp/Category.hh>
 #include "../../xLights/UtilFunctions.h"
 #include "../../xLights/FSEQFile.h"
+#include "../FSEQCache.h"
 #include "../../xLights/outputs/OutputManager.h"
 
 PlayListItemFSEQ::PlayListItemFSEQ(OutputManager* outputManager, wxXmlNode* node) : PlayListItem(node)
@@ -24,6 +25,7 @@ PlayListItemFSEQ::PlayListItemFSEQ(OutputManager* outputManager, wxXmlNode* node
     _audioFile = "";
     _durationMS = 0;
     _fseqFile = nullptr;
+    _fseqReader = nullptr;
     _audioManager = nullptr;
     PlayListItemFSEQ::Load(node);
 }
@@ -212,6 +214,7 @@ PlayListItemFSEQ::PlayListItemFSEQ(OutputManager* outputManager) : PlayListItem(
     _durationMS = 0;
     _audioManager = nullptr;
     _fseqFile = nullptr;
+    _fseqReader = nullptr;
     _currentFrame = 0;
 }
 
@@ -494,11 +497,9 @@ void PlayListItemFSEQ::Frame(uint8_t* buffer, size_t size, size_t ms, size_t fra
                 ms -= _delay;
                 
                 int frame =  ms / framems;
-                FSEQFile::FrameData *data = _fseqFile->getFrame(frame);
-                if (data != nullptr)
+                uint8_t* buf = _fseqReader != nullptr ? _fseqReader->GetFrame(frame) : nullptr;
+                if (buf != nullptr)
                 {
-                    std::vector<uint8_t> buf(_fseqFile->getMaxChannel() + 1);
-                    data->readFrame(&buf[0], buf.size());
                     size_t channelsPerFrame = (size_t)_fseqFile->getMaxChannel() + 1;
                     if (_channels > 0) channelsPerFrame = std::min(_channels, (size_t)_fseqFile->getMaxChannel() + 1);
                     if (_channels > 0) {
@@ -508,7 +509,6 @@ void PlayListItemFSEQ::Frame(uint8_t* buffer, size_t size, size_t ms, size_t fra
                     else {
                         Blend(buffer, size, &buf[0], channelsPerFrame, _applyMethod, 0);
                     }
-                    delete data;
                 }
                 else
                 {
@@ -548,7 +548,22 @@ void PlayListItemFSEQ::Start(long stepLengthMS)
 
     if (_fseqFile != nullptr)
     {
-        _fseqFile->prepareRead({ { 0, _fseqFile->getMaxChannel() + 1 } });
+        size_t start = GetStartChannelAsNumber();
+        size_t fileChannels = _fseqFile->getChannelCount();
+        if (_channels > 0 && start > 0 && start - 1 < fileChannels)
+        {
+            // only the channels we output need to be decompressed ... but never ask for more than the file has
+            size_t first = start - 1;
+            size_t count = std::min(_channels, fileChannels - first);
+            _fseqFile->prepareRead({ { (uint32_t)first, (uint32_t)count } });
+        }
+        else
+        {
+            _fseqFile->prepareRead({ { 0, _fseqFile->getMaxChannel() + 1 } });
+        }
+
+        // decode about a second ahead of playback
+        _fseqReader = new CachedFSEQReader(_fseqFile, _fseqFile->getMaxChannel() + 1, std::max(10, 1000 / (int)_msPerFrame));
     }
 
     if (ControlsTiming() && _audioManager != nullptr)
@@ -598,6 +613,13 @@ void PlayListItemFSEQ::Stop()
 
 void PlayListItemFSEQ::CloseFiles()
 {
+    // the reader uses the file so it must go first
+    if (_fseqReader != nullptr)
+    {
+        delete _fseqReader;
+        _fseqReader = nullptr;
+    }
+
     if (_fseqFile != nullptr)
     {
         delete _fseqFile;
@@ -10,6 +10,7 @@ class wxWindow;
 class AudioManager;
 class OutputManager;
 class FSEQFile;
+class CachedFSEQReader;
 
 #define FSEQFILES "FSEQ files|*.fseq|All files (*.*)|*.*"
 
@@ -23,6 +24,7 @@ protected:
     std::string _audioFile;
     bool _overrideAudio;
     FSEQFile* _fseqFile;
+    CachedFSEQReader* _fseqReader;
     AudioManager* _audioManager;
     size_t _durationMS;
     bool _controlsTimingCache;
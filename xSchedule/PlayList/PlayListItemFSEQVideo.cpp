@@ -11,6 +11,7 @@
 #include "../xScheduleMain.h"
 #include "../ScheduleManager.h"
 #include "../../xLights/FSEQFile.h"
+#include "../FSEQCache.h"
 #include "../../xLights/UtilFunctions.h"
 #include "../../xLights/outputs/OutputManager.h"
 
@@ -44,6 +45,7 @@ PlayListItemFSEQVideo::PlayListItemFSEQVideo(OutputManager* outputManager, wxXml
     _audioFile = "";
     _durationMS = 0;
     _fseqFile = nullptr;
+    _fseqReader = nullptr;
     _audioManager = nullptr;
     PlayListItemFSEQVideo::Load(node);
 }
@@ -250,6 +252,7 @@ PlayListItemFSEQVideo::PlayListItemFSEQVideo(OutputManager* outputManager) : Pla
     _durationMS = 0;
     _audioManager = nullptr;
     _fseqFile = nullptr;
+    _fseqReader = nullptr;
     _window = nullptr;
     _videoFile = "";
     _origin.x = 0;
@@ -576,11 +579,9 @@ void PlayListItemFSEQVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_
 
             if (_fseqFile != nullptr) {
                 int frame =  adjustedMS / framems;
-                FSEQFile::FrameData *data = _fseqFile->getFrame(frame);
-                if (data != nullptr)
+                uint8_t* buf = _fseqReader != nullptr ? _fseqReader->GetFrame(frame) : nullptr;
+                if (buf != nullptr)
                 {
-                    std::vector<uint8_t> buf(_fseqFile->getMaxChannel() + 1);
-                    data->readFrame(&buf[0], buf.size());
                     size_t channelsPerFrame = (size_t)_fseqFile->getMaxChannel() + 1;
                     if (_channels > 0) channelsPerFrame = std::min(_channels, (size_t)_fseqFile->getMaxChannel() + 1);
                     if (_channels > 0) {
@@ -590,7 +591,6 @@ void PlayListItemFSEQVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_
                     else {
                         Blend(buffer, size, &buf[0], channelsPerFrame, _applyMethod, 0);
                     }
-                    delete data;
                 }
                 else
                 {
@@ -683,7 +683,22 @@ void PlayListItemFSEQVideo::Start(long stepLengthMS)
 
     if (_fseqFile != nullptr)
     {
-        _fseqFile->prepareRead({ { 0, _fseqFile->getMaxChannel() + 1} });
+        size_t start = GetStartChannelAsNumber();
+        size_t fileChannels = _fseqFile->getChannelCount();
+        if (_channels > 0 && start > 0 && start - 1 < fileChannels)
+        {
+            // only the channels we output need to be decompressed ... but never ask for more than the file has
+            size_t first = start - 1;
+            size_t count = std::min(_channels, fileChannels - first);
+            _fseqFile->prepareRead({ { (uint32_t)first, (uint32_t)count } });
+        }
+        else
+        {
+            _fseqFile->prepareRead({ { 0, _fseqFile->getMaxChannel() + 1 } });
+        }
+
+        // decode about a second ahead of playback
+        _fseqReader = new CachedFSEQReader(_fseqFile, _fseqFile->getMaxChannel() + 1, std::max(10, 1000 / (int)_msPerFrame));
     }
 
     _currentFrame = 0;
@@ -765,6 +780,13 @@ void PlayListItemFSEQVideo::Stop()
 
 void PlayListItemFSEQVideo::CloseFiles()
 {
+    // the reader uses the file so it must go first
+    if (_fseqReader != nullptr)
+    {
+        delete _fseqReader;
+        _fseqReader = nullptr;
+    }
+
     if (_fseqFile != nullptr)
     {
         delete _fseqFile;
@@ -13,6 +13,7 @@ class VideoReader;
 class CachedVideoReader;
 class OutputManager;
 class FSEQFile;
+class CachedFSEQReader;
 
 class PlayListItemFSEQVideo : public PlayListItem
 {
@@ -26,6 +27,7 @@ protected:
     bool _topMost;
     bool _suppressVirtualMatrix;
     FSEQFile* _fseqFile;
+    CachedFSEQReader* _fseqReader;
     AudioManager* _audioManager;
     size_t _durationMS;
     bool _controlsTimingCache;
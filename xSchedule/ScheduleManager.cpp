@@ -22,6 +22,8 @@
 #include "xScheduleApp.h"
 #include "UserButton.h"
 #include "OutputProcess.h"
+#include "OutputProcessingPlan.h"
+#include "OutputThread.h"
 #include "PlayList/PlayListItemAudio.h"
 #include "PlayList/PlayListItemFSEQ.h"
 #include "PlayList/PlayListItemFSEQVideo.h"
@@ -108,6 +110,7 @@ ScheduleManager::ScheduleManager(xScheduleFrame* frame, const std::string& showD
             {
                 _scheduleOptions = new ScheduleOptions(_outputManager, n, GetCommandManager());
                 _outputManager->SetParallelTransmission(_scheduleOptions->IsParallelTransmission());
+                _outputManager->SetPacedTransmission(_scheduleOptions->IsPacedTransmission());
                 OutputManager::SetRetryOpen(_scheduleOptions->IsRetryOpen());
                 _outputManager->SetSyncEnabled(_scheduleOptions->IsSync());
                 Schedule::SetCity(_scheduleOptions->GetCity());
@@ -145,6 +148,7 @@ ScheduleManager::ScheduleManager(xScheduleFrame* frame, const std::string& showD
         _scheduleOptions = new ScheduleOptions();
         Schedule::SetCity(_scheduleOptions->GetCity());
         _outputManager->SetParallelTransmission(_scheduleOptions->IsParallelTransmission());
+        _outputManager->SetPacedTransmission(_scheduleOptions->IsPacedTransmission());
         _outputManager->SetSyncEnabled(_scheduleOptions->IsSync());
         OutputManager::SetRetryOpen(_scheduleOptions->IsRetryOpen());
     }
@@ -176,6 +180,12 @@ ScheduleManager::ScheduleManager(xScheduleFrame* frame, const std::string& showD
         delete xlconfig;
     }
 
+    // the frame clock ticks and frames are sent on this thread ... the frames themselves are built on the main thread
+    _outputThread = std::make_unique<OutputThread>(_outputManager, [frame]() { frame->CallAfter(&xScheduleFrame::OnFrameClock); });
+    _outputThread->Create();
+    _outputThread->SetPriority(WXTHREAD_MAX_PRIORITY);
+    _outputThread->Run();
+
     if (_scheduleOptions->IsSendOffWhenNotRunning())
     {
         if (!_outputManager->IsOutputting())
@@ -404,7 +414,7 @@ ScheduleManager::~ScheduleManager()
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     AllOff();
-    _outputManager->StopOutput();
+    StopOutput();
 #ifdef __WXMSW__
     ::SetPriorityClass(::GetCurrentProcess(), NORMAL_PRIORITY_CLASS);
 #endif
@@ -412,6 +422,10 @@ ScheduleManager::~ScheduleManager()
     ManageBackground();
     logger_base.info("Stopped outputting to lights.");
 
+    _outputThread->Stop();
+    _outputThread->Wait();
+    _outputThread = nullptr;
+
     if (IsDirty())
     {
         if (wxMessageBox("Unsaved changes to the schedule. Save now?", "Unsaved changes", wxYES_NO) == wxYES)
@@ -454,6 +468,7 @@ ScheduleManager::~ScheduleManager()
         _eventPlayLists.pop_front();
     }
 
+    _outputProcessingPlan = nullptr;
     while (_outputProcessing.size() > 0)
     {
         auto toremove = _outputProcessing.front();
@@ -715,7 +730,6 @@ void ScheduleManager::AllOff()
     logger_base.debug("Turning all the lights off.");
 
     memset(_buffer, 0x00, _outputManager->GetTotalChannels()); // clear out any prior frame data
-    _outputManager->StartFrame(0);
 
     if ((_backgroundPlayList != nullptr || _eventPlayLists.size() > 0) && _scheduleOptions->IsSendBackgroundWhenNotRunning())
     {
@@ -754,41 +768,18 @@ void ScheduleManager::AllOff()
         }
 
         // apply any overlay data
-        for (auto it = _overlayData.begin(); it != _overlayData.end(); ++it)
-        {
-            (*it)->Set(_buffer, _outputManager->GetTotalChannels());
-        }
+        ApplyOverlays(_outputManager->GetTotalChannels());
     }
 
-    // apply any output processing
-    for (const auto& it : _outputProcessing)
-    {
-        it->Frame(_buffer, _outputManager->GetTotalChannels());
-    }
-
-    if (_brightness < 100)
-    {
-        if (_brightness != _lastBrightness)
-        {
-            _lastBrightness = _brightness;
-            CreateBrightnessArray();
-        }
-
-        uint8_t* pb = _buffer;
-        for (int i = 0; i < _outputManager->GetTotalChannels(); ++i)
-        {
-            *pb = _brightnessArray[*pb];
-            pb++;
-        }
-    }
+    // apply any output processing and the brightness
+    ApplyOutputProcessing(_outputManager->GetTotalChannels(), true);
 
     for (const auto& it : *GetOptions()->GetVirtualMatrices())
     {
         it->Frame(_buffer, _outputManager->GetTotalChannels());
     }
 
-    _outputManager->SetManyChannels(0, _buffer, _outputManager->GetTotalChannels());
-    _outputManager->EndFrame();
+    SendFrame(0, _outputManager->GetTotalChannels(), false);
 }
 
 int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
@@ -823,31 +814,11 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
         if (outputframe)
         {
             memset(_buffer, 0x00, totalChannels); // clear out any prior frame data
-            _outputManager->StartFrame(msec);
             TestFrame(_buffer, totalChannels, msec);
         }
 
-        // apply any output processing
-        for (auto it = _outputProcessing.begin(); it != _outputProcessing.end(); ++it)
-        {
-            (*it)->Frame(_buffer, totalChannels);
-        }
-
-        if (outputframe && _brightness < 100)
-        {
-            if (_brightness != _lastBrightness)
-            {
-                _lastBrightness = _brightness;
-                CreateBrightnessArray();
-            }
-
-            uint8_t* pb = _buffer;
-            for (int i = 0; i < totalChannels; ++i)
-            {
-                *pb = _brightnessArray[*pb];
-                pb++;
-            }
-        }
+        // apply any output processing and the brightness
+        ApplyOutputProcessing(totalChannels, outputframe);
 
         auto vm = GetOptions()->GetVirtualMatrices();
         for (auto it = vm->begin(); it != vm->end(); ++it)
@@ -857,8 +828,7 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
 
         if (outputframe)
         {
-            _outputManager->SetManyChannels(0, _buffer, totalChannels);
-            _outputManager->EndFrame();
+            SendFrame(msec, totalChannels, false);
         }
     }
     else
@@ -882,7 +852,6 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
             if (outputframe)
             {
                 memset(_buffer, 0x00, totalChannels); // clear out any prior frame data
-                _outputManager->StartFrame(msec);
             }
 
             bool done = false;
@@ -964,40 +933,16 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
             if (outputframe)
             {
                 // apply any overlay data
-                for (auto it = _overlayData.begin(); it != _overlayData.end(); ++it)
-                {
-                    (*it)->Set(_buffer, totalChannels);
-                }
+                ApplyOverlays(totalChannels);
 
                 frame->ManipulateBuffer(_buffer, totalChannels);
 
                 logger_frame.debug("Frame: Overlay data done %ldms", sw.Time());
 
-                // apply any output processing
-                for (auto it = _outputProcessing.begin(); it != _outputProcessing.end(); ++it)
-                {
-                    (*it)->Frame(_buffer, totalChannels);
-                }
-
-                logger_frame.debug("Frame: Output processing done %ldms", sw.Time());
+                // apply any output processing and the brightness
+                ApplyOutputProcessing(totalChannels, outputframe);
 
-                if (outputframe && _brightness < 100)
-                {
-                    if (_brightness != _lastBrightness)
-                    {
-                        _lastBrightness = _brightness;
-                        CreateBrightnessArray();
-                    }
-
-                    uint8_t* pb = _buffer;
-                    for (int i = 0; i < totalChannels; ++i)
-                    {
-                        *pb = _brightnessArray[*pb];
-                        pb++;
-                    }
-                }
-
-                logger_frame.debug("Frame: Brightness done %ldms", sw.Time());
+                logger_frame.debug("Frame: Output processing and brightness done %ldms", sw.Time());
 
                 auto vm = GetOptions()->GetVirtualMatrices();
                 for (auto it = vm->begin(); it != vm->end(); ++it)
@@ -1011,13 +956,9 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
 
                 logger_frame.debug("Frame: Listening done %ldms", sw.Time());
 
-                _outputManager->SetManyChannels(0, _buffer, totalChannels);
-
-                logger_frame.debug("Frame: Data set %ldms", sw.Time());
+                SendFrame(msec, totalChannels, false);
 
-                _outputManager->EndFrame();
-
-                logger_frame.debug("Frame: Data sent %ldms", sw.Time());
+                logger_frame.debug("Frame: Data queued for output %ldms", sw.Time());
             }
 
             if (done)
@@ -1046,8 +987,6 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
                 if (outputframe)
                 {
                     memset(_buffer, 0x00, totalChannels); // clear out any prior frame data
-                    _outputManager->StartFrame(0);
-                    _outputManager->AllOff(false);
                 }
 
                 if ((_backgroundPlayList != nullptr || _eventPlayLists.size() > 0) && _scheduleOptions->IsSendBackgroundWhenNotRunning())
@@ -1083,35 +1022,13 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
                     }
 
                     // apply any overlay data
-                    for (auto it = _overlayData.begin(); it != _overlayData.end(); ++it)
-                    {
-                        (*it)->Set(_buffer, totalChannels);
-                    }
+                    ApplyOverlays(totalChannels);
 
                     frame->ManipulateBuffer(_buffer, totalChannels);
                 }
 
-                // apply any output processing
-                for (auto it = _outputProcessing.begin(); it != _outputProcessing.end(); ++it)
-                {
-                    (*it)->Frame(_buffer, totalChannels);
-                }
-
-                if (outputframe && _brightness < 100)
-                {
-                    if (_brightness != _lastBrightness)
-                    {
-                        _lastBrightness = _brightness;
-                        CreateBrightnessArray();
-                    }
-
-                    uint8_t* pb = _buffer;
-                    for (int i = 0; i < totalChannels; ++i)
-                    {
-                        *pb = _brightnessArray[*pb];
-                        pb++;
-                    }
-                }
+                // apply any output processing and the brightness
+                ApplyOutputProcessing(totalChannels, outputframe);
 
                 auto vm = GetOptions()->GetVirtualMatrices();
                 for (auto it = vm->begin(); it != vm->end(); ++it)
@@ -1123,8 +1040,7 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
 
                 if (outputframe)
                 {
-                    _outputManager->SetManyChannels(0, _buffer, totalChannels);
-                    _outputManager->EndFrame();
+                    SendFrame(0, totalChannels, true);
                 }
             }
             else
@@ -1134,8 +1050,6 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
                     if (outputframe)
                     {
                         memset(_buffer, 0x00, totalChannels); // clear out any prior frame data
-                        _outputManager->StartFrame(0);
-                        _outputManager->AllOff(false);
                     }
 
                     auto it = _eventPlayLists.begin();
@@ -1157,27 +1071,8 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
 
                     frame->ManipulateBuffer(_buffer, totalChannels);
 
-                    // apply any output processing
-                    for (auto it2 = _outputProcessing.begin(); it2 != _outputProcessing.end(); ++it2)
-                    {
-                        (*it2)->Frame(_buffer, totalChannels);
-                    }
-
-                    if (outputframe && _brightness < 100)
-                    {
-                        if (_brightness != _lastBrightness)
-                        {
-                            _lastBrightness = _brightness;
-                            CreateBrightnessArray();
-                        }
-
-                        uint8_t* pb = _buffer;
-                        for (int i = 0; i < totalChannels; ++i)
-                        {
-                            *pb = _brightnessArray[*pb];
-                            pb++;
-                        }
-                    }
+                    // apply any output processing and the brightness
+                    ApplyOutputProcessing(totalChannels, outputframe);
 
                     for (auto it2 :*GetOptions()->GetVirtualMatrices())
                     {
@@ -1186,14 +1081,14 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
 
                     if (outputframe)
                     {
-                        _outputManager->SetManyChannels(0, _buffer, totalChannels);
-                        _outputManager->EndFrame();
+                        SendFrame(0, totalChannels, true);
                     }
 
                     if (_eventPlayLists.size() == 0)
                     {
                         // last event playlist ended ... turn everything off
-                        _outputManager->AllOff(true);
+                        memset(_buffer, 0x00, totalChannels);
+                        SendFrame(0, totalChannels, true);
                         for (auto& it2 : *GetOptions()->GetVirtualMatrices())
                         {
                             it2->AllOff();
@@ -1208,6 +1103,8 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
     if (rate == 0) rate = 50;
     oldrate = rate;
 
+    _outputThread->TickDone();
+
     if (_overrideMS != 0)
     {
         rate = _overrideMS;
@@ -1216,6 +1113,33 @@ int ScheduleManager::Frame(bool outputframe, xScheduleFrame* frame)
     return rate;
 }
 
+void ScheduleManager::SendFrame(long msec, size_t totalChannels, bool allOff)
+{
+    _outputThread->SendFrame(msec, _buffer, totalChannels, allOff);
+}
+
+void ScheduleManager::StopOutput()
+{
+    // make sure the last frame we queued gets out before the outputs close
+    auto lock = _outputThread->Flush();
+    _outputManager->StopOutput();
+}
+
+void ScheduleManager::StartFrameClock(int frameMS)
+{
+    _outputThread->StartClock(frameMS);
+}
+
+void ScheduleManager::StopFrameClock()
+{
+    _outputThread->StopClock();
+}
+
+int ScheduleManager::GetFrameClockInterval() const
+{
+    return _outputThread->GetInterval();
+}
+
 bool ScheduleManager::IsSlave() const
 {
     if (_syncManager != nullptr)
@@ -1234,6 +1158,42 @@ bool ScheduleManager::IsFPPRemoteOrMaster() const
     return false;
 }
 
+void ScheduleManager::ApplyOverlays(size_t totalChannels)
+{
+    if (_overlayData.size() == 0) return;
+
+    // blend all the overlays in one pass rather than one pass each
+    _overlayCompositor.Clear();
+    for (const auto& it : _overlayData)
+    {
+        it->AddTo(_overlayCompositor);
+    }
+    _overlayCompositor.Composite(_buffer, totalChannels);
+}
+
+void ScheduleManager::ApplyOutputProcessing(size_t totalChannels, bool applyBrightness)
+{
+    // the chain is compiled into a plan which is only rebuilt when the processing or the channel count changes
+    if (_outputProcessingPlan == nullptr || _outputProcessingPlanChangeCount != _changeCount || !_outputProcessingPlan->IsValid(_outputProcessing, totalChannels))
+    {
+        _outputProcessingPlan = std::make_unique<OutputProcessingPlan>(_outputProcessing, totalChannels);
+        _outputProcessingPlanChangeCount = _changeCount;
+    }
+
+    const uint8_t* brightness = nullptr;
+    if (applyBrightness && _brightness < 100)
+    {
+        if (_brightness != _lastBrightness)
+        {
+            _lastBrightness = _brightness;
+            CreateBrightnessArray();
+        }
+        brightness = _brightnessArray;
+    }
+
+    _outputProcessingPlan->Apply(_buffer, totalChannels, brightness);
+}
+
 void ScheduleManager::CreateBrightnessArray()
 {
     for (size_t i = 0; i < 256; i++)
@@ -1587,7 +1547,8 @@ bool ScheduleManager::IsQuery(const wxString& command)
         c == "getplaylistschedule" ||
         c == "getplayingstatus" ||
         c == "getrangesset" ||
-        c == "getbuttons")
+        c == "getbuttons" ||
+        c == "getframetiming")
     {
         return true;
     }
@@ -3733,6 +3694,10 @@ bool ScheduleManager::Query(const wxString& command, const wxString& parameters,
     {
         data = _scheduleOptions->GetButtonsJSON(_commandManager, reference);
     }
+    else if (c == "getframetiming")
+    {
+        data = "{\"frametiming\":" + _outputThread->GetTimingJSON() + ",\"reference\":\"" + reference + "\"}";
+    }
     else
     {
         result = false;
@@ -4020,7 +3985,7 @@ void ScheduleManager::SetOutputToLights(xScheduleFrame* frame, bool otl, bool in
         {
             if (IsOutputToLights())
             {
-                _outputManager->StopOutput();
+                StopOutput();
 #ifdef __WXMSW__
                 ::SetPriorityClass(::GetCurrentProcess(), NORMAL_PRIORITY_CLASS);
 #endif
@@ -4056,7 +4021,7 @@ void ScheduleManager::ManualOutputToLightsClick(xScheduleFrame* frame)
     }
     else if (_manualOTL == 0)
     {
-        _outputManager->StopOutput();
+        StopOutput();
 #ifdef __WXMSW__
         ::SetPriorityClass(::GetCurrentProcess(), NORMAL_PRIORITY_CLASS);
 #endif
@@ -5280,6 +5245,14 @@ void PixelData::Set(uint8_t* buffer, size_t size)
     }
 }
 
+void PixelData::AddTo(BlendCompositor& compositor)
+{
+    if (_data != nullptr)
+    {
+        compositor.Add(_data, _size, _blendMode, _startChannel - 1);
+    }
+}
+
 void PixelData::ExtractData(const wxString& data)
 {
     std::vector<unsigned char> dout;
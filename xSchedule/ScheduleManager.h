@@ -18,6 +18,8 @@ class OutputManager;
 class RunningSchedule;
 class PlayListStep;
 class OutputProcess;
+class OutputProcessingPlan;
+class OutputThread;
 class XyzzyBase;
 class PlayListItem;
 class xScheduleFrame;
@@ -38,6 +40,7 @@ public:
     PixelData(size_t startChannel, size_t channels, const wxColor& c, APPLYMETHOD blendMode);
     virtual ~PixelData();
     void Set(uint8_t* buffer, size_t size);
+    void AddTo(BlendCompositor& compositor);
     void SetColor(const wxColor& c, APPLYMETHOD blendMode);
     void SetData(const wxString& data, APPLYMETHOD blendMode);
     long GetSize() const { return _size; }
@@ -77,6 +80,7 @@ class ScheduleManager
     std::list<PlayList*> _eventPlayLists;
     int _overrideMS = 0;
     std::list<PixelData*> _overlayData;
+    BlendCompositor _overlayCompositor;
     CommandManager _commandManager;
     PlayList* _queuedSongs = nullptr;
     std::list<RunningSchedule*> _activeSchedules;
@@ -96,11 +100,18 @@ class ScheduleManager
     bool _webRequestToggle;
     Pinger* _pinger = nullptr;
     std::unique_ptr<SyncManager> _syncManager = nullptr;
+    std::unique_ptr<OutputProcessingPlan> _outputProcessingPlan = nullptr;
+    int _outputProcessingPlanChangeCount = -1;
+    std::unique_ptr<OutputThread> _outputThread = nullptr;
 
     void DisableRemoteOutputs();
     std::string GetPingStatus();
     std::string FormatTime(size_t timems);
     void CreateBrightnessArray();
+    void ApplyOutputProcessing(size_t totalChannels, bool applyBrightness);
+    void ApplyOverlays(size_t totalChannels);
+    void SendFrame(long msec, size_t totalChannels, bool allOff);
+    void StopOutput();
     void ManageBackground();
     bool DoText(PlayListItemText* pliText, const wxString& text, const wxString& properties);
     void StartVirtualMatrices();
@@ -129,6 +140,9 @@ class ScheduleManager
         int GetTimerAdjustment() const { return _timerAdjustment; }
         std::string GetOurIP() const;
         void SetTimerAdjustment(int timerAdjustment) { _timerAdjustment = timerAdjustment; }
+        void StartFrameClock(int frameMS);
+        void StopFrameClock();
+        int GetFrameClockInterval() const;
         PlayList* GetPlayList(int  id) const;
         PlayList* GetBackgroundPlayList() const { return _backgroundPlayList; }
         std::list<PlayList*> GetEventPlayLists() const { return _eventPlayLists; }
@@ -42,6 +42,7 @@ ScheduleOptions::ScheduleOptions(OutputManager* outputManager, wxXmlNode* node,
     _webAPIOnly = node->GetAttribute("APIOnly", "FALSE") == "TRUE";
     _sendOffWhenNotRunning = node->GetAttribute("SendOffWhenNotRunning", "FALSE") == "TRUE";
     _parallelTransmission = node->GetAttribute("ParallelTransmission", "FALSE") == "TRUE";
+    _pacedTransmission = node->GetAttribute("PacedTransmission", "FALSE") == "TRUE";
     _remoteAllOff = node->GetAttribute("RemoteSustain", "FALSE") == "FALSE";
     _retryOutputOpen = node->GetAttribute("RetryOutputOpen", "FALSE") == "TRUE";
     _suppressAudioOnRemotes = node->GetAttribute("SuppressAudioOnRemotes", "TRUE") == "TRUE";
@@ -202,6 +203,7 @@ ScheduleOptions::ScheduleOptions()
     _sync = false;
     _sendOffWhenNotRunning = false;
     _parallelTransmission = false;
+    _pacedTransmission = false;
     _remoteAllOff = true;
     _retryOutputOpen = false;
     _suppressAudioOnRemotes = true;
@@ -286,6 +288,11 @@ wxXmlNode* ScheduleOptions::Save()
         res->AddAttribute("ParallelTransmission", "TRUE");
     }
 
+    if (IsPacedTransmission())
+    {
+        res->AddAttribute("PacedTransmission", "TRUE");
+    }
+
     if (!IsRemoteAllOff())
     {
         res->AddAttribute("RemoteSustain", "TRUE");
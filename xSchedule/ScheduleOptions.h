@@ -183,6 +183,7 @@ class ScheduleOptions
     size_t _MIDITimecodeOffset;
     std::list<ExtraIP*> _extraIPs;
     bool _parallelTransmission;
+    bool _pacedTransmission;
     bool _remoteAllOff;
     bool _retryOutputOpen;
     bool _suppressAudioOnRemotes;
@@ -213,6 +214,7 @@ class ScheduleOptions
         void SetMIDITimecodeOffset(size_t offset) { if (offset != _MIDITimecodeOffset) { _MIDITimecodeOffset = offset; _changeCount++; } }
         void SetAdvancedMode(bool advancedMode) { if (_advancedMode != advancedMode) { _advancedMode = advancedMode; _changeCount++; } }
         void SetParallelTransmission(bool parallel) { if (_parallelTransmission != parallel) { _parallelTransmission = parallel; _changeCount++; } }
+        void SetPacedTransmission(bool paced) { if (_pacedTransmission != paced) { _pacedTransmission = paced; _changeCount++; } }
         void SetRemoteAllOff(bool remoteAllOff) { if (_remoteAllOff != remoteAllOff) { _remoteAllOff = remoteAllOff; _changeCount++; } }
         void SetRetryOutputOpen(bool retryOpen) { if (_retryOutputOpen != retryOpen) { _retryOutputOpen = retryOpen; _changeCount++; } }
         void SetSuppressAudioOnRemotes(bool suppressAudio) { if (_suppressAudioOnRemotes != suppressAudio) { _suppressAudioOnRemotes = suppressAudio; _changeCount++; } }
@@ -220,6 +222,7 @@ class ScheduleOptions
         void SetSendOffWhenNotRunning(bool send) { if (_sendOffWhenNotRunning != send) { _sendOffWhenNotRunning = send; _changeCount++; } }
         bool IsSendOffWhenNotRunning() const { return _sendOffWhenNotRunning; }
         bool IsParallelTransmission() const { return _parallelTransmission; }
+        bool IsPacedTransmission() const { return _pacedTransmission; }
         bool IsRemoteAllOff() const { return _remoteAllOff; }
         bool IsRetryOpen() const { return _retryOutputOpen; }
         bool IsSuppressAudioOnRemotes() const { return _suppressAudioOnRemotes; }
@@ -19,285 +19,362 @@
 #include <wx/base64.h>
 #include <wx/filename.h>
 
-HttpConnection::HttpConnection(HttpServer *server, wxSocketBase *socket) :
+#include <log4cpp/Category.hh>
+
+// anything bigger than this is not a request we want
+#define HTTP_MAX_HEADER  (64 * 1024)
+#define HTTP_MAX_CONTENT (64 * 1024 * 1024)
+
+// returns the value of the header or an empty string ... header names are not case sensitive
+static std::string GetHeaderValue(const std::string &header, const std::string &key)
+{
+	size_t pos = 0;
+	while (pos < header.size())
+	{
+		size_t end = header.find('\n', pos);
+		if (end == std::string::npos) end = header.size();
+
+		if (end - pos > key.size() && header[pos + key.size()] == ':' &&
+			wxString(header.substr(pos, key.size())).CmpNoCase(key) == 0)
+		{
+			wxString value(header.substr(pos + key.size() + 1, end - pos - key.size() - 1));
+			return value.Trim(true).Trim(false).ToStdString();
+		}
+
+		pos = end + 1;
+	}
+
+	return "";
+}
+
+static std::string MakeFrame(WebSocketMessage::Opcode type, const void *data, size_t length)
+{
+	std::string frame;
+
+	frame += (char)(0x80 | type); // final + type
+
+	if (length > 0xFFFF)
+	{
+		frame += (char)127;
+		for (int i = 7; i >= 0; i--)
+		{
+			frame += (char)(((wxUint64)length >> (i * 8)) & 0xFF);
+		}
+	}
+	else if (length > 125)
+	{
+		frame += (char)126;
+		frame += (char)((length >> 8) & 0xFF);
+		frame += (char)(length & 0xFF);
+	}
+	else
+	{
+		frame += (char)length;
+	}
+
+	frame.append((const char *)data, length);
+
+	return frame;
+}
+
+HttpConnection::HttpConnection(HttpServer *server, HttpSocket socket, const IPaddress &address) :
 	_server(server),
 	_socket(socket),
+	_address(address),
 	_isWebSocket(false),
-	_message(NULL)
+	_open(true),
+	_outputPos(0),
+	_closeWhenSent(false),
+	_pollWrite(false),
+	_messageType(WebSocketMessage::Text)
 {
-	if (!_socket->GetPeer(_address))
-		wxLogMessage(_("accepted a new connection from <unknown> (socket %d)"), socket->GetSocket());
-	else
-		wxLogMessage(_("accepted a new connection from %s:%u (socket %d)"), _address.IPAddress(), _address.Service(), socket->GetSocket());
 }
 
 HttpConnection::~HttpConnection()
 {
-	wxLogMessage(_("connection closed (socket %d)"), _socket->GetSocket());
 }
 
-bool HttpConnection::HandleRequest()
+bool HttpConnection::HandleRequest(const wxString &input)
 {
-	_socket->SetFlags(wxSOCKET_NOWAIT);
-
-	wxMemoryBuffer input;
-	char           buffer[1024];
+	HttpRequest request(*this, input);
 
-	do
+	if (request.Method() == "GET")
 	{
-		_socket->Read(buffer, sizeof(buffer));
-		input.AppendData(buffer, _socket->LastReadCount());
-	} while (_socket->LastReadCount() > 0);
+		if (_server->_context.RequestHandler)
+		{
+			if (_server->_context.RequestHandler(*this, request))
+				return true;
+		}
 
-	if (_isWebSocket)
-	{
-		return ParseFrame(input);
-	}
-	else
-	{
-		HttpRequest request(*this, wxString((char *)input.GetData(), input.GetDataLen()));
+		wxString fileName(_server->_context.DefaultDirectory);
+		fileName += wxFILE_SEP_PATH;
 
-		if (request.Method() == "GET")
+		if (request.URI() == "/")
 		{
-			if (request["Upgrade"].CmpNoCase("websocket") == 0)
+			for (size_t i = 0; i < _server->_context.DefaultDocuments.Count(); i++)
 			{
-				if (!request["Host"].IsEmpty() && !request["Connection"].IsEmpty() &&
-					!request["Sec-WebSocket-Key"].IsEmpty() && !request["Sec-WebSocket-Version"].IsEmpty())
-					return WebSocketHandshake(request);
-				else
-                {
-                    HttpResponse hr(*this, request, HttpStatus::BadRequest);
-					return SendResponse(hr);
-                }
-			}
-			else
-			{
-				if (_server->_context.RequestHandler)
+				if (wxFileName::FileExists(fileName + _server->_context.DefaultDocuments[i]))
 				{
-					if (_server->_context.RequestHandler(*this, request))
-						return true;
+					fileName += _server->_context.DefaultDocuments[i];
+					break;
 				}
-
-				wxString fileName(_server->_context.DefaultDirectory);
-				fileName += wxFILE_SEP_PATH;
-
-				if (request.URI() == "/")
-				{
-					for (size_t i = 0; i < _server->_context.DefaultDocuments.Count(); i++)
-					{
-						if (wxFileName::FileExists(fileName + _server->_context.DefaultDocuments[i]))
-						{
-							fileName += _server->_context.DefaultDocuments[i];
-							break;
-						}
-					}
-				}
-				else
-					fileName += request.URI().Mid(1);
-
-				HttpResponse response(*this, request, fileName);
-
-				return SendResponse(response);
 			}
 		}
 		else
+			fileName += request.URI().Mid(1);
+
+		HttpResponse response(*this, request, fileName);
+
+		return SendResponse(response);
+	}
+	else
+	{
+		// all others requests are routed to custom implementations
+		if (_server->_context.RequestHandler)
 		{
-			// all others requests are routed to custom implementations
-			if (_server->_context.RequestHandler)
-			{
-				if (_server->_context.RequestHandler(*this, request))
-					return true;
-			}
+			if (_server->_context.RequestHandler(*this, request))
+				return true;
 		}
 	}
 
 	return false;
 }
 
+void HttpConnection::HandleMessage(WebSocketMessage::Opcode type, const std::string &content)
+{
+	if (!_server->_context.MessageHandler) return;
+
+	WebSocketMessage message(type);
+	message._content.AppendData(content.data(), content.size());
+
+	_server->_context.MessageHandler(*this, message);
+}
+
 bool HttpConnection::SendResponse(HttpResponse &response)
 {
-    _socket->SetFlags(wxSOCKET_WAITALL);
+	std::string data;
+
 	wxString row = wxString::Format("%s %d %s\r\n", response.Version(), response.Status().Code(), response.Status().Description());
-	_socket->Write(row.ToAscii(), row.Length());
-    if (_socket->Error()) {
-        _socket->SetFlags(wxSOCKET_NOWAIT);
-        return false;
-    }
+	data += row.ToAscii().data();
 
 	for (size_t i = 0; i < response.Headers().Count(); i++)
 	{
 		wxString header = response[i];
-		_socket->Write(header.ToAscii(), header.Length());
-        if (_socket->Error()) {
-            _socket->SetFlags(wxSOCKET_NOWAIT);
-            return false;
-        }
+		data += header.ToAscii().data();
 	}
 
-	_socket->Write("\r\n", 2);
-    if (_socket->Error()) {
-        _socket->SetFlags(wxSOCKET_NOWAIT);
-        return false;
-    }
-    
+	data += "\r\n";
+
 	if (!response._content.IsEmpty())
+		data.append((const char *)response._content.GetData(), response._content.GetDataLen());
+
+	Send(std::move(data), response["Connection"].CmpNoCase("close") == 0);
+
+	return IsOpen();
+}
+
+bool HttpConnection::SendMessage(WebSocketMessage &message)
+{
+	Send(MakeFrame(message._type, message._content.GetData(), message._content.GetDataLen()), false);
+
+	return IsOpen();
+}
+
+bool HttpConnection::Close()
+{
+	if (!IsOpen()) return false;
+
+	// the socket is closed once anything already sent has gone
+	Send("", true);
+
+	return true;
+}
+
+void HttpConnection::Send(std::string &&data, bool close)
+{
+	if (!IsOpen()) return;
+
+	_server->QueueOutput({ shared_from_this(), std::move(data), close });
+}
+
+bool HttpConnection::ParseInput()
+{
+	bool more = true;
+
+	while (more && IsOpen())
 	{
-		_socket->Write(response._content.GetData(), response._content.GetDataLen());
-        if (_socket->Error()) {
-            _socket->SetFlags(wxSOCKET_NOWAIT);
-            return false;
-        }
+		if (_isWebSocket)
+		{
+			if (!ParseFrame(more)) return false;
+		}
+		else
+		{
+			if (!ParseRequest(more)) return false;
+		}
 	}
 
-    _socket->SetFlags(wxSOCKET_NOWAIT);
 	return true;
 }
 
-bool HttpConnection::SendMessage(WebSocketMessage &message)
+bool HttpConnection::ParseRequest(bool &more)
 {
-    // As we are just writing dont set it to wait
-    //_socket->SetFlags(wxSOCKET_WAITALL);
-	wxMemoryBuffer header;
+	static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-	header.AppendByte((wxUint8)0x80 | message._type); // final + type
+	more = false;
 
-	if (message._content.GetDataLen() > 0xFFFF)
+	// some simple clients only send \n so accept either
+	size_t end = _input.find("\r\n\r\n");
+	size_t separator = 4;
+	size_t end2 = _input.find("\n\n");
+	if (end2 != std::string::npos && (end == std::string::npos || end2 < end))
 	{
-		wxUint64 tmp = message._content.GetDataLen();
-		header.AppendByte(127);
-		for (int i = 7; i >= 0; i--)
+		end = end2;
+		separator = 2;
+	}
+
+	if (end == std::string::npos)
+	{
+		if (_input.size() > HTTP_MAX_HEADER)
 		{
-			header.AppendByte((wxUint8)(tmp & 0x0FF));
-			tmp = tmp / 0x100;
+			logger_base.warn("Web request from %s headers too long ... closing connection.", (const char *)_address.IPAddress().c_str());
+			return false;
 		}
+		return true;
 	}
-	else if (message._content.GetDataLen() > 125)
+
+	std::string header = _input.substr(0, end);
+
+	size_t length = wxAtol(GetHeaderValue(header, "Content-Length"));
+	if (length > HTTP_MAX_CONTENT)
 	{
-		header.AppendByte(126);
-		header.AppendByte((wxUint8)((message._content.GetDataLen() & 0xFF00) / 0x100));
-		header.AppendByte((wxUint8)(message._content.GetDataLen() & 0xFF));
+		logger_base.warn("Web request from %s too large %lu ... closing connection.", (const char *)_address.IPAddress().c_str(), (unsigned long)length);
+		return false;
 	}
-	else
+
+	// wait for the rest of it
+	size_t total = end + separator + length;
+	if (_input.size() < total) return true;
+
+	std::string input = _input.substr(0, total);
+	_input.erase(0, total);
+	more = !_input.empty();
+
+	if (header.compare(0, 4, "GET ") == 0 && wxString(GetHeaderValue(header, "Upgrade")).CmpNoCase("websocket") == 0)
 	{
-		header.AppendByte((wxUint8) message._content.GetDataLen());
-	}
+		// this is all done here so there is no gap where a frame could be read as a request
+		HttpRequest request(*this, wxString(input.c_str(), input.size()));
 
-	_socket->Write(header.GetData(), header.GetDataLen());
-    if (_socket->Error())
-    {
-        _socket->SetFlags(wxSOCKET_NOWAIT);
-        return false;
-    }
+		if (!request["Host"].IsEmpty() && !request["Connection"].IsEmpty() &&
+			!request["Sec-WebSocket-Key"].IsEmpty() && !request["Sec-WebSocket-Version"].IsEmpty())
+			return WebSocketHandshake(request);
 
-	if (!message._content.IsEmpty())
-		_socket->Write(message._content.GetData(), message._content.GetDataLen());
+		HttpResponse hr(*this, request, HttpStatus::BadRequest);
+		SendResponse(hr);
+		return true;
+	}
+
+	_server->QueueWork({ HttpWork::Request, shared_from_this(), 0, std::move(input) });
 
-    _socket->SetFlags(wxSOCKET_NOWAIT);
-    return !_socket->Error();
+	return true;
 }
 
-bool HttpConnection::Close()
+bool HttpConnection::ParseFrame(bool &more)
 {
-	wxASSERT(_socket);
+	more = false;
 
-	bool result = _socket->Close();
-	_socket = NULL;
+	if (_input.size() < 2)
+		return true;
 
-	return result;
-}
+	const wxUint8 *buffer = (const wxUint8 *)_input.data();
 
-bool HttpConnection::ParseFrame(wxMemoryBuffer &buffer)
-{
-	if (buffer.GetDataLen() < 2)
+	if ((buffer[0] & 0x70) != 0)
+	{
+		wxLogWarning("reserved bits must be 0");
+		return false; // Invalid ws message
+	}
+
+	bool final = (buffer[0] & 0x80) != 0;
+	WebSocketMessage::Opcode type = (WebSocketMessage::Opcode)(buffer[0] & 0x0F);
+
+	wxUint64 length = buffer[1] & 0x7F;
+	size_t   start = 2;
+
+	if (length == 126)
+	{
+		if (_input.size() < 4) return true;
+		length = (((wxUint64)buffer[2]) << 8) + buffer[3];
+		start = 4;
+	}
+	else if (length == 127)
+	{
+		if (_input.size() < 10) return true;
+		length = 0;
+		for (int i = 0; i < 8; i++)
+			length = (length << 8) + buffer[2 + i];
+		start = 10;
+	}
+
+	if (length > HTTP_MAX_CONTENT)
+	{
+		wxLogWarning("web socket message too large");
 		return false;
+	}
+
+	wxUint8 mask[4] = { 0 };
+	bool masked = (buffer[1] & 0x80) != 0;
+	if (masked)
+	{
+		if (_input.size() < start + 4) return true;
+		memcpy(mask, buffer + start, 4);
+		start += 4;
+	}
 
-    bool done = false;
-    int pos = 0;
-
-    while (!done)
-    {
-        bool final = buffer[pos + 0] & 0x80 ? true : false;
-
-        if (((buffer[pos + 0] & 0x40) != 0) || ((buffer[pos + 0] & 0x20) != 0) || ((buffer[pos + 0] & 0x10) != 0))
-        {
-            wxLogWarning("reserved bits must be 0");
-            return false; // Invalid ws message
-        }
-
-        WebSocketMessage::Opcode type = (WebSocketMessage::Opcode)(buffer[pos + 0] & 0x0F);
-
-        if (!_message)
-            _message = new WebSocketMessage(type);
-
-        //ws_conn->close  = ((buffer[0] & 0x0F) == 0x08);
-        //ws_conn->ping   = ((buffer[0] & 0x0F) == 0x09);
-        //ws_conn->pong   = ((buffer[0] & 0x0F) == 0x0A);
-
-        if (type == WebSocketMessage::Ping)
-            wxLogMessage("received a PING message");
-
-        if (type == WebSocketMessage::Pong)
-            wxLogMessage("received a PONG message");
-
-        int length = buffer[pos + 1] & 0x7F;
-        int     start = 2;
-        wxUint8 mask[4] = { 0 };
-
-        if (length == 126)
-        {
-            length = ((((int)buffer[pos + 2]) << 8) + buffer[pos + 3]);
-            start = 4;
-        }
-        else if (length == 127)
-        {
-            length = 0;
-            for (int i = 0; i < 8; i++)
-                length = (wxUint64)length * 0x100 + buffer[pos + 2 + i];
-            start = 10;
-        }
-
-        if (buffer[pos + 1] & 128)
-        {
-            memcpy(mask, &(buffer[pos + start]), 4);
-            start += 4;
-        }
-
-        for (int i = 0; i < length; i++)
-            _message->_content.AppendByte(buffer[pos + start + i] ^ mask[i % 4]);
-
-        if (final && _server->_context.MessageHandler)
-        {
-            _server->_context.MessageHandler(*this, *_message);
-
-            switch (_message->_type)
-            {
-            case WebSocketMessage::Ping:
-            {
-                WebSocketMessage wsm(WebSocketMessage::Pong);
-                SendMessage(wsm);
-            }
-            break;
-            case WebSocketMessage::Close:
-            {
-                WebSocketMessage wsm(WebSocketMessage::Close);
-                SendMessage(wsm);
-            }
-            break;
-            default:
-            break;
-            }
-
-            delete _message;
-            _message = nullptr;
-        }
-
-        pos += start + length;
-
-        if (pos >= buffer.GetDataLen())
-        {
-            done = true;
-        }
-    }
+	// wait for the rest of the frame
+	if (_input.size() < start + length) return true;
+
+	std::string content = _input.substr(start, (size_t)length);
+	_input.erase(0, start + (size_t)length);
+	more = !_input.empty();
+
+	if (masked)
+	{
+		for (size_t i = 0; i < content.size(); i++)
+			content[i] ^= mask[i % 4];
+	}
+
+	switch (type)
+	{
+	case WebSocketMessage::Ping:
+		Send(MakeFrame(WebSocketMessage::Pong, content.data(), content.size()), false);
+		break;
+	case WebSocketMessage::Pong:
+		break;
+	case WebSocketMessage::Close:
+		Send(MakeFrame(WebSocketMessage::Close, nullptr, 0), true);
+		more = false;
+		break;
+	default:
+		// control frames can arrive in the middle of a fragmented message so only a new message resets it
+		if (type != WebSocketMessage::Continuation)
+		{
+			_messageType = type;
+			_message.clear();
+		}
+
+		_message += content;
+		if (_message.size() > HTTP_MAX_CONTENT)
+		{
+			wxLogWarning("web socket message too large");
+			return false;
+		}
+
+		if (final)
+		{
+			_server->QueueWork({ HttpWork::Message, shared_from_this(), (int)_messageType, std::move(_message) });
+			_message.clear();
+		}
+		break;
+	}
 
 	return true;
 }
@@ -307,10 +384,10 @@ bool HttpConnection::WebSocketHandshake(HttpRequest &request)
 	static const char *magic = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
 	if (request["Sec-WebSocket-Version"] != "13")
-    {
-        HttpResponse hr(*this, request, HttpStatus::UpgradeRequired);
+	{
+		HttpResponse hr(*this, request, HttpStatus::UpgradeRequired);
 		return SendResponse(hr);
-    }
+	}
 
 	wxString handshake = wxString::Format("%s%s", request["Sec-WebSocket-Key"], magic);
 
@@ -13,224 +13,643 @@
 // Amazon Gift Cards - E-mail Delivery https://www.amazon.it/gp/product/B005VG4G3U/gcrnsts
 
 #include "wxhttpserver.h"
+
+#include <wx/thread.h>
+
+// This must be below the wx includes
+#ifdef __WXMSW__
+#include <winsock2.h>
+#include <Ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#endif
+
+#ifdef __LINUX__
+#include <sys/epoll.h>
+#endif
+
 #include <log4cpp/Category.hh>
 
-//#define DETAILED_LOGGING
+#include <cstring>
+#include <vector>
 
-#define SERVER_ID	100
-#define SOCKET_ID	101
+//#define DETAILED_LOGGING
 
 #include <wx/arrimpl.cpp>
 //WX_DEFINE_EXPORTED_OBJARRAY(HeadersCollection);
 WX_DEFINE_OBJARRAY(HeadersCollection)
 
-BEGIN_EVENT_TABLE(HttpServer, wxEvtHandler)
-	EVT_SOCKET(SERVER_ID, HttpServer::OnServerEvent)
-	EVT_SOCKET(SOCKET_ID, HttpServer::OnSocketEvent)
-END_EVENT_TABLE()
+#ifdef __WXMSW__
+#define SOCKETOF(s) ((SOCKET)(s))
+#define HTTP_CLOSESOCKET(s) closesocket(SOCKETOF(s))
+#define HTTP_WOULDBLOCK() (WSAGetLastError() == WSAEWOULDBLOCK)
+#define HTTP_INTERRUPTED() (WSAGetLastError() == WSAEINTR)
+#define HTTP_ISVALID(s) ((s) != INVALID_SOCKET)
+#define HTTP_POLL(fds, count) WSAPoll(fds, (ULONG)(count), -1)
+typedef WSAPOLLFD HttpPollFD;
+#else
+#define SOCKETOF(s) ((int)(s))
+#define HTTP_CLOSESOCKET(s) close(SOCKETOF(s))
+#define HTTP_WOULDBLOCK() (errno == EAGAIN || errno == EWOULDBLOCK)
+#define HTTP_INTERRUPTED() (errno == EINTR)
+#define HTTP_ISVALID(s) ((s) >= 0)
+#define HTTP_POLL(fds, count) poll(fds, (nfds_t)(count), -1)
+typedef pollfd HttpPollFD;
+#endif
 
-HttpServer::HttpServer() :
-	_server(NULL)
+// dont let a client that goes away kill us with SIGPIPE
+#ifdef MSG_NOSIGNAL
+#define HTTP_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define HTTP_SEND_FLAGS 0
+#endif
+
+#define HTTP_MAX_EVENTS 64
+
+static bool SetNonBlocking(HttpSocket socket)
 {
+#ifdef __WXMSW__
+	u_long mode = 1;
+	return ioctlsocket(SOCKETOF(socket), FIONBIO, &mode) == 0;
+#else
+	int flags = fcntl(SOCKETOF(socket), F_GETFL, 0);
+	return flags != -1 && fcntl(SOCKETOF(socket), F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
 }
 
-HttpServer::~HttpServer()
+static HttpSocket CreateListenSocket(int port)
 {
-    Stop();
+	auto s = socket(AF_INET, SOCK_STREAM, 0);
+	if (!HTTP_ISVALID(s)) return HTTP_INVALID_SOCKET;
+
+#ifndef __WXMSW__
+	// on windows this would let someone else steal the port
+	int one = 1;
+	setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char *)&one, sizeof(one));
+#endif
+
+	sockaddr_in addr;
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons((unsigned short)port);
+
+	if (bind(s, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(s, SOMAXCONN) != 0 || !SetNonBlocking((HttpSocket)s))
+	{
+		HTTP_CLOSESOCKET(s);
+		return HTTP_INVALID_SOCKET;
+	}
+
+	return (HttpSocket)s;
 }
 
-bool HttpServer::Start(const HttpContext &context)
+// a udp socket talking to itself ... sending to it wakes the network thread up
+static HttpSocket CreateWakeSocket()
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    wxASSERT(!_server || (_server && _server->IsClosed()));
+	auto s = socket(AF_INET, SOCK_DGRAM, 0);
+	if (!HTTP_ISVALID(s)) return HTTP_INVALID_SOCKET;
+
+	sockaddr_in addr;
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+	socklen_t len = sizeof(addr);
+
+	if (bind(s, (sockaddr *)&addr, sizeof(addr)) != 0 ||
+		getsockname(s, (sockaddr *)&addr, &len) != 0 ||
+		connect(s, (sockaddr *)&addr, len) != 0 ||
+		!SetNonBlocking((HttpSocket)s))
+	{
+		HTTP_CLOSESOCKET(s);
+		return HTTP_INVALID_SOCKET;
+	}
 
-	if (_server && _server->IsConnected())
-		Stop();
+	return (HttpSocket)s;
+}
 
-	_context = context;
+// Waits for activity on a set of sockets ... epoll on linux and poll everywhere else
+class HttpPoller
+{
+public:
+	struct Event
+	{
+		HttpSocket socket;
+		bool       read;
+		bool       write;
+		bool       error;
+	};
+
+#ifdef __LINUX__
+	HttpPoller() { _epoll = epoll_create1(EPOLL_CLOEXEC); }
+	~HttpPoller() { if (_epoll >= 0) close(_epoll); }
+
+	bool IsOk() const { return _epoll >= 0; }
+	void Add(HttpSocket socket, bool write) { Control(EPOLL_CTL_ADD, socket, write); }
+	void Modify(HttpSocket socket, bool write) { Control(EPOLL_CTL_MOD, socket, write); }
+	void Remove(HttpSocket socket) { epoll_ctl(_epoll, EPOLL_CTL_DEL, SOCKETOF(socket), nullptr); }
+
+	// false if waiting failed
+	bool Wait(std::vector<Event> &events)
+	{
+		epoll_event ev[HTTP_MAX_EVENTS];
+		int count = epoll_wait(_epoll, ev, HTTP_MAX_EVENTS, -1);
+		if (count < 0) return HTTP_INTERRUPTED();
 
-	// Create the address - defaults to localhost:0 initially
-	_address.Service(_context.Port);
+		for (int i = 0; i < count; i++)
+		{
+			events.push_back({ (HttpSocket)ev[i].data.fd,
+				(ev[i].events & EPOLLIN) != 0,
+				(ev[i].events & EPOLLOUT) != 0,
+				(ev[i].events & (EPOLLERR | EPOLLHUP)) != 0 });
+		}
+		return true;
+	}
 
-	wxLogMessage(_("starting server on %s:%u..."), _address.IPAddress(), _address.Service());
-    logger_base.info("starting server on %s:%u...", (const char *)_address.IPAddress().c_str(), _address.Service());
+private:
+	void Control(int op, HttpSocket socket, bool write)
+	{
+		epoll_event ev;
+		memset(&ev, 0x00, sizeof(ev));
+		ev.events = EPOLLIN | (write ? EPOLLOUT : 0);
+		ev.data.fd = SOCKETOF(socket);
+		epoll_ctl(_epoll, op, SOCKETOF(socket), &ev);
+	}
 
-	// Create the socket
-	_server = new wxSocketServer(_address, wxSOCKET_REUSEADDR);
+	int _epoll;
+#else
+	bool IsOk() const { return true; }
 
-	// We use IsOk() here to see if the server is really listening
-    if (!_server->IsOk())
-    {
-        wxLogError(_("unable to start the server on the specified port"));
-        logger_base.error(_("unable to start the server on the specified port"));
-    }
-	else
+	void Add(HttpSocket socket, bool write)
 	{
-		IPaddress address;
-        if (!_server->GetLocal(address))
-        {
-            wxLogError(_("unable to retrieve the address to which you are connected"));
-            logger_base.error(_("unable to retrieve the address to which you are connected"));
-        }
-        else
-        {
-            wxLogMessage(_("server running on %s:%u"), address.IPAddress(), address.Service());
-            logger_base.info("server running on %s:%u", (const char *)address.IPAddress().c_str(), address.Service());
-        }
+		HttpPollFD fd;
+		memset(&fd, 0x00, sizeof(fd));
+		fd.fd = SOCKETOF(socket);
+		fd.events = POLLIN | (write ? POLLOUT : 0);
+		_fds.push_back(fd);
+	}
 
-		// Setup the event handler and subscribe to connection events
-		_server->SetEventHandler(*this, SERVER_ID);
-		_server->SetNotify(wxSOCKET_CONNECTION_FLAG);
-		_server->Notify(true);
+	void Modify(HttpSocket socket, bool write)
+	{
+		for (auto &it : _fds)
+		{
+			if (it.fd == SOCKETOF(socket))
+			{
+				it.events = POLLIN | (write ? POLLOUT : 0);
+				break;
+			}
+		}
 	}
 
-	return _server->IsOk();
-}
+	void Remove(HttpSocket socket)
+	{
+		for (auto it = _fds.begin(); it != _fds.end(); ++it)
+		{
+			if (it->fd == SOCKETOF(socket))
+			{
+				_fds.erase(it);
+				break;
+			}
+		}
+	}
 
-bool HttpServer::Stop()
-{
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    
-    if (!_server) return false;
+	// false if waiting failed
+	bool Wait(std::vector<Event> &events)
+	{
+		int count = HTTP_POLL(_fds.data(), _fds.size());
+		if (count < 0) return HTTP_INTERRUPTED();
 
-    // close all open connections
-    for (auto it = _connections.begin(); it != _connections.end(); ++it)
-    {
-        it->second->Close();
-    }
+		for (const auto &it : _fds)
+		{
+			if (it.revents != 0)
+			{
+				events.push_back({ (HttpSocket)it.fd,
+					(it.revents & POLLIN) != 0,
+					(it.revents & POLLOUT) != 0,
+					(it.revents & (POLLERR | POLLHUP | POLLNVAL)) != 0 });
+			}
+		}
+		return true;
+	}
 
-    _server->Notify(false);
-	_server->Close();
-	delete _server;
-    _server = nullptr;
+private:
+	std::vector<HttpPollFD> _fds;
+#endif
+};
 
-	wxLogMessage(_("closed server on %s:%u"), _address.IPAddress(), _address.Service());
-    logger_base.debug("closed server on %s:%u", (const char*)_address.IPAddress().c_str(), _address.Service());
+// Does all the socket work for the server
+class HttpServerThread : public wxThread
+{
+public:
+	HttpServerThread(HttpServer *server) :
+		wxThread(wxTHREAD_JOINABLE),
+		_server(server),
+		_stop(false)
+	{
+	}
 
-	return true;
-}
+	bool IsOk() const { return _poller.IsOk(); }
+
+	void Stop()
+	{
+		_stop = true;
+		_server->Wake();
+	}
 
-void HttpServer::OnServerEvent(wxSocketEvent& event)
+private:
+	void Accept();
+	void DrainWake();
+	void ProcessOutput();
+	void Update(std::shared_ptr<HttpConnection> connection);
+	void CloseConnection(std::shared_ptr<HttpConnection> connection);
+	virtual ExitCode Entry() override;
+
+	HttpServer                                            *_server;
+	HttpPoller                                             _poller;
+	std::map<HttpSocket, std::shared_ptr<HttpConnection>>  _connections;
+	std::atomic<bool>                                      _stop;
+};
+
+void HttpServerThread::Accept()
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    wxStopWatch sw;
+	for (;;)
+	{
+		sockaddr_in addr;
+		socklen_t len = sizeof(addr);
+		auto s = accept(SOCKETOF(_server->_listen), (sockaddr *)&addr, &len);
+		if (!HTTP_ISVALID(s))
+		{
+			if (HTTP_INTERRUPTED()) continue;
+			break; // nothing more waiting
+		}
 
-    switch (event.GetSocketEvent())
-    {
-    case wxSOCKET_CONNECTION:
-#ifdef DETAILED_LOGGING
-        logger_base.info("OnServerEvent: wxSOCKET_CONNECTION");
-#endif
-        break;
-    default:
-#ifdef DETAILED_LOGGING
-        logger_base.info("OnServerEvent: unexpected event %d", event.GetSocketEvent());
+		HttpSocket socket = (HttpSocket)s;
+		SetNonBlocking(socket);
+
+		// responses are written in one go so there is nothing to gain waiting for more
+		int one = 1;
+		setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char *)&one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+		setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, (const char *)&one, sizeof(one));
 #endif
-        break;
-    }
 
-    // Accept new connection if there is one in the pending connections queue, else exit. We use Accept(false) for
-    // non-blocking accept (although if we got here, there should ALWAYS be a pending connection).
-    wxSocketBase *socket = _server->Accept(false);
+		char ip[INET_ADDRSTRLEN] = "";
+		inet_ntop(AF_INET, &addr.sin_addr, ip, sizeof(ip));
+		IPaddress address;
+		address.Hostname(ip);
+		address.Service(ntohs(addr.sin_port));
 
-    if (socket)
-    {
 #ifdef DETAILED_LOGGING
-        logger_base.info("created socket client (socket %d)", socket->GetSocket());
+		static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+		logger_base.info("accepted a new connection from %s:%u (socket %d)", ip, (unsigned int)ntohs(addr.sin_port), (int)s);
 #endif
 
-        HttpConnection *connection = nullptr;
+		auto connection = std::make_shared<HttpConnection>(_server, socket, address);
+		_connections[socket] = connection;
+		_poller.Add(socket, false);
+		_server->QueueWork({ HttpWork::Connected, connection, 0, "" });
+	}
+}
+
+void HttpServerThread::DrainWake()
+{
+	char buffer[64];
+	while (recv(SOCKETOF(_server->_wake), buffer, sizeof(buffer), 0) > 0);
+}
 
-        if (event.GetSocketEvent() == wxSOCKET_CONNECTION)
-        {
-            connection = new HttpConnection(this, socket);
-            _connections[socket] = connection;
-        }
-        else
-            connection = _connections[socket];
+void HttpServerThread::ProcessOutput()
+{
+	for (auto &it : _server->_output.PopAll())
+	{
+		auto connection = it.connection;
 
-        wxASSERT(connection != nullptr);
+		// it closed before the main thread got to it
+		if (connection->_socket == HTTP_INVALID_SOCKET) continue;
 
-        socket->SetEventHandler(*this, SOCKET_ID);
-        socket->SetNotify(wxSOCKET_INPUT_FLAG | wxSOCKET_LOST_FLAG);
-        socket->Notify(true);
-    }
-    else
-    {
-#ifdef DETAILED_LOGGING
-        logger_base.info("error, impossible to accept a new connection");
-#endif
-    }
+		connection->_output += it.data;
+		if (it.close) connection->_closeWhenSent = true;
 
-#ifdef DETAILED_LOGGING
-    logger_base.info("OnServerEvent Time %ld.", sw.Time());
-#endif
+		if (connection->Write())
+			Update(connection);
+		else
+			CloseConnection(connection);
+	}
 }
 
-void HttpServer::OnSocketEvent(wxSocketEvent& event)
+void HttpServerThread::Update(std::shared_ptr<HttpConnection> connection)
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    wxStopWatch sw;
+	bool pending = connection->_outputPos < connection->_output.size();
 
-	switch(event.GetSocketEvent())
+	if (!pending && connection->_closeWhenSent)
 	{
-	case wxSOCKET_INPUT:
-#ifdef DETAILED_LOGGING
-        logger_base.info("OnSocketEvent: wxSOCKET_INPUT");
-#endif
-		break;
-	case wxSOCKET_LOST:
-#ifdef DETAILED_LOGGING
-        logger_base.info("OnSocketEvent: wxSOCKET_LOST");
-#endif
-		break;
-	default:
+		CloseConnection(connection);
+		return;
+	}
+
+	// only ask to hear about the socket being writable while there is something to write
+	if (pending != connection->_pollWrite)
+	{
+		_poller.Modify(connection->_socket, pending);
+		connection->_pollWrite = pending;
+	}
+}
+
+void HttpServerThread::CloseConnection(std::shared_ptr<HttpConnection> connection)
+{
 #ifdef DETAILED_LOGGING
-        logger_base.info("OnServerEvent: unexpected event %d", event.GetSocketEvent());
+	static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+	logger_base.info("connection closed (socket %d)", (int)connection->_socket);
 #endif
-		break;
-	}
 
-	wxSocketBase *socket = event.GetSocket();
+	_poller.Remove(connection->_socket);
+	HTTP_CLOSESOCKET(connection->_socket);
+	_connections.erase(connection->_socket);
+	connection->_socket = HTTP_INVALID_SOCKET;
+	connection->_open = false;
 
-	HttpConnection *connection = _connections[socket];
-	wxASSERT(connection != NULL);
+	_server->QueueWork({ HttpWork::Closed, connection, 0, "" });
+}
 
-	// Now we process the event
-	switch(event.GetSocketEvent())
+wxThread::ExitCode HttpServerThread::Entry()
+{
+	static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+	logger_base.debug("Web server network thread started.");
+
+	_poller.Add(_server->_listen, false);
+	_poller.Add(_server->_wake, false);
+
+	std::vector<HttpPoller::Event> events;
+	while (!_stop)
 	{
-	case wxSOCKET_INPUT:
+		events.clear();
+		if (!_poller.Wait(events))
 		{
-			// We disable input events, so that the test doesn't trigger wxSocketEvent again.
-			socket->SetNotify(wxSOCKET_LOST_FLAG);
-			socket->SetFlags(wxSOCKET_NOWAIT);
+			logger_base.error("Web server network thread failed waiting for sockets ... stopping.");
+			break;
+		}
+
+		for (const auto &it : events)
+		{
+			if (it.socket == _server->_listen)
+			{
+				Accept();
+			}
+			else if (it.socket == _server->_wake)
+			{
+				DrainWake();
+			}
+			else
+			{
+				auto c = _connections.find(it.socket);
+				if (c == _connections.end()) continue;
+				auto connection = c->second;
+
+				bool ok = true;
+				if (it.read || it.error) ok = connection->Read();
+				if (ok && it.write) ok = connection->Write();
+
+				if (ok)
+					Update(connection);
+				else
+					CloseConnection(connection);
+			}
+		}
+
+		// send anything the main thread or the parsing above queued
+		ProcessOutput();
+	}
+
+	for (auto &it : _connections)
+	{
+		HTTP_CLOSESOCKET(it.first);
+		it.second->_socket = HTTP_INVALID_SOCKET;
+		it.second->_open = false;
+	}
+	_connections.clear();
+
+	logger_base.debug("Web server network thread stopped.");
 
-			connection->HandleRequest();
+	return nullptr;
+}
+
+// reads whatever has arrived ... false if the connection has gone
+bool HttpConnection::Read()
+{
+	char buffer[4096];
 
-			// Enable input events again.
-			socket->SetNotify(wxSOCKET_LOST_FLAG | wxSOCKET_INPUT_FLAG);
+	for (;;)
+	{
+		auto read = recv(SOCKETOF(_socket), buffer, sizeof(buffer), 0);
+		if (read > 0)
+		{
+			_input.append(buffer, read);
+		}
+		else if (read == 0)
+		{
+			return false;
+		}
+		else if (HTTP_INTERRUPTED())
+		{
+			continue;
+		}
+		else if (HTTP_WOULDBLOCK())
+		{
 			break;
 		}
-	case wxSOCKET_LOST:
+		else
 		{
-			_connections.erase(_connections.find(socket));
-			delete connection;
+			return false;
+		}
+	}
 
-			// Destroy() should be used instead of delete wherever possible, due to the fact that wxSocket uses 'delayed events'
-			// (see the documentation for wxPostEvent) and we don't want an event to arrive to the event handler (the frame,
-			// here) after the socket has been deleted. Also, we might be doing some other thing with the socket at the same
-			// time; for example, we might be in the middle of a test or something. Destroy() takes care of all this for us.
-#ifdef DETAILED_LOGGING
-            logger_base.info("deleted socket client (socket %d)", socket->GetSocket());
-#endif
-			socket->Destroy();
-			break;
+	return ParseInput();
+}
+
+// writes as much as the socket will take ... false if the connection has gone
+bool HttpConnection::Write()
+{
+	while (_outputPos < _output.size())
+	{
+		auto written = send(SOCKETOF(_socket), _output.data() + _outputPos, (int)(_output.size() - _outputPos), HTTP_SEND_FLAGS);
+		if (written > 0)
+		{
+			_outputPos += written;
+		}
+		else if (written < 0 && HTTP_INTERRUPTED())
+		{
+			continue;
+		}
+		else if (written < 0 && HTTP_WOULDBLOCK())
+		{
+			return true;
+		}
+		else
+		{
+			return false;
 		}
-    default:
-        break;
 	}
 
-#ifdef DETAILED_LOGGING
-    logger_base.info("OnSocketEvent Time %ld.", sw.Time());
+	_output.clear();
+	_outputPos = 0;
+
+	return true;
+}
+
+HttpServer::HttpServer() :
+	_listen(HTTP_INVALID_SOCKET),
+	_wake(HTTP_INVALID_SOCKET),
+	_thread(nullptr),
+	_winsock(false)
+{
+}
+
+HttpServer::~HttpServer()
+{
+	Stop();
+}
+
+bool HttpServer::Start(const HttpContext &context)
+{
+	static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+	if (_thread)
+		Stop();
+
+	_context = context;
+
+	// Create the address - defaults to localhost:0 initially
+	_address.Service(_context.Port);
+
+	wxLogMessage(_("starting server on %s:%u..."), _address.IPAddress(), _address.Service());
+	logger_base.info("starting server on %s:%u...", (const char *)_address.IPAddress().c_str(), _address.Service());
+
+#ifdef __WXMSW__
+	WSADATA wsaData;
+	_winsock = WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
 #endif
+
+	_listen = CreateListenSocket(_context.Port);
+	_wake = CreateWakeSocket();
+
+	if (_listen == HTTP_INVALID_SOCKET || _wake == HTTP_INVALID_SOCKET)
+	{
+		wxLogError(_("unable to start the server on the specified port"));
+		logger_base.error(_("unable to start the server on the specified port"));
+		Stop();
+		return false;
+	}
+
+	_thread = new HttpServerThread(this);
+	if (!_thread->IsOk() || _thread->Run() != wxTHREAD_NO_ERROR)
+	{
+		logger_base.error("unable to start the web server network thread");
+		delete _thread;
+		_thread = nullptr;
+		Stop();
+		return false;
+	}
+
+	wxLogMessage(_("server running on port %u"), _address.Service());
+	logger_base.info("server running on port %u", _address.Service());
+
+	return true;
+}
+
+bool HttpServer::Stop()
+{
+	static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+	if (_listen == HTTP_INVALID_SOCKET && _wake == HTTP_INVALID_SOCKET)
+	{
+		// a failed start still has winsock to release
+		StopWinsock();
+		return false;
+	}
+
+	// the thread closes all the open connections on the way out
+	if (_thread)
+	{
+		_thread->Stop();
+		_thread->Wait();
+		delete _thread;
+		_thread = nullptr;
+	}
+
+	if (_listen != HTTP_INVALID_SOCKET) HTTP_CLOSESOCKET(_listen);
+	if (_wake != HTTP_INVALID_SOCKET) HTTP_CLOSESOCKET(_wake);
+	_listen = HTTP_INVALID_SOCKET;
+	_wake = HTTP_INVALID_SOCKET;
+
+	_work.PopAll();
+	_output.PopAll();
+	_connections.clear();
+
+	StopWinsock();
+
+	wxLogMessage(_("closed server on %s:%u"), _address.IPAddress(), _address.Service());
+	logger_base.debug("closed server on %s:%u", (const char*)_address.IPAddress().c_str(), _address.Service());
+
+	return true;
+}
+
+void HttpServer::StopWinsock()
+{
+#ifdef __WXMSW__
+	if (_winsock)
+	{
+		WSACleanup();
+	}
+#endif
+	_winsock = false;
+}
+
+void HttpServer::Wake()
+{
+	send(SOCKETOF(_wake), "w", 1, HTTP_SEND_FLAGS);
+}
+
+void HttpServer::QueueWork(HttpWork &&work)
+{
+	// only the first item needs to wake the main thread ... the rest are picked up with it
+	if (_work.Push(std::move(work)))
+	{
+		CallAfter(&HttpServer::ProcessWork);
+	}
+}
+
+void HttpServer::QueueOutput(HttpOutput &&output)
+{
+	if (_output.Push(std::move(output)))
+	{
+		Wake();
+	}
+}
+
+void HttpServer::ProcessWork()
+{
+	for (auto &it : _work.PopAll())
+	{
+		switch (it.type)
+		{
+		case HttpWork::Connected:
+			_connections[it.connection.get()] = it.connection;
+			break;
+		case HttpWork::Request:
+			it.connection->HandleRequest(wxString(it.data.c_str(), it.data.size()));
+			break;
+		case HttpWork::Message:
+			it.connection->HandleMessage((WebSocketMessage::Opcode)it.opcode, it.data);
+			break;
+		case HttpWork::Closed:
+			_connections.erase(it.connection.get());
+			break;
+		}
+	}
 }
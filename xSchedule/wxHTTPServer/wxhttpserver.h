@@ -24,6 +24,12 @@
 #include <wx/dynarray.h>
 #include <wx/hash.h>
 
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
 #define SERVER_NAME    "xLights Web Server"
 #define SERVER_VERSION "1.0"
 
@@ -34,6 +40,10 @@
 	typedef wxIPV4address IPaddress;
 #endif // wxUSE_IPV6
 
+// native socket handle ... big enough for a SOCKET on windows and an int everywhere else
+typedef wxUIntPtr HttpSocket;
+#define HTTP_INVALID_SOCKET ((HttpSocket)-1)
+
 WX_DECLARE_STRING_HASH_MAP(wxString, wxHashString);
 
 // Forward declarations
@@ -45,6 +55,7 @@ class HttpConnection;
 class HttpRequest;
 class HttpResponse;
 class WebSocketMessage;
+class HttpServerThread;
 
 typedef bool (*RequestHandlerPtr)(HttpConnection &connection, HttpRequest &request);
 typedef void (*MessageHandlerPtr)(HttpConnection &connection, WebSocketMessage &message);
@@ -192,40 +203,94 @@ public:
 
 };
 
+// Complete WebSocket message (framing is managed by server)
+class /* WXDLLIMPEXP_BASE */ WebSocketMessage
+{
+public:
+	enum Opcode
+	{
+		Continuation = 0x0, // denotes a continuation frame
+		Text = 0x1, // denotes a text frame
+		Binary = 0x2, // denotes a binary frame
+		// 0x3-7 are reserved for further non-control frames
+		Close = 0x8, // denotes a connection close
+		Ping = 0x9, // denotes a ping
+		Pong = 0xA, // denotes a pong
+		// 0xB-0xF are reserved for further control frames
+	};
+
+	WebSocketMessage(Opcode type = Text);
+	WebSocketMessage(const wxString &text);
+	WebSocketMessage(const wxMemoryBuffer &buffer);
+
+	// properties
+
+	// messagge type
+	inline Opcode Type() { return _type; }
+	// messagge content
+	inline const wxMemoryBuffer &Content() const { return _content; }
+
+protected:
+	Opcode         _type;
+	wxMemoryBuffer _content;
+
+	friend class HttpConnection;
+};
+
 // Connection class
-class /* WXDLLIMPEXP_BASE */ HttpConnection
+//
+// Sockets are read and written on the server network thread. Complete requests and messages are handed to the
+// handlers on the main thread and anything they send is queued back to the network thread to be written.
+class /* WXDLLIMPEXP_BASE */ HttpConnection : public std::enable_shared_from_this<HttpConnection>
 {
 public:
-	HttpConnection(HttpServer *server, wxSocketBase *socket);
+	HttpConnection(HttpServer *server, HttpSocket socket, const IPaddress &address);
 	virtual ~HttpConnection();
 
-	virtual bool HandleRequest();
+	virtual bool HandleRequest(const wxString &input);
+	virtual void HandleMessage(WebSocketMessage::Opcode type, const std::string &content);
 	virtual bool SendResponse(HttpResponse &response);
 	virtual bool SendMessage(WebSocketMessage &message);
 	virtual bool Close();
 
 	// properties
-	inline bool IsOpen() { return (_socket && _socket->IsOk()); }
+	inline bool IsOpen() { return _open; }
 	inline const HttpServer *Server() const { return _server; }
-	inline const wxSocketBase *Socket() const { return _socket; }
+	inline HttpSocket Socket() const { return _socket; }
 	inline const IPaddress &Address() { return _address; }
 	inline bool IsWebSocket() { return _isWebSocket; }
 
 protected:
-	void ParseRequest(const wxString &content);
-	bool ParseFrame(wxMemoryBuffer &buffer);
+	// these are only called on the network thread
+	bool Read();
+	bool Write();
+	bool ParseInput();
+	bool ParseRequest(bool &more);
+	bool ParseFrame(bool &more);
 	bool WebSocketHandshake(HttpRequest &request);
+	void Send(std::string &&data, bool close);
 
 protected:
 	HttpServer       *_server;
-	wxSocketBase     *_socket;
+	HttpSocket        _socket;
 	IPaddress         _address;
-	bool              _isWebSocket;
-	WebSocketMessage *_message;
+	std::atomic<bool> _isWebSocket;
+	std::atomic<bool> _open;
+
+	// network thread only
+	std::string              _input;
+	std::string              _output;
+	size_t                   _outputPos;
+	bool                     _closeWhenSent;
+	bool                     _pollWrite;
+	WebSocketMessage::Opcode _messageType;
+	std::string              _message;
+
+	friend class HttpServer;
+	friend class HttpServerThread;
 };
 
-//WX_DECLARE_EXPORTED_HASH_MAP(wxSocketBase *, HttpConnection *, wxPointerHash, wxPointerEqual, ConnectionMap);
-WX_DECLARE_HASH_MAP(wxSocketBase *, HttpConnection *, wxPointerHash, wxPointerEqual, ConnectionMap);
+typedef std::map<HttpConnection *, std::shared_ptr<HttpConnection>> ConnectionMap;
 
 // HTTP request
 class /* WXDLLIMPEXP_BASE */ HttpRequest
@@ -311,68 +376,117 @@ protected:
 	friend class HttpConnection;
 };
 
-// Server main class
-class /* WXDLLIMPEXP_BASE */ HttpServer : public wxEvtHandler
+// Multiple producer single consumer queue. Push never blocks and the consumer takes everything queued so far in
+// one go so neither side ever waits for the other.
+template <class T>
+class HttpQueue
 {
-public:
-	HttpServer();
-	virtual ~HttpServer();
+	struct Node
+	{
+		T     item;
+		Node *next;
+	};
 
-	bool Start(const HttpContext &context);
-	bool Stop();
+	std::atomic<Node *> _head;
 
-	// properties
+public:
+	HttpQueue() : _head(nullptr) { }
+	~HttpQueue() { PopAll(); }
 
-	inline const HttpContext &Context() const { return _context; }
+	// returns true if the queue was empty ... the consumer needs waking up
+	bool Push(T &&item)
+	{
+		Node *node = new Node{ std::move(item), nullptr };
+		Node *head = _head.load(std::memory_order_relaxed);
+		do
+		{
+			node->next = head;
+		} while (!_head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
 
-protected:
-	// event handlers (these functions should _not_ be virtual)
-	void OnServerEvent(wxSocketEvent &event);
-	void OnSocketEvent(wxSocketEvent &event);
-    ConnectionMap   _connections;
+		// once it is pushed the node belongs to the consumer so dont look at it again
+		return head == nullptr;
+	}
 
-private:
-	wxSocketServer *_server;
-	HttpContext     _context;
-	IPaddress       _address;
+	// everything queued in the order it was pushed
+	std::list<T> PopAll()
+	{
+		std::list<T> res;
+		Node *node = _head.exchange(nullptr, std::memory_order_acquire);
+		while (node)
+		{
+			res.push_front(std::move(node->item));
+			Node *next = node->next;
+			delete node;
+			node = next;
+		}
+		return res;
+	}
+};
 
-	DECLARE_EVENT_TABLE()
+// work handed from the network thread to the main thread
+struct HttpWork
+{
+	enum WorkType
+	{
+		Connected,
+		Request,
+		Message,
+		Closed
+	};
 
-	friend class HttpConnection;
+	WorkType                        type;
+	std::shared_ptr<HttpConnection> connection;
+	int                             opcode;
+	std::string                     data;
 };
 
-// Complete WebSocket message (framing is managed by server)
-class /* WXDLLIMPEXP_BASE */ WebSocketMessage
+// data handed from the main thread to the network thread
+struct HttpOutput
+{
+	std::shared_ptr<HttpConnection> connection;
+	std::string                     data;
+	bool                            close;
+};
+
+// Server main class
+//
+// All socket work happens on a network thread so a slow or busy client never holds up the main thread. The
+// handlers still run on the main thread ... requests are queued and the whole queue is processed each time the
+// main thread gets to it.
+class /* WXDLLIMPEXP_BASE */ HttpServer : public wxEvtHandler
 {
 public:
-	enum Opcode
-	{
-		Continuation = 0x0, // denotes a continuation frame
-		Text = 0x1, // denotes a text frame
-		Binary = 0x2, // denotes a binary frame
-		// 0x3-7 are reserved for further non-control frames
-		Close = 0x8, // denotes a connection close
-		Ping = 0x9, // denotes a ping
-		Pong = 0xA, // denotes a pong
-		// 0xB-0xF are reserved for further control frames
-	};
+	HttpServer();
+	virtual ~HttpServer();
 
-	WebSocketMessage(Opcode type = Text);
-	WebSocketMessage(const wxString &text);
-	WebSocketMessage(const wxMemoryBuffer &buffer);
+	bool Start(const HttpContext &context);
+	bool Stop();
 
 	// properties
 
-	// messagge type
-	inline Opcode Type() { return _type; }
-	// messagge content
-	inline const wxMemoryBuffer &Content() const { return _content; }
+	inline const HttpContext &Context() const { return _context; }
 
 protected:
-	Opcode         _type;
-	wxMemoryBuffer _content;
+	ConnectionMap   _connections; // main thread only
+
+	void QueueWork(HttpWork &&work);
+	void QueueOutput(HttpOutput &&output);
+	void ProcessWork();
+	void Wake();
+	void StopWinsock();
+
+private:
+	HttpContext            _context;
+	IPaddress              _address;
+	HttpSocket             _listen;
+	HttpSocket             _wake;
+	HttpServerThread      *_thread;
+	bool                   _winsock; // WSAStartup needs a matching WSACleanup
+	HttpQueue<HttpWork>    _work;
+	HttpQueue<HttpOutput>  _output;
 
 	friend class HttpConnection;
+	friend class HttpServerThread;
 };
 
 #endif // __HTTP_H__
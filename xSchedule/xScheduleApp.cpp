@@ -454,11 +454,13 @@ bool xScheduleApp::OnInit()
         { wxCMD_LINE_OPTION, "s", "show", "specify show directory" },
         { wxCMD_LINE_OPTION, "p", "playlist", "specify the playlist to play" },
         { wxCMD_LINE_SWITCH, "w", "wipe", "wipe settings clean" },
+        { wxCMD_LINE_SWITCH, "x", "headless", "run without showing the main window ... control it using the web api" },
         { wxCMD_LINE_NONE }
     };
 
     bool parmfound = false;
     bool wipeSettings = false;
+    bool headless = false;
     wxString showDir;
     wxString playlist;
     wxCmdLineParser parser(cmdLineDesc, argc, argv);
@@ -482,6 +484,12 @@ bool xScheduleApp::OnInit()
             parmfound = true;
             logger_base.info("-p: Playlist to play %s.", (const char*)playlist.c_str());
         }
+        if (parser.Found("x"))
+        {
+            parmfound = true;
+            logger_base.info("-x: Running headless.");
+            headless = true;
+        }
         if (!parmfound && parser.GetParamCount() > 0)
         {
             logger_base.info("Unrecognised command line parameter found.");
@@ -521,7 +529,8 @@ bool xScheduleApp::OnInit()
     if (wxsOK)
     {
         xScheduleFrame* Frame = new xScheduleFrame(0, showDir, playlist);
-        Frame->Show();
+        // the frame still owns the schedule so it is created ... it just never appears
+        if (!headless) Frame->Show();
         SetTopWindow(Frame);
         if (wipeSettings) Frame->GetPluginManager().WipeSettings();
     }
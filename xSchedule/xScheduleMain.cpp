@@ -203,7 +203,6 @@ const long xScheduleFrame::MNU_CONFIGUREMIDITIMECODE = wxNewId();
 const long xScheduleFrame::ID_MNU_CONFIGURE_TEST = wxNewId();
 const long xScheduleFrame::idMenuAbout = wxNewId();
 const long xScheduleFrame::ID_STATUSBAR1 = wxNewId();
-const long xScheduleFrame::ID_TIMER1 = wxNewId();
 const long xScheduleFrame::ID_TIMER2 = wxNewId();
 //*)
 
@@ -366,7 +365,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     __schedule = nullptr;
     _statusSetAt = wxDateTime::Now();
     _webServer = nullptr;
-    _timerOutputFrame = false;
     _suspendOTL = false;
     _nowebicon = wxBitmap(no_web_icon_24);
     _webicon = wxBitmap(web_icon_24);
@@ -375,9 +373,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     _slowDisplayed = false;
     _lastSlow = 0;
 
-    static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
-    _timer.SetLog((logger_frame.getPriority() == log4cpp::Priority::DEBUG));
-
     //(*Initialize(xScheduleFrame)
     wxBoxSizer* BoxSizer1;
     wxFlexGridSizer* FlexGridSizer2;
@@ -609,8 +604,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     StatusBar1->SetStatusStyles(1,__wxStatusBarStyles_1);
     SetStatusBar(StatusBar1);
     DirDialog1 = new wxDirDialog(this, _("Select show folder ..."), wxEmptyString, wxDD_DEFAULT_STYLE, wxDefaultPosition, wxDefaultSize, _T("wxDirDialog"));
-    _timer.SetOwner(this, ID_TIMER1);
-    _timer.Start(500000, false);
     _timerSchedule.SetOwner(this, ID_TIMER2);
     _timerSchedule.Start(50000, false);
     FileDialog1 = new wxFileDialog(this, _("Select file"), wxEmptyString, _("xlights_schedule.xml"), _("xlights_schedule.xml"), wxFD_DEFAULT_STYLE|wxFD_OPEN|wxFD_FILE_MUST_EXIST, wxDefaultPosition, wxDefaultSize, _T("wxFileDialog"));
@@ -675,7 +668,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
     Connect(MNU_CONFIGUREMIDITIMECODE,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnMenuItem5MenuItem_ConfigureMIDITimecodeSelected);
     Connect(ID_MNU_CONFIGURE_TEST,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnMenuItem_ConfigureTestSelected);
     Connect(idMenuAbout,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xScheduleFrame::OnAbout);
-    Connect(ID_TIMER1,wxEVT_TIMER,(wxObjectEventFunction)&xScheduleFrame::On_timerTrigger);
     Connect(ID_TIMER2,wxEVT_TIMER,(wxObjectEventFunction)&xScheduleFrame::On_timerScheduleTrigger);
     Connect(wxID_ANY,wxEVT_CLOSE_WINDOW,(wxObjectEventFunction)&xScheduleFrame::OnClose);
     Connect(wxEVT_SIZE,(wxObjectEventFunction)&xScheduleFrame::OnResize);
@@ -705,7 +697,6 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
         xlconfig = nullptr;
     }
 
-    _timer.SetName("xSchedule frame timer");
     _timerSchedule.SetName("xSchedule schedule timer");
 
     SetTitle("xLights Scheduler " + GetDisplayVersionString());
@@ -829,8 +820,7 @@ xScheduleFrame::xScheduleFrame(wxWindow* parent, const std::string& showdir, con
         UpdateUI();
     }
 
-    if (rate == 0) rate = 50;
-    _timer.Start(rate / 2, false, "FrameTimer");
+    CorrectTimer(rate);
     _timerSchedule.Start(500, false, "ScheduleTimer");
 
     StaticText_IP->SetLabel("    " + __schedule->GetOurIP() + "   ");
@@ -1023,7 +1013,7 @@ xScheduleFrame::~xScheduleFrame()
     logger_base.debug("xScheduleFrame destructor start.");
 
     // stop the timers immediately
-    _timer.Stop();
+    if (__schedule != nullptr) __schedule->StopFrameClock();
     _timerSchedule.Stop();
 
     // give them plenty of time to stop
@@ -1354,10 +1344,10 @@ void xScheduleFrame::OnMenuItem_ShowFolderSelected(wxCommandEvent& event)
     {
         _pluginManager.Uninitialise();
         _timerSchedule.Stop();
-        _timer.Stop();
+        __schedule->StopFrameClock();
         LoadSchedule();
         wxASSERT(__schedule != nullptr);
-        _timer.Start(50 / 2, false);
+        CorrectTimer(50);
         _timerSchedule.Start(500, false);
         _pluginManager.Initialise(_showDir);
     }
@@ -1481,7 +1471,8 @@ void xScheduleFrame::OnTreeCtrl_PlayListsSchedulesItemActivated(wxTreeEvent& eve
     ValidateWindow();
 }
 
-void xScheduleFrame::On_timerTrigger(wxTimerEvent& event)
+// called on the main thread each time the frame clock ticks
+void xScheduleFrame::OnFrameClock()
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
@@ -1489,23 +1480,17 @@ void xScheduleFrame::On_timerTrigger(wxTimerEvent& event)
 
     if (__schedule == nullptr) return;
 
-    static long long lastms = wxGetLocalTimeMillis().GetValue() - 25;
+    static long long lastms = 0;
     long long now = wxGetLocalTimeMillis().GetValue();
     int elapsed = (int)(now - lastms);
-
-    if (elapsed < _timer.GetInterval() / 2)
-    {
-        // this is premature ... maybe it is a backed up timer event ... lets skip it
-        logger_frame.warn("Timer: Frame event fire interval %dms less than 1/4 frame time %dms", elapsed, _timer.GetInterval() / 2);
-        return;
-    }
+    int interval = __schedule->GetFrameClockInterval();
 
     logger_frame.info("Timer: Start frame %d", elapsed);
-    if (elapsed > _timer.GetInterval() * 4)
+    if (interval != 0 && elapsed > interval * 2)
     {
         if (lastms != 0 && __schedule->IsOutputToLights())
         {
-            logger_base.warn("Frame interval greater than 200%% of what it should have been [%d] %d", _timer.GetInterval() * 2, (int)(now - lastms));
+            logger_base.warn("Frame interval greater than 200%% of what it should have been [%d] %d", interval, elapsed);
             _lastSlow = wxGetUTCTimeMillis();
         }
     }
@@ -1513,10 +1498,10 @@ void xScheduleFrame::On_timerTrigger(wxTimerEvent& event)
 
     wxDateTime frameStart = wxDateTime::UNow();
 
-    int rate = __schedule->Frame(_timerOutputFrame, this);
+    int rate = __schedule->Frame(true, this);
 
 #ifndef WEBOVERLOAD
-    if (last != wxDateTime::Now().GetSecond() && _timerOutputFrame)
+    if (last != wxDateTime::Now().GetSecond())
 #endif
     {
         // This code must be commented out before release!!!
@@ -1531,18 +1516,6 @@ void xScheduleFrame::On_timerTrigger(wxTimerEvent& event)
     wxDateTime frameEnd = wxDateTime::UNow();
     long ms = (frameEnd - frameStart).GetMilliseconds().ToLong();
 
-    if (ms > _timer.GetInterval())
-    {
-        // we took too long so next frame has to be an output frame
-        _timerOutputFrame = true;
-        logger_frame.debug("Timer: Frame took too long %ld > %d so next frame forced to be output", ms, _timer.GetInterval());
-    }
-    else
-    {
-        // output only occurs on alternate timer events
-        _timerOutputFrame = !_timerOutputFrame;
-    }
-
     logger_frame.info("Timer: Frame time %ld", ms);
 }
 
@@ -1736,6 +1709,7 @@ void xScheduleFrame::OnMenuItem_OptionsSelected(wxCommandEvent& event)
 
         Schedule::SetCity(__schedule->GetOptions()->GetCity());
         __schedule->GetOutputManager()->SetParallelTransmission(__schedule->GetOptions()->IsParallelTransmission());
+        __schedule->GetOutputManager()->SetPacedTransmission(__schedule->GetOptions()->IsPacedTransmission());
         OutputManager::SetRetryOpen(__schedule->GetOptions()->IsRetryOpen());
         __schedule->GetOutputManager()->SetSyncEnabled(__schedule->GetOptions()->IsSync());
 
@@ -1847,9 +1821,9 @@ void xScheduleFrame::ChangeShowFolder(wxCommandEvent& event)
     _showDir = newShowFolder.ToStdString();
     SaveShowDir();
     _timerSchedule.Stop();
-    _timer.Stop();
+    __schedule->StopFrameClock();
     LoadSchedule();
-    _timer.Start(50 / 2, false);
+    CorrectTimer(50);
     _timerSchedule.Start(500, false);
     ValidateWindow();
 }
@@ -1870,7 +1844,7 @@ void xScheduleFrame::OnButton_UserClick(wxCommandEvent& event)
         playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(TreeCtrl_PlayListsSchedules->GetItemParent(treeitem)))->GetData();
     }
 
-    size_t rate = _timer.GetInterval();
+    size_t rate = __schedule->GetFrameClockInterval();
     wxString msg = "";
     __schedule->Action(((wxButton*)event.GetEventObject())->GetLabel(), playlist, schedule, rate, msg);
 
@@ -2577,7 +2551,7 @@ bool xScheduleFrame::HandleHotkeys(wxKeyEvent& event)
                 schedule = (Schedule*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(treeitem))->GetData();
             }
 
-            size_t rate = _timer.GetInterval();
+            size_t rate = __schedule->GetFrameClockInterval();
             wxString msg = "";
             __schedule->Action((*it)->GetLabel(), playlist, schedule, rate, msg);
 
@@ -2595,11 +2569,11 @@ void xScheduleFrame::CorrectTimer(int rate)
 {
     static log4cpp::Category &logger_frame = log4cpp::Category::getInstance(std::string("log_frame"));
     if (rate == 0) rate = 50;
-    if ((rate - __schedule->GetTimerAdjustment()) / 2 != _timer.GetInterval())
+    if (rate - __schedule->GetTimerAdjustment() != __schedule->GetFrameClockInterval())
     {
-        logger_frame.debug("Timer corrected %d", (rate - __schedule->GetTimerAdjustment()) / 2);
+        logger_frame.debug("Timer corrected %d", rate - __schedule->GetTimerAdjustment());
 
-        _timer.Start((rate - __schedule->GetTimerAdjustment()) / 2);
+        __schedule->StartFrameClock(rate - __schedule->GetTimerAdjustment());
     }
 }
 
@@ -3130,7 +3104,7 @@ void xScheduleFrame::DoAction(wxCommandEvent& event)
         playlist = (PlayList*)((MyTreeItemData*)TreeCtrl_PlayListsSchedules->GetItemData(TreeCtrl_PlayListsSchedules->GetItemParent(treeitem)))->GetData();
     }
 
-    size_t rate = _timer.GetInterval();
+    size_t rate = __schedule->GetFrameClockInterval();
     wxString msg = "";
 
     __schedule->Action(amd->_command, amd->_parameters, amd->_data, playlist, schedule, rate, msg);
@@ -3448,7 +3422,16 @@ void xScheduleFrame::SendStatus()
                     __schedule->DoXyzzy("q", "", result, "");
                 }
 
-                _webServer->SendMessageToAllWebSockets(result);
+                // UpdateUI runs many times a second so only push the status when it has changed
+                if (result != _lastWebStatus)
+                {
+                    _webServer->SendMessageToAllWebSockets(result);
+                    _lastWebStatus = result;
+                }
+            }
+            else
+            {
+                _lastWebStatus = "";
             }
         }
 
@@ -3525,9 +3508,9 @@ void xScheduleFrame::OnMenuItem_UsexLightsFolderSelected(wxCommandEvent& event)
     _showDir = ScheduleManager::xLightsShowDir();
     SaveShowDir();
     _timerSchedule.Stop();
-    _timer.Stop();
+    __schedule->StopFrameClock();
     LoadSchedule();
-    _timer.Start(50 / 2, false);
+    CorrectTimer(50);
     _timerSchedule.Start(500, false);
 
     ValidateWindow();
@@ -60,10 +60,10 @@ class xScheduleFrame : public wxFrame
 {
     FILE* _f = nullptr;
     WebServer* _webServer = nullptr;
+    wxString _lastWebStatus;
     static ScheduleManager* __schedule;
     std::string _showDir;
     wxDateTime _statusSetAt;
-    bool _timerOutputFrame;
     bool _suspendOTL;
     Pinger* _pinger;
     wxBitmap _nowebicon;
@@ -134,6 +134,7 @@ public:
         std::string GetWebPluginRequest(const std::string& request);
         wxString ProcessPluginRequest(const wxString& plugin, const wxString& command, const wxString& parameters, const wxString& data, const wxString& reference);
         void ManipulateBuffer(uint8_t* buffer, size_t bufferSize);
+        void OnFrameClock();
         std::string GetOurURL() const;
 
     private:
@@ -148,7 +149,6 @@ public:
         bool SelectShowFolder();
         void OnMenuItem_ShowFolderSelected(wxCommandEvent& event);
         void OnTreeCtrl_PlayListsSchedulesItemActivated(wxTreeEvent& event);
-        void On_timerTrigger(wxTimerEvent& event);
         void On_timerScheduleTrigger(wxTimerEvent& event);
         void OnMenuItem_OptionsSelected(wxCommandEvent& event);
         void OnMenuItem_ViewLogSelected(wxCommandEvent& event);
@@ -300,7 +300,6 @@ public:
         static const long ID_MNU_CONFIGURE_TEST;
         static const long idMenuAbout;
         static const long ID_STATUSBAR1;
-        static const long ID_TIMER1;
         static const long ID_TIMER2;
         //*)
 
@@ -397,7 +396,6 @@ public:
         wxStaticText* StaticText_Time;
         wxStatusBar* StatusBar1;
         wxTreeCtrl* TreeCtrl_PlayListsSchedules;
-        xLightsTimer _timer;
         xLightsTimer _timerSchedule;
         //*)
 